@@ -9,16 +9,148 @@
  *
  */
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 
 #include "esp_liblc3.h"
+#include "esp_liblc3_private.h"
 #include "lc3.h"
 
 static const char* TAG = "LC3";
 
+size_t esp_lc3_sample_size(enum lc3_pcm_format format)
+{
+    switch (format) {
+    case LC3_PCM_FORMAT_S16:
+        return sizeof(int16_t);
+    case LC3_PCM_FORMAT_S24_3LE:
+        return 3;
+    default:
+        return sizeof(int32_t); // S24 and FLOAT
+    }
+}
+
+static int esp_lc3_num_channels(const esp_lc3_config_t* cfg)
+{
+    return cfg->num_channels == 0 ? 1 : cfg->num_channels;
+}
+
+esp_err_t esp_lc3_pool_init(esp_lc3_pool_t* pool, const char* name, void* memory, size_t slot_size, int num_slots)
+{
+    if (num_slots < 1 || num_slots > ESP_LC3_POOL_SLOTS_MAX || slot_size == 0) {
+        ESP_LOGE(TAG, "Pool %s: invalid size", name);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pool->name = name;
+    pool->slot_size = ESP_LC3_STATE_ALIGN_UP(slot_size);
+    pool->num_slots = num_slots;
+    pool->allocated = memory == NULL;
+    atomic_init(&pool->used, 0);
+
+    pool->memory = memory != NULL ? memory
+                                  : heap_caps_malloc(num_slots * pool->slot_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pool->memory == NULL) {
+        ESP_LOGE(TAG, "Pool %s: malloc error", name);
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Pool %s: %d slots of %u bytes", name, num_slots, (unsigned)pool->slot_size);
+    return ESP_OK;
+}
+
+void esp_lc3_pool_deinit(esp_lc3_pool_t* pool)
+{
+    if (atomic_load(&pool->used) != 0) {
+        ESP_LOGW(TAG, "Pool %s: released with slots in use", pool->name);
+    }
+    if (pool->allocated) {
+        heap_caps_free(pool->memory);
+    }
+    pool->memory = NULL;
+}
+
+static void* esp_lc3_pool_alloc(esp_lc3_pool_t* pool, size_t size)
+{
+    if (size > pool->slot_size) {
+        ESP_LOGE(TAG, "Pool %s: %u bytes do not fit a slot of %u", pool->name, (unsigned)size, (unsigned)pool->slot_size);
+        return NULL;
+    }
+
+    unsigned used = atomic_load(&pool->used);
+    for (int i = 0; i < pool->num_slots; i++) {
+        if (used & (1u << i)) {
+            continue;
+        }
+        if (atomic_compare_exchange_weak(&pool->used, &used, used | (1u << i))) {
+            return pool->memory + i * pool->slot_size;
+        }
+        i = -1; // raced with another session, rescan with the updated mask
+    }
+
+    ESP_LOGE(TAG, "Pool %s: no free slot", pool->name);
+    return NULL;
+}
+
+static void esp_lc3_pool_free(esp_lc3_pool_t* pool, void* p)
+{
+    int i = ((uint8_t*)p - pool->memory) / pool->slot_size;
+    atomic_fetch_and(&pool->used, ~(1u << i));
+}
+
+static void* esp_lc3_mem_alloc(const esp_lc3_mem_config_t* mem, size_t size)
+{
+    switch (mem->type) {
+    case ESP_LC3_MEM_INTERNAL:
+        return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    case ESP_LC3_MEM_CAPS:
+        return heap_caps_malloc(size, mem->caps);
+    case ESP_LC3_MEM_STATIC:
+        if (mem->memory == NULL || mem->size < size) {
+            ESP_LOGE(TAG, "Static memory of %u bytes, %u needed", (unsigned)mem->size, (unsigned)size);
+            return NULL;
+        }
+        return mem->memory;
+    case ESP_LC3_MEM_POOL:
+        return esp_lc3_pool_alloc(mem->pool, size);
+    default:
+        return malloc(size);
+    }
+}
+
+static void esp_lc3_mem_free(const esp_lc3_mem_config_t* mem, void* p)
+{
+    if (p == NULL) {
+        return;
+    }
+
+    switch (mem->type) {
+    case ESP_LC3_MEM_INTERNAL:
+    case ESP_LC3_MEM_CAPS:
+        heap_caps_free(p);
+        break;
+    case ESP_LC3_MEM_STATIC:
+        break;
+    case ESP_LC3_MEM_POOL:
+        esp_lc3_pool_free(mem->pool, p);
+        break;
+    default:
+        free(p);
+        break;
+    }
+}
+
+size_t esp_lc3_state_size(const esp_lc3_config_t* cfg, bool decoder)
+{
+    unsigned size = decoder ? lc3_decoder_size(cfg->frame_size, cfg->sample_rate)
+                            : lc3_encoder_size(cfg->frame_size, cfg->sample_rate);
+    return size ? esp_lc3_num_channels(cfg) * ESP_LC3_STATE_ALIGN_UP(size) : 0;
+}
+
 esp_err_t esp_lc3_encoder_init(esp_lc3_encoder_t* enc, const esp_lc3_config_t* cfg)
 {
     // TODO: check cfg struct is valid
@@ -28,10 +160,12 @@ esp_err_t esp_lc3_encoder_init(esp_lc3_encoder_t* enc, const esp_lc3_config_t* c
     enc->nbytes_target = cfg->nbytes_target;
     enc->stride = cfg->stride;
 
+    enc->mem = cfg->mem;
+
     unsigned int enc_size = lc3_encoder_size(enc->dt_us, enc->sr_hz);
     enc->num_frames = lc3_frame_samples(enc->dt_us, enc->sr_hz);
 
-    enc->lc3_encoder_memory = malloc(enc_size);
+    enc->lc3_encoder_memory = esp_lc3_mem_alloc(&enc->mem, enc_size);
     if (enc->lc3_encoder_memory == NULL) {
         ESP_LOGE(TAG, "Malloc error");
         return ESP_FAIL;
@@ -39,11 +173,30 @@ esp_err_t esp_lc3_encoder_init(esp_lc3_encoder_t* enc, const esp_lc3_config_t* c
 
     enc->encoder = lc3_setup_encoder(enc->dt_us, enc->sr_hz, 0, enc->lc3_encoder_memory);
 
-    if (enc->encoder != NULL) {
-        ESP_LOGI(TAG, "LC3 encoder initialized. Num_frames: %d", enc->num_frames);
+    if (enc->encoder == NULL || lc3_encoder_set_complexity(enc->encoder, cfg->complexity) != 0) {
+        ESP_LOGE(TAG, "Encoder setup error: Wrong parameters");
+        esp_lc3_mem_free(&enc->mem, enc->lc3_encoder_memory);
+        enc->lc3_encoder_memory = NULL;
         return ESP_FAIL;
     }
 
+    ESP_LOGI(TAG, "LC3 encoder initialized. Num_frames: %d", enc->num_frames);
+    return ESP_OK;
+}
+
+void esp_lc3_encoder_deinit(esp_lc3_encoder_t* enc)
+{
+    esp_lc3_mem_free(&enc->mem, enc->lc3_encoder_memory);
+    enc->lc3_encoder_memory = NULL;
+    enc->encoder = NULL;
+}
+
+esp_err_t esp_lc3_encoder_set_complexity(esp_lc3_encoder_t* enc, enum lc3_complexity complexity)
+{
+    if (lc3_encoder_set_complexity(enc->encoder, complexity) != 0) {
+        ESP_LOGE(TAG, "Unsupported complexity: %d", complexity);
+        return ESP_ERR_INVALID_ARG;
+    }
     return ESP_OK;
 }
 
@@ -56,10 +209,12 @@ esp_err_t esp_lc3_decoder_init(esp_lc3_decoder_t* dec, const esp_lc3_config_t* c
     dec->nbytes_target = cfg->nbytes_target;
     dec->stride = cfg->stride;
 
+    dec->mem = cfg->mem;
+
     unsigned int dec_size = lc3_decoder_size(dec->dt_us, dec->sr_hz);
     dec->num_frames = lc3_frame_samples(dec->dt_us, dec->sr_hz);
 
-    dec->lc3_decoder_memory = malloc(dec_size);
+    dec->lc3_decoder_memory = esp_lc3_mem_alloc(&dec->mem, dec_size);
     if (dec->lc3_decoder_memory == NULL) {
         ESP_LOGE(TAG, "Malloc error");
         return ESP_FAIL;
@@ -67,14 +222,24 @@ esp_err_t esp_lc3_decoder_init(esp_lc3_decoder_t* dec, const esp_lc3_config_t* c
 
     dec->decoder = lc3_setup_decoder(dec->dt_us, dec->sr_hz, 0, dec->lc3_decoder_memory);
 
-    if (dec->decoder != NULL) {
-        ESP_LOGI(TAG, "LC3 decoder initialized. Num_frames: %d", dec->num_frames);
+    if (dec->decoder == NULL) {
+        ESP_LOGE(TAG, "Decoder setup error: Wrong parameters");
+        esp_lc3_mem_free(&dec->mem, dec->lc3_decoder_memory);
+        dec->lc3_decoder_memory = NULL;
         return ESP_FAIL;
     }
 
+    ESP_LOGI(TAG, "LC3 decoder initialized. Num_frames: %d", dec->num_frames);
     return ESP_OK;
 }
 
+void esp_lc3_decoder_deinit(esp_lc3_decoder_t* dec)
+{
+    esp_lc3_mem_free(&dec->mem, dec->lc3_decoder_memory);
+    dec->lc3_decoder_memory = NULL;
+    dec->decoder = NULL;
+}
+
 
 esp_err_t esp_lc3_encode(esp_lc3_encoder_t* enc, const void *in, void *out)
 {
@@ -98,3 +263,154 @@ esp_err_t esp_lc3_decode(esp_lc3_decoder_t* dec, const void *in, void *out)
     }
     return ESP_OK;
 }
+
+esp_err_t esp_lc3_multi_encoder_init(esp_lc3_multi_encoder_t* enc, const esp_lc3_config_t* cfg)
+{
+    int num_channels = esp_lc3_num_channels(cfg);
+    if (num_channels < 1 || num_channels > ESP_LC3_CHANNELS_MAX) {
+        ESP_LOGE(TAG, "Unsupported number of channels: %d", num_channels);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    enc->format = cfg->format;
+    enc->sr_hz = cfg->sample_rate;
+    enc->dt_us = cfg->frame_size;
+    enc->nbytes_target = cfg->nbytes_target;
+    enc->num_channels = num_channels;
+    enc->num_frames = lc3_frame_samples(enc->dt_us, enc->sr_hz);
+    enc->mem = cfg->mem;
+
+    unsigned int enc_size = lc3_encoder_size(enc->dt_us, enc->sr_hz);
+    if (enc_size == 0) {
+        ESP_LOGE(TAG, "Encoder setup error: Wrong parameters");
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t state_size = ESP_LC3_STATE_ALIGN_UP(enc_size);
+
+    enc->memory = esp_lc3_mem_alloc(&enc->mem, num_channels * state_size);
+    if (enc->memory == NULL) {
+        ESP_LOGE(TAG, "Malloc error");
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int ch = 0; ch < num_channels; ch++) {
+        enc->encoders[ch] = lc3_setup_encoder(enc->dt_us, enc->sr_hz, 0, enc->memory + ch * state_size);
+        if (enc->encoders[ch] == NULL) {
+            ESP_LOGE(TAG, "Encoder setup error: Wrong parameters");
+            esp_lc3_multi_encoder_deinit(enc);
+            return ESP_FAIL;
+        }
+    }
+
+    if (esp_lc3_multi_encoder_set_complexity(enc, cfg->complexity) != ESP_OK) {
+        esp_lc3_multi_encoder_deinit(enc);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ESP_LOGI(TAG, "LC3 encoder initialized. Channels: %d, Num_frames: %d", num_channels, enc->num_frames);
+    return ESP_OK;
+}
+
+void esp_lc3_multi_encoder_deinit(esp_lc3_multi_encoder_t* enc)
+{
+    esp_lc3_mem_free(&enc->mem, enc->memory);
+    enc->memory = NULL;
+    enc->num_channels = 0;
+}
+
+esp_err_t esp_lc3_multi_encoder_set_complexity(esp_lc3_multi_encoder_t* enc, enum lc3_complexity complexity)
+{
+    for (int ch = 0; ch < enc->num_channels; ch++) {
+        if (lc3_encoder_set_complexity(enc->encoders[ch], complexity) != 0) {
+            ESP_LOGE(TAG, "Unsupported complexity: %d", complexity);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lc3_multi_decoder_init(esp_lc3_multi_decoder_t* dec, const esp_lc3_config_t* cfg)
+{
+    int num_channels = esp_lc3_num_channels(cfg);
+    if (num_channels < 1 || num_channels > ESP_LC3_CHANNELS_MAX) {
+        ESP_LOGE(TAG, "Unsupported number of channels: %d", num_channels);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    dec->format = cfg->format;
+    dec->sr_hz = cfg->sample_rate;
+    dec->dt_us = cfg->frame_size;
+    dec->nbytes_target = cfg->nbytes_target;
+    dec->num_channels = num_channels;
+    dec->num_frames = lc3_frame_samples(dec->dt_us, dec->sr_hz);
+    dec->mem = cfg->mem;
+
+    unsigned int dec_size = lc3_decoder_size(dec->dt_us, dec->sr_hz);
+    if (dec_size == 0) {
+        ESP_LOGE(TAG, "Decoder setup error: Wrong parameters");
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t state_size = ESP_LC3_STATE_ALIGN_UP(dec_size);
+
+    dec->memory = esp_lc3_mem_alloc(&dec->mem, num_channels * state_size);
+    if (dec->memory == NULL) {
+        ESP_LOGE(TAG, "Malloc error");
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int ch = 0; ch < num_channels; ch++) {
+        dec->decoders[ch] = lc3_setup_decoder(dec->dt_us, dec->sr_hz, 0, dec->memory + ch * state_size);
+        if (dec->decoders[ch] == NULL) {
+            ESP_LOGE(TAG, "Decoder setup error: Wrong parameters");
+            esp_lc3_multi_decoder_deinit(dec);
+            return ESP_FAIL;
+        }
+    }
+
+    ESP_LOGI(TAG, "LC3 decoder initialized. Channels: %d, Num_frames: %d", num_channels, dec->num_frames);
+    return ESP_OK;
+}
+
+void esp_lc3_multi_decoder_deinit(esp_lc3_multi_decoder_t* dec)
+{
+    esp_lc3_mem_free(&dec->mem, dec->memory);
+    dec->memory = NULL;
+    dec->num_channels = 0;
+}
+
+esp_err_t esp_lc3_multi_encode(esp_lc3_multi_encoder_t* enc, const void* in, void* out)
+{
+    size_t sample_size = esp_lc3_sample_size(enc->format);
+
+    for (int ch = 0; ch < enc->num_channels; ch++) {
+        const uint8_t* pcm = (const uint8_t*)in + ch * sample_size;
+        uint8_t* frame = (uint8_t*)out + ch * enc->nbytes_target;
+        if (lc3_encode(enc->encoders[ch], enc->format, pcm, enc->num_channels, enc->nbytes_target, frame) != 0) {
+            ESP_LOGE(TAG, "Encoding error: Wrong parameters");
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lc3_multi_decode(esp_lc3_multi_decoder_t* dec, const void* in, void* out)
+{
+    size_t sample_size = esp_lc3_sample_size(dec->format);
+    bool plc = false;
+
+    for (int ch = 0; ch < dec->num_channels; ch++) {
+        const uint8_t* frame = in ? (const uint8_t*)in + ch * dec->nbytes_target : NULL;
+        uint8_t* pcm = (uint8_t*)out + ch * sample_size;
+        int res = lc3_decode(dec->decoders[ch], frame, dec->nbytes_target, dec->format, pcm, dec->num_channels);
+        if (res < 0) {
+            ESP_LOGE(TAG, "Decoding error: Wrong parameters");
+            return ESP_FAIL;
+        }
+        plc |= res == 1;
+    }
+
+    if (plc) {
+        ESP_LOGW(TAG, "PLC operated");
+    }
+    return ESP_OK;
+}
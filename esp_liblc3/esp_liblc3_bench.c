@@ -0,0 +1,46 @@
+/**
+ * @file esp_liblc3_bench.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Per-stage cycle benchmark of the LC3 encoder and decoder
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "esp_liblc3_bench.h"
+
+#include "esp_log.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_rom_sys.h"
+#endif
+
+static const char* TAG = "LC3-BENCH";
+
+#if LC3_BENCH
+
+esp_err_t esp_lc3_bench_run(const esp_lc3_bench_config_t* cfg, FILE* out)
+{
+#ifdef ESP_PLATFORM
+    int ret = lc3_bench_run(cfg, "cycles", esp_rom_get_cpu_ticks_per_us() * 1000000, out);
+#else
+    int ret = lc3_bench_run(cfg, "ns", 1000000000, out);
+#endif
+
+    if (ret < 0) {
+        ESP_LOGE(TAG, "Frame error");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+#else // LC3_BENCH
+
+esp_err_t esp_lc3_bench_run(const esp_lc3_bench_config_t* cfg, FILE* out)
+{
+    ESP_LOGE(TAG, "Benchmark needs CONFIG_LC3_BENCHMARK");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // LC3_BENCH
@@ -0,0 +1,240 @@
+/**
+ * @file esp_liblc3_parallel.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "esp_liblc3_parallel.h"
+#include "esp_liblc3_private.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// The frame word packs generation, job count and next job index, so a worker
+// that wakes late can never claim a job of the wrong frame
+#define FRAME_GEN_SHIFT 16
+#define FRAME_COUNT_SHIFT 8
+#define FRAME_COUNT(v) (((v) >> FRAME_COUNT_SHIFT) & 0xff)
+#define FRAME_INDEX(v) ((v) & 0xff)
+
+static const char* TAG = "LC3-PARALLEL";
+
+typedef struct {
+    lc3_encoder_t encoder;
+    enum lc3_pcm_format format;
+    const void* pcm;
+    int stride;
+    int nbytes;
+    void* out;
+} esp_lc3_parallel_task_t;
+
+struct esp_lc3_parallel {
+    esp_lc3_parallel_config_t cfg;
+    esp_lc3_parallel_task_t tasks[ESP_LC3_PARALLEL_JOBS_MAX];
+    uint32_t gen;
+    atomic_uint frame;
+    atomic_int remaining;
+    atomic_bool failed;
+    atomic_bool stop;
+    int num_started;
+    TaskHandle_t workers[ESP_LC3_PARALLEL_WORKERS_MAX];
+    SemaphoreHandle_t done; // counting, also given by each worker on exit
+};
+
+/**
+ * @brief Claim and encode jobs of the current frame until none are left
+ *
+ * @return true if this call finished the last job of the frame
+ */
+static bool esp_lc3_parallel_run(esp_lc3_parallel_handle_t p)
+{
+    unsigned v = atomic_load_explicit(&p->frame, memory_order_acquire);
+    while (FRAME_INDEX(v) < FRAME_COUNT(v)) {
+        if (!atomic_compare_exchange_weak_explicit(&p->frame, &v, v + 1, memory_order_acq_rel, memory_order_acquire)) {
+            continue;
+        }
+
+        const esp_lc3_parallel_task_t* t = &p->tasks[FRAME_INDEX(v)];
+        if (lc3_encode(t->encoder, t->format, t->pcm, t->stride, t->nbytes, t->out) != 0) {
+            atomic_store(&p->failed, true);
+        }
+        if (atomic_fetch_sub_explicit(&p->remaining, 1, memory_order_acq_rel) == 1) {
+            return true;
+        }
+        v = atomic_load_explicit(&p->frame, memory_order_acquire);
+    }
+    return false;
+}
+
+static void esp_lc3_parallel_worker(void* arg)
+{
+    esp_lc3_parallel_handle_t p = arg;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (atomic_load(&p->stop)) {
+            break;
+        }
+        if (esp_lc3_parallel_run(p)) {
+            xSemaphoreGive(p->done);
+        }
+    }
+    xSemaphoreGive(p->done);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t esp_lc3_parallel_start(esp_lc3_parallel_handle_t p)
+{
+    p->done = xSemaphoreCreateCounting(ESP_LC3_PARALLEL_WORKERS_MAX, 0);
+    if (p->done == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < p->cfg.num_workers; i++) {
+        BaseType_t core = p->cfg.task_core < 0 ? tskNO_AFFINITY : (p->cfg.task_core + i) % portNUM_PROCESSORS;
+        if (xTaskCreatePinnedToCore(esp_lc3_parallel_worker, "lc3_worker", p->cfg.task_stack_size, p,
+                                    p->cfg.task_priority, &p->workers[i], core) != pdPASS) {
+            return ESP_FAIL;
+        }
+        p->num_started++;
+    }
+    return ESP_OK;
+}
+
+static void esp_lc3_parallel_wake(esp_lc3_parallel_handle_t p, int i)
+{
+    xTaskNotifyGive(p->workers[i]);
+}
+
+static void esp_lc3_parallel_wait(esp_lc3_parallel_handle_t p)
+{
+    xSemaphoreTake(p->done, portMAX_DELAY);
+}
+
+static void esp_lc3_parallel_stop(esp_lc3_parallel_handle_t p)
+{
+    for (int i = 0; i < p->num_started; i++) {
+        xSemaphoreTake(p->done, portMAX_DELAY);
+    }
+    if (p->done != NULL) {
+        vSemaphoreDelete(p->done);
+    }
+}
+
+esp_err_t esp_lc3_parallel_create(const esp_lc3_parallel_config_t* cfg, esp_lc3_parallel_handle_t* handle)
+{
+    if (cfg->num_workers < 0 || cfg->num_workers > ESP_LC3_PARALLEL_WORKERS_MAX) {
+        ESP_LOGE(TAG, "Unsupported number of workers: %d", cfg->num_workers);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_lc3_parallel_handle_t p = calloc(1, sizeof(struct esp_lc3_parallel));
+    if (p == NULL) {
+        ESP_LOGE(TAG, "Malloc error");
+        return ESP_ERR_NO_MEM;
+    }
+    p->cfg = *cfg;
+
+    esp_err_t err = esp_lc3_parallel_start(p);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start workers");
+        esp_lc3_parallel_delete(p);
+        return err;
+    }
+
+    *handle = p;
+    ESP_LOGI(TAG, "LC3 parallel encoder started. Workers: %d", cfg->num_workers);
+    return ESP_OK;
+}
+
+void esp_lc3_parallel_delete(esp_lc3_parallel_handle_t handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    atomic_store(&handle->stop, true);
+    for (int i = 0; i < handle->num_started; i++) {
+        esp_lc3_parallel_wake(handle, i);
+    }
+    esp_lc3_parallel_stop(handle);
+    free(handle);
+}
+
+/**
+ * @brief Publish the tasks of a frame, wake the workers, take part and wait for the last job
+ */
+static esp_err_t esp_lc3_parallel_dispatch(esp_lc3_parallel_handle_t p, int num_tasks)
+{
+    if (num_tasks == 0) {
+        return ESP_OK;
+    }
+
+    p->gen = (p->gen + 1) & 0xffff;
+    atomic_store_explicit(&p->remaining, num_tasks, memory_order_relaxed);
+    atomic_store_explicit(&p->failed, false, memory_order_relaxed);
+    atomic_store_explicit(&p->frame, (p->gen << FRAME_GEN_SHIFT) | (num_tasks << FRAME_COUNT_SHIFT), memory_order_release);
+
+    // No point waking more workers than there are jobs besides our own
+    for (int i = 0; i < p->num_started && i < num_tasks - 1; i++) {
+        esp_lc3_parallel_wake(p, i);
+    }
+
+    if (!esp_lc3_parallel_run(p)) {
+        esp_lc3_parallel_wait(p);
+    }
+
+    if (atomic_load(&p->failed)) {
+        ESP_LOGE(TAG, "Encoding error: Wrong parameters");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lc3_parallel_multi_encode(esp_lc3_parallel_handle_t handle, esp_lc3_multi_encoder_t* enc, const void* in, void* out)
+{
+    size_t sample_size = esp_lc3_sample_size(enc->format);
+
+    for (int ch = 0; ch < enc->num_channels; ch++) {
+        handle->tasks[ch] = (esp_lc3_parallel_task_t) {
+            .encoder = enc->encoders[ch],
+            .format = enc->format,
+            .pcm = (const uint8_t*)in + ch * sample_size,
+            .stride = enc->num_channels,
+            .nbytes = enc->nbytes_target,
+            .out = (uint8_t*)out + ch * enc->nbytes_target,
+        };
+    }
+    return esp_lc3_parallel_dispatch(handle, enc->num_channels);
+}
+
+esp_err_t esp_lc3_parallel_encode(esp_lc3_parallel_handle_t handle, const esp_lc3_parallel_job_t* jobs, int num_jobs)
+{
+    if (num_jobs < 0 || num_jobs > ESP_LC3_PARALLEL_JOBS_MAX) {
+        ESP_LOGE(TAG, "Unsupported number of jobs: %d", num_jobs);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (int i = 0; i < num_jobs; i++) {
+        const esp_lc3_encoder_t* enc = jobs[i].enc;
+        handle->tasks[i] = (esp_lc3_parallel_task_t) {
+            .encoder = enc->encoder,
+            .format = enc->format,
+            .pcm = jobs[i].in,
+            .stride = enc->stride,
+            .nbytes = enc->nbytes_target,
+            .out = jobs[i].out,
+        };
+    }
+    return esp_lc3_parallel_dispatch(handle, num_jobs);
+}
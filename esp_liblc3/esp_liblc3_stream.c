@@ -0,0 +1,194 @@
+/**
+ * @file esp_liblc3_stream.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "esp_liblc3_stream.h"
+#include "esp_liblc3_private.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "LC3-STREAM";
+
+esp_err_t esp_lc3_stream_encoder_init(esp_lc3_stream_encoder_t* enc, const esp_lc3_config_t* cfg,
+                                      esp_lc3_stream_encoded_cb_t cb, void* ctx)
+{
+    if (cb == NULL) {
+        ESP_LOGE(TAG, "No encoded callback");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = esp_lc3_multi_encoder_init(&enc->enc, cfg);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    enc->cb = cb;
+    enc->ctx = ctx;
+    enc->pcm_fill = 0;
+    enc->sample_size = enc->enc.num_channels * esp_lc3_sample_size(enc->enc.format);
+
+    enc->pcm = malloc(enc->enc.num_frames * enc->sample_size);
+    enc->frame = malloc(enc->enc.num_channels * enc->enc.nbytes_target);
+    if (enc->pcm == NULL || enc->frame == NULL) {
+        ESP_LOGE(TAG, "Malloc error");
+        esp_lc3_stream_encoder_deinit(enc);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+void esp_lc3_stream_encoder_deinit(esp_lc3_stream_encoder_t* enc)
+{
+    esp_lc3_multi_encoder_deinit(&enc->enc);
+    free(enc->pcm);
+    free(enc->frame);
+    enc->pcm = NULL;
+    enc->frame = NULL;
+}
+
+static esp_err_t esp_lc3_stream_encode_frame(esp_lc3_stream_encoder_t* enc, const void* pcm)
+{
+    esp_err_t ret = esp_lc3_multi_encode(&enc->enc, pcm, enc->frame);
+    if (ret == ESP_OK) {
+        enc->cb(enc->frame, enc->enc.num_channels * enc->enc.nbytes_target, enc->ctx);
+    }
+    return ret;
+}
+
+esp_err_t esp_lc3_stream_encode(esp_lc3_stream_encoder_t* enc, const void* in, int num_samples)
+{
+    const uint8_t* p = in;
+    int ns = enc->enc.num_frames;
+
+    // Complete the pending frame first
+    if (enc->pcm_fill > 0) {
+        int n = num_samples < ns - enc->pcm_fill ? num_samples : ns - enc->pcm_fill;
+        memcpy(enc->pcm + enc->pcm_fill * enc->sample_size, p, n * enc->sample_size);
+        enc->pcm_fill += n;
+        p += n * enc->sample_size;
+        num_samples -= n;
+
+        if (enc->pcm_fill < ns) {
+            return ESP_OK;
+        }
+
+        enc->pcm_fill = 0;
+        esp_err_t ret = esp_lc3_stream_encode_frame(enc, enc->pcm);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    // Contiguous frames of the chunk, without copy
+    for (; num_samples >= ns; num_samples -= ns, p += ns * enc->sample_size) {
+        esp_err_t ret = esp_lc3_stream_encode_frame(enc, p);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    memcpy(enc->pcm, p, num_samples * enc->sample_size);
+    enc->pcm_fill = num_samples;
+    return ESP_OK;
+}
+
+esp_err_t esp_lc3_stream_encoder_flush(esp_lc3_stream_encoder_t* enc)
+{
+    if (enc->pcm_fill == 0) {
+        return ESP_OK;
+    }
+
+    // All zero bits is silence in every PCM format
+    memset(enc->pcm + enc->pcm_fill * enc->sample_size, 0, (enc->enc.num_frames - enc->pcm_fill) * enc->sample_size);
+    enc->pcm_fill = 0;
+    return esp_lc3_stream_encode_frame(enc, enc->pcm);
+}
+
+esp_err_t esp_lc3_stream_decoder_init(esp_lc3_stream_decoder_t* dec, const esp_lc3_config_t* cfg,
+                                      esp_lc3_stream_fetch_cb_t cb, void* ctx)
+{
+    if (cb == NULL) {
+        ESP_LOGE(TAG, "No fetch callback");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = esp_lc3_multi_decoder_init(&dec->dec, cfg);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    dec->cb = cb;
+    dec->ctx = ctx;
+    dec->pcm_pos = dec->dec.num_frames; // nothing decoded yet
+    dec->sample_size = dec->dec.num_channels * esp_lc3_sample_size(dec->dec.format);
+
+    dec->pcm = malloc(dec->dec.num_frames * dec->sample_size);
+    dec->frame = malloc(dec->dec.num_channels * dec->dec.nbytes_target);
+    if (dec->pcm == NULL || dec->frame == NULL) {
+        ESP_LOGE(TAG, "Malloc error");
+        esp_lc3_stream_decoder_deinit(dec);
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+void esp_lc3_stream_decoder_deinit(esp_lc3_stream_decoder_t* dec)
+{
+    esp_lc3_multi_decoder_deinit(&dec->dec);
+    free(dec->pcm);
+    free(dec->frame);
+    dec->pcm = NULL;
+    dec->frame = NULL;
+}
+
+static esp_err_t esp_lc3_stream_decode_frame(esp_lc3_stream_decoder_t* dec, void* pcm)
+{
+    bool received = dec->cb(dec->frame, dec->dec.num_channels * dec->dec.nbytes_target, dec->ctx);
+    return esp_lc3_multi_decode(&dec->dec, received ? dec->frame : NULL, pcm);
+}
+
+esp_err_t esp_lc3_stream_decode(esp_lc3_stream_decoder_t* dec, void* out, int num_samples)
+{
+    uint8_t* p = out;
+    int ns = dec->dec.num_frames;
+
+    while (num_samples > 0) {
+        // Whole frames on a frame boundary, without copy
+        if (dec->pcm_pos == ns && num_samples >= ns) {
+            esp_err_t ret = esp_lc3_stream_decode_frame(dec, p);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            p += ns * dec->sample_size;
+            num_samples -= ns;
+            continue;
+        }
+
+        if (dec->pcm_pos == ns) {
+            esp_err_t ret = esp_lc3_stream_decode_frame(dec, dec->pcm);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            dec->pcm_pos = 0;
+        }
+
+        int n = num_samples < ns - dec->pcm_pos ? num_samples : ns - dec->pcm_pos;
+        memcpy(p, dec->pcm + dec->pcm_pos * dec->sample_size, n * dec->sample_size);
+        dec->pcm_pos += n;
+        p += n * dec->sample_size;
+        num_samples -= n;
+    }
+
+    return ESP_OK;
+}
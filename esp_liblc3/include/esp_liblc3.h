@@ -8,14 +8,63 @@
  * @copyright Copyright (c) 2023
  *
  */
+#pragma once
+
+#include <stdatomic.h>
+#include <stddef.h>
 
 #include "lc3.h"
 
 #include "esp_err.h"
 
+#define ESP_LC3_CHANNELS_MAX 8
+#define ESP_LC3_STATE_ALIGN 16 // per-channel state of multi-channel handles is rounded up to this
+#define ESP_LC3_POOL_SLOTS_MAX 32
+
+// Exact state size of one channel, usable in static declarations and static asserts
+#define ESP_LC3_ENCODER_SIZE(dt_us, sr_hz) sizeof(LC3_ENCODER_MEM_T(dt_us, sr_hz))
+#define ESP_LC3_DECODER_SIZE(dt_us, sr_hz) sizeof(LC3_DECODER_MEM_T(dt_us, sr_hz))
+
+#define ESP_LC3_STATE_ALIGN_UP(size) (((size) + ESP_LC3_STATE_ALIGN - 1) & ~(size_t)(ESP_LC3_STATE_ALIGN - 1))
+
+// State size of a multi-channel handle
+#define ESP_LC3_MULTI_ENCODER_SIZE(dt_us, sr_hz, num_channels) \
+    ((num_channels) * ESP_LC3_STATE_ALIGN_UP(ESP_LC3_ENCODER_SIZE(dt_us, sr_hz)))
+#define ESP_LC3_MULTI_DECODER_SIZE(dt_us, sr_hz, num_channels) \
+    ((num_channels) * ESP_LC3_STATE_ALIGN_UP(ESP_LC3_DECODER_SIZE(dt_us, sr_hz)))
+
+typedef enum {
+    ESP_LC3_MEM_DEFAULT, // malloc(), may land in PSRAM
+    ESP_LC3_MEM_INTERNAL, // internal DRAM
+    ESP_LC3_MEM_CAPS, // heap_caps_malloc() with `caps`
+    ESP_LC3_MEM_STATIC, // caller-provided `memory`, e.g. a static LC3_ENCODER_MEM_T
+    ESP_LC3_MEM_POOL, // a slot of `pool`
+} esp_lc3_mem_type_t;
+
+/**
+ * @brief Fixed-size slots reserved up front, so creating a session never fails because of fragmentation
+ */
+typedef struct {
+    const char* name;
+    uint8_t* memory;
+    size_t slot_size;
+    int num_slots;
+    bool allocated; // memory was allocated by esp_lc3_pool_init()
+    atomic_uint used; // bit n set when slot n is in use
+} esp_lc3_pool_t;
+
+typedef struct {
+    esp_lc3_mem_type_t type;
+    uint32_t caps; // ESP_LC3_MEM_CAPS, MALLOC_CAP_* flags
+    void* memory; // ESP_LC3_MEM_STATIC
+    size_t size; // ESP_LC3_MEM_STATIC, bytes at `memory`
+    esp_lc3_pool_t* pool; // ESP_LC3_MEM_POOL
+} esp_lc3_mem_config_t;
+
 typedef struct {
     uint8_t* lc3_encoder_memory;
     lc3_encoder_t encoder;
+    esp_lc3_mem_config_t mem;
     enum lc3_pcm_format format;
     int sr_hz;
     int dt_us;
@@ -27,6 +76,7 @@ typedef struct {
 typedef struct {
     uint8_t* lc3_decoder_memory;
     lc3_decoder_t decoder;
+    esp_lc3_mem_config_t mem;
     enum lc3_pcm_format format;
     int sr_hz;
     int dt_us;
@@ -35,14 +85,69 @@ typedef struct {
     int num_frames;
 } esp_lc3_decoder_t;
 
+typedef struct {
+    uint8_t* memory; // state of all channels, one allocation
+    lc3_encoder_t encoders[ESP_LC3_CHANNELS_MAX];
+    esp_lc3_mem_config_t mem;
+    enum lc3_pcm_format format;
+    int sr_hz;
+    int dt_us;
+    int nbytes_target; // per channel
+    int num_channels;
+    int num_frames;
+} esp_lc3_multi_encoder_t;
+
+typedef struct {
+    uint8_t* memory; // state of all channels, one allocation
+    lc3_decoder_t decoders[ESP_LC3_CHANNELS_MAX];
+    esp_lc3_mem_config_t mem;
+    enum lc3_pcm_format format;
+    int sr_hz;
+    int dt_us;
+    int nbytes_target; // per channel
+    int num_channels;
+    int num_frames;
+} esp_lc3_multi_decoder_t;
+
 typedef struct {
     enum lc3_pcm_format format;
     int sample_rate;
     int frame_size;
     int nbytes_target;
     int stride;
+    int num_channels; // multi-channel encoder/decoder, PCM is interleaved
+    esp_lc3_mem_config_t mem; // where the state lives, zero for malloc()
+    enum lc3_complexity complexity; // encoder profile, zero for the reference LC3_COMPLEXITY_HIGH
 } esp_lc3_config_t;
 
+/**
+ * @brief Reserve a pool of codec state slots, e.g. at boot before the heap fragments
+ *
+ * @param pool pool instance
+ * @param name pool name, for logging
+ * @param memory `num_slots` * `slot_size` bytes, NULL to allocate them from internal DRAM
+ * @param slot_size bytes per slot, e.g. ESP_LC3_ENCODER_SIZE() of the largest configuration
+ * @param num_slots number of slots, at most ESP_LC3_POOL_SLOTS_MAX
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_pool_init(esp_lc3_pool_t* pool, const char* name, void* memory, size_t slot_size, int num_slots);
+
+/**
+ * @brief Release a pool. All sessions using it must be deinitialized first.
+ *
+ * @param pool pool instance
+ */
+void esp_lc3_pool_deinit(esp_lc3_pool_t* pool);
+
+/**
+ * @brief State size of an encoder or decoder with this configuration, what the init functions will allocate
+ *
+ * @param cfg session configuration
+ * @param decoder true for the decoder size
+ * @return size_t bytes, 0 if the configuration is not supported
+ */
+size_t esp_lc3_state_size(const esp_lc3_config_t* cfg, bool decoder);
+
 /**
  * @brief Initialize encoder
  *
@@ -61,6 +166,29 @@ esp_err_t esp_lc3_encoder_init(esp_lc3_encoder_t* enc, const esp_lc3_config_t* c
  */
 esp_err_t esp_lc3_decoder_init(esp_lc3_decoder_t* dec, const esp_lc3_config_t* cfg);
 
+/**
+ * @brief Free encoder state
+ *
+ * @param enc encoder instance
+ */
+void esp_lc3_encoder_deinit(esp_lc3_encoder_t* enc);
+
+/**
+ * @brief Free decoder state
+ *
+ * @param dec decoder instance
+ */
+void esp_lc3_decoder_deinit(esp_lc3_decoder_t* dec);
+
+/**
+ * @brief Switch the complexity profile of an encoder, e.g. when the system gets loaded. Takes effect on the next frame.
+ *
+ * @param enc encoder instance
+ * @param complexity LC3_COMPLEXITY_HIGH, LC3_COMPLEXITY_MEDIUM or LC3_COMPLEXITY_LOW
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_encoder_set_complexity(esp_lc3_encoder_t* enc, enum lc3_complexity complexity);
+
 /**
  * @brief Encode PCM data
  *
@@ -80,3 +208,64 @@ esp_err_t esp_lc3_encode(esp_lc3_encoder_t* enc, const void *in, void *out);
  * @return esp_err_t
  */
 esp_err_t esp_lc3_decode(esp_lc3_decoder_t* dec, const void *in, void *out);
+
+/**
+ * @brief Initialize a multi-channel encoder. The state of all channels is one allocation.
+ *
+ * @param enc encoder instance
+ * @param cfg session configuration, `num_channels` channels of `nbytes_target` bytes each
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_multi_encoder_init(esp_lc3_multi_encoder_t* enc, const esp_lc3_config_t* cfg);
+
+/**
+ * @brief Free a multi-channel encoder
+ *
+ * @param enc encoder instance
+ */
+void esp_lc3_multi_encoder_deinit(esp_lc3_multi_encoder_t* enc);
+
+/**
+ * @brief Initialize a multi-channel decoder. The state of all channels is one allocation.
+ *
+ * @param dec decoder instance
+ * @param cfg session configuration, `num_channels` channels of `nbytes_target` bytes each
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_multi_decoder_init(esp_lc3_multi_decoder_t* dec, const esp_lc3_config_t* cfg);
+
+/**
+ * @brief Free a multi-channel decoder
+ *
+ * @param dec decoder instance
+ */
+void esp_lc3_multi_decoder_deinit(esp_lc3_multi_decoder_t* dec);
+
+/**
+ * @brief Switch the complexity profile of all channels of a multi-channel encoder
+ *
+ * @param enc encoder instance
+ * @param complexity LC3_COMPLEXITY_HIGH, LC3_COMPLEXITY_MEDIUM or LC3_COMPLEXITY_LOW
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_multi_encoder_set_complexity(esp_lc3_multi_encoder_t* enc, enum lc3_complexity complexity);
+
+/**
+ * @brief Encode one frame of all channels
+ *
+ * @param enc encoder instance
+ * @param in interleaved PCM data, `num_frames` samples per channel
+ * @param out encoded data, the frame of channel 0 followed by channel 1 and so on, `nbytes_target` each
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_multi_encode(esp_lc3_multi_encoder_t* enc, const void* in, void* out);
+
+/**
+ * @brief Decode one frame of all channels
+ *
+ * @param dec decoder instance
+ * @param in encoded data laid out as by esp_lc3_multi_encode(), NULL to run packet loss concealment
+ * @param out interleaved PCM data
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_multi_decode(esp_lc3_multi_decoder_t* dec, const void* in, void* out);
@@ -0,0 +1,56 @@
+/**
+ * @file esp_liblc3_bench.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Per-stage cycle benchmark of the LC3 encoder and decoder, reported as JSON
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "esp_err.h"
+#include "lc3.h"
+#include "bench.h"
+
+/**
+ * @brief A clip of the reference corpus, mono 16-bit PCM
+ *
+ * Fields: `name`, `pcm`, `num_samples`, and `sample_rate`, the clip being used by the configurations of
+ * this sample rate only
+ */
+typedef struct lc3_bench_clip esp_lc3_bench_clip_t;
+
+/**
+ * @brief Corpus, bitrate and encoder profile
+ *
+ * Fields: `clips` and `num_clips`, NULL for the built-in synthetic corpus, `num_frames` per built-in clip,
+ * `bitrate`, 0 for 2 bits per sample, e.g. 96 kbps at 48 kHz, and the encoder `complexity` profile
+ */
+typedef struct lc3_bench_config esp_lc3_bench_config_t;
+
+#define ESP_LC3_BENCH_DEFAULT_CONFIG() { \
+    .clips = NULL,                       \
+    .num_clips = 0,                      \
+    .num_frames = 200,                   \
+    .bitrate = 0,                        \
+    .complexity = LC3_COMPLEXITY_HIGH,   \
+}
+
+/**
+ * @brief Encode and decode the corpus with every frame duration and sample rate built in,
+ * and write the cycles per frame and the real-time factor of each stage as JSON.
+ *
+ * Needs CONFIG_LC3_BENCHMARK. The stage counters are global: no other LC3 encoding or
+ * decoding may run during the benchmark. The same JSON is written on a Linux host by the
+ * `bench` target of liblc3, counting nanoseconds.
+ *
+ * @param cfg corpus and bitrate
+ * @param out JSON output, e.g. stdout
+ * @return ESP_ERR_NOT_SUPPORTED without CONFIG_LC3_BENCHMARK
+ */
+esp_err_t esp_lc3_bench_run(const esp_lc3_bench_config_t* cfg, FILE* out);
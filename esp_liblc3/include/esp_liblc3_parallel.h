@@ -0,0 +1,78 @@
+/**
+ * @file esp_liblc3_parallel.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Parallel LC3 encoding, spreading channels or streams over worker tasks pinned to each core
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "esp_liblc3.h"
+
+#define ESP_LC3_PARALLEL_WORKERS_MAX 4
+#define ESP_LC3_PARALLEL_JOBS_MAX 16 // encoded frames per call
+
+typedef struct esp_lc3_parallel* esp_lc3_parallel_handle_t;
+
+typedef struct {
+    int num_workers; // worker tasks besides the calling task
+    int task_priority;
+    int task_core; // worker n is pinned to core (task_core + n) % number of cores, -1 for no affinity
+    int task_stack_size;
+} esp_lc3_parallel_config_t;
+
+#define ESP_LC3_PARALLEL_DEFAULT_CONFIG() { \
+    .num_workers = 1,                       \
+    .task_priority = 10,                    \
+    .task_core = 1,                         \
+    .task_stack_size = 4096,                \
+}
+
+/**
+ * @brief One frame of one stream, e.g. from a different session than the other jobs of the call
+ */
+typedef struct {
+    esp_lc3_encoder_t* enc;
+    const void* in;
+    void* out;
+} esp_lc3_parallel_job_t;
+
+/**
+ * @brief Start the worker tasks
+ *
+ * @param cfg worker configuration
+ * @param handle set to the new instance
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_parallel_create(const esp_lc3_parallel_config_t* cfg, esp_lc3_parallel_handle_t* handle);
+
+/**
+ * @brief Stop the worker tasks and free the instance
+ *
+ * @param handle instance
+ */
+void esp_lc3_parallel_delete(esp_lc3_parallel_handle_t handle);
+
+/**
+ * @brief Encode one frame of all channels. The calling task encodes channels too, and returns when all are done.
+ *
+ * @param handle instance
+ * @param enc multi-channel encoder
+ * @param in interleaved PCM data
+ * @param out encoded data, laid out as by esp_lc3_multi_encode()
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_parallel_multi_encode(esp_lc3_parallel_handle_t handle, esp_lc3_multi_encoder_t* enc, const void* in, void* out);
+
+/**
+ * @brief Encode independent frames, e.g. of different streams. Returns when all are done.
+ *
+ * @param handle instance
+ * @param jobs frames to encode, each encoder may appear once
+ * @param num_jobs number of frames, at most ESP_LC3_PARALLEL_JOBS_MAX
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_parallel_encode(esp_lc3_parallel_handle_t handle, const esp_lc3_parallel_job_t* jobs, int num_jobs);
@@ -0,0 +1,122 @@
+/**
+ * @file esp_liblc3_stream.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Streaming LC3 encoding and decoding of PCM chunks of any size, e.g. 1 ms USB audio packets
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "esp_liblc3.h"
+
+/**
+ * @brief Called once per encoded frame
+ *
+ * @param frame encoded data of all channels, laid out as by esp_lc3_multi_encode(), valid during the call
+ * @param size bytes, `num_channels` * `nbytes_target`
+ * @param ctx user context
+ */
+typedef void (*esp_lc3_stream_encoded_cb_t)(const void* frame, size_t size, void* ctx);
+
+/**
+ * @brief Called when the decoder needs the next frame
+ *
+ * @param frame fill with the encoded data of all channels, laid out as by esp_lc3_multi_encode()
+ * @param size bytes, `num_channels` * `nbytes_target`
+ * @param ctx user context
+ * @return true when `frame` was filled, false for a lost frame, concealed by PLC
+ */
+typedef bool (*esp_lc3_stream_fetch_cb_t)(void* frame, size_t size, void* ctx);
+
+typedef struct {
+    esp_lc3_multi_encoder_t enc;
+    esp_lc3_stream_encoded_cb_t cb;
+    void* ctx;
+    uint8_t* pcm; // partial frame, interleaved
+    int pcm_fill; // samples per channel in `pcm`
+    uint8_t* frame; // encoded frame of all channels
+    size_t sample_size; // bytes per sample of all channels
+} esp_lc3_stream_encoder_t;
+
+typedef struct {
+    esp_lc3_multi_decoder_t dec;
+    esp_lc3_stream_fetch_cb_t cb;
+    void* ctx;
+    uint8_t* pcm; // decoded frame, interleaved
+    int pcm_pos; // samples per channel already read from `pcm`
+    uint8_t* frame; // encoded frame of all channels
+    size_t sample_size; // bytes per sample of all channels
+} esp_lc3_stream_decoder_t;
+
+/**
+ * @brief Initialize a streaming encoder
+ *
+ * @param enc encoder instance
+ * @param cfg session configuration, mono or `num_channels` interleaved
+ * @param cb called once per encoded frame, from esp_lc3_stream_encode()
+ * @param ctx user context of `cb`
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_stream_encoder_init(esp_lc3_stream_encoder_t* enc, const esp_lc3_config_t* cfg,
+                                      esp_lc3_stream_encoded_cb_t cb, void* ctx);
+
+/**
+ * @brief Free a streaming encoder. Samples of an incomplete frame are dropped.
+ *
+ * @param enc encoder instance
+ */
+void esp_lc3_stream_encoder_deinit(esp_lc3_stream_encoder_t* enc);
+
+/**
+ * @brief Encode PCM of any length. The encoded callback runs once per frame completed by this chunk.
+ *
+ * Full frames are encoded straight from `in`, only the samples around frame boundaries are copied.
+ *
+ * @param enc encoder instance
+ * @param in interleaved PCM data
+ * @param num_samples samples per channel in `in`
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_stream_encode(esp_lc3_stream_encoder_t* enc, const void* in, int num_samples);
+
+/**
+ * @brief Complete an incomplete frame with silence and encode it, e.g. at the end of a stream
+ *
+ * @param enc encoder instance
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_stream_encoder_flush(esp_lc3_stream_encoder_t* enc);
+
+/**
+ * @brief Initialize a streaming decoder
+ *
+ * @param dec decoder instance
+ * @param cfg session configuration, mono or `num_channels` interleaved
+ * @param cb called for the next frame, from esp_lc3_stream_decode()
+ * @param ctx user context of `cb`
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_stream_decoder_init(esp_lc3_stream_decoder_t* dec, const esp_lc3_config_t* cfg,
+                                      esp_lc3_stream_fetch_cb_t cb, void* ctx);
+
+/**
+ * @brief Free a streaming decoder
+ *
+ * @param dec decoder instance
+ */
+void esp_lc3_stream_decoder_deinit(esp_lc3_stream_decoder_t* dec);
+
+/**
+ * @brief Decode PCM of any length. The fetch callback runs each time a new frame is needed.
+ *
+ * Full frames are decoded straight into `out`, only the samples around frame boundaries are copied.
+ *
+ * @param dec decoder instance
+ * @param out interleaved PCM data
+ * @param num_samples samples per channel to write to `out`
+ * @return esp_err_t
+ */
+esp_err_t esp_lc3_stream_decode(esp_lc3_stream_decoder_t* dec, void* out, int num_samples);
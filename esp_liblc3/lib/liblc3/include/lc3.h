@@ -170,6 +170,23 @@ enum lc3_pcm_format {
 };
 
 
+/**
+ * Encoder complexity
+ *   HIGH     Reference encoder
+ *   MEDIUM   No Long Term Postfilter pitch analysis,
+ *            and SNS quantization searched on the regular shapes only
+ *   LOW      In addition, no TNS analysis and no attack detection
+ *
+ * Reduced complexities still produce valid bitstreams, at lower quality.
+ */
+
+enum lc3_complexity {
+    LC3_COMPLEXITY_HIGH,
+    LC3_COMPLEXITY_MEDIUM,
+    LC3_COMPLEXITY_LOW,
+};
+
+
 /**
  * Handle
  */
@@ -254,6 +271,18 @@ unsigned lc3_encoder_size(int dt_us, int sr_hz);
 lc3_encoder_t lc3_setup_encoder(
     int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
 
+/**
+ * Set the complexity of an encoder
+ * encoder         Handle of the encoder
+ * complexity      Complexity of the following frames
+ * return          0: On success  -1: Wrong parameters
+ *
+ * An encoder is setup in `LC3_COMPLEXITY_HIGH`, and can be switched
+ * between frames.
+ */
+int lc3_encoder_set_complexity(
+    lc3_encoder_t encoder, enum lc3_complexity complexity);
+
 /**
  * Encode a frame
  * encoder         Handle of the encoder
@@ -70,6 +70,13 @@ enum lc3_srate {
 };
 
 
+/**
+ * Plan of the transform, resolved at setup
+ */
+
+struct lc3_mdct_plan;
+
+
 /**
  * Encoder state and memory
  */
@@ -102,6 +109,9 @@ typedef struct lc3_spec_analysis {
 struct lc3_encoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
+    int complexity;
+
+    const struct lc3_mdct_plan *mdct;
 
     lc3_attdet_analysis_t attdet;
     lc3_ltpf_analysis_t ltpf;
@@ -142,6 +152,8 @@ struct lc3_decoder {
     enum lc3_dt dt;
     enum lc3_srate sr, sr_pcm;
 
+    const struct lc3_mdct_plan *mdct;
+
     lc3_ltpf_synthesis_t ltpf;
     lc3_plc_state_t plc;
 
@@ -0,0 +1,296 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "bench.h"
+
+#if LC3_BENCH
+
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+
+/**
+ * Configurations, and built-in corpus
+ */
+
+static const int bench_dt_us[] = { 7500, 10000 };
+
+static const int bench_sr_hz[] = { 8000, 16000, 24000, 32000, 48000 };
+
+static const char *const bench_clip_names[] =
+    { "harmonics", "noise", "sweep", "transients" };
+
+#define BENCH_NUM_DT    (int)(sizeof(bench_dt_us) / sizeof(*bench_dt_us))
+#define BENCH_NUM_SR    (int)(sizeof(bench_sr_hz) / sizeof(*bench_sr_hz))
+#define BENCH_NUM_CLIPS \
+    (int)(sizeof(bench_clip_names) / sizeof(*bench_clip_names))
+
+
+/**
+ * Encoder, decoder and frame buffers
+ * The benchmark runs from a single thread, as the counters
+ */
+
+static lc3_encoder_mem_48k_t bench_enc_mem;
+static lc3_decoder_mem_48k_t bench_dec_mem;
+
+static int16_t bench_pcm_in[LC3_MAX_FRAME_SAMPLES];
+static int16_t bench_pcm_out[LC3_MAX_FRAME_SAMPLES];
+static uint8_t bench_frame[LC3_MAX_FRAME_BYTES];
+
+/**
+ * Ticks of the encoding and decoding, over the frames of a configuration
+ */
+struct bench_totals {
+    uint64_t encode_ticks, decode_ticks;
+    int num_frames;
+};
+
+
+/**
+ * Sample of a built-in clip
+ * clip            Index of the clip
+ * n, sr_hz        Index of the sample, and samplerate
+ * seed            Random generator state, updated
+ * return          The sample, full scale is 1
+ */
+static float synth(int clip, int n, int sr_hz, uint32_t *seed)
+{
+    const float pi2 = 6.28318531f;
+    float t = (float)n / sr_hz;
+
+    *seed = *seed * 1664525 + 1013904223;
+    float noise = (float)(int32_t)*seed / 2147483648.f;
+
+    switch (clip) {
+
+    /* Voiced-like, 140 Hz and its harmonics, exercising the LTPF */
+
+    case 0: {
+        float x = 0;
+        for (int k = 1; k <= 8; k++)
+            x += sinf(pi2 * 140 * k * t) / k;
+
+        return 0.25f * x;
+    }
+
+    case 1:
+        return 0.3f * noise;
+
+    /* Logarithmic sweep from 50 Hz to Nyquist, every 2 seconds */
+
+    case 2: {
+        float tm = fmodf(t, 2.f);
+        float k = logf(sr_hz / 2 / 50.f) / 2.f;
+        return 0.5f * sinf(pi2 * 50 * (expf(k * tm) - 1) / k);
+    }
+
+    /* Decaying noise bursts every 250 ms, exercising the attack detector */
+
+    default: {
+        float tm = fmodf(t, 0.25f);
+        return 0.8f * noise * expf(-40 * tm);
+    }
+    }
+}
+
+/**
+ * Encode and decode a clip, with a new encoder and decoder
+ * cfg             Benchmark configuration
+ * dt_us, sr_hz    Frame duration and samplerate
+ * nbytes          Size of the frames
+ * pcm             Samples of the clip, NULL for a built-in one
+ * clip            Index of the built-in clip
+ * num_frames      Count of frames
+ * totals          Ticks of encoding and decoding, accumulated
+ * return          0: Successful  -1: Encoding or decoding error
+ */
+static int run_clip(const struct lc3_bench_config *cfg,
+    int dt_us, int sr_hz, int nbytes, const int16_t *pcm, int clip,
+    int num_frames, struct bench_totals *totals)
+{
+    lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, &bench_enc_mem);
+    lc3_decoder_t dec = lc3_setup_decoder(dt_us, sr_hz, 0, &bench_dec_mem);
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+    uint32_t seed = 1;
+
+    lc3_encoder_set_complexity(enc, cfg->complexity);
+
+    for (int f = 0; f < num_frames; f++) {
+        const int16_t *in = pcm ? pcm + f * ns : bench_pcm_in;
+
+        for (int i = 0; !pcm && i < ns; i++)
+            bench_pcm_in[i] = (int16_t)(32767 *
+                synth(clip, f * ns + i, sr_hz, &seed));
+
+        uint32_t t0 = LC3_BENCH_CLOCK();
+        int enc_ret = lc3_encode(enc,
+            LC3_PCM_FORMAT_S16, in, 1, nbytes, bench_frame);
+
+        uint32_t t1 = LC3_BENCH_CLOCK();
+        int dec_ret = lc3_decode(dec,
+            bench_frame, nbytes, LC3_PCM_FORMAT_S16, bench_pcm_out, 1);
+
+        uint32_t t2 = LC3_BENCH_CLOCK();
+
+        if (enc_ret != 0 || dec_ret != 0)
+            return -1;
+
+        totals->encode_ticks += (uint32_t)(t1 - t0);
+        totals->decode_ticks += (uint32_t)(t2 - t1);
+        totals->num_frames++;
+    }
+
+    return 0;
+}
+
+/**
+ * Output the results of a stage, or the total of a codec
+ * out             Output stream
+ * ticks, n        Ticks, and count of frames
+ * ticks_rt        Ticks elapsing in a frame duration
+ */
+static void print_ticks(FILE *out, uint64_t ticks, int n, double ticks_rt)
+{
+    double per_frame = n ? (double)ticks / n : 0;
+
+    fprintf(out, "\"cycles_per_frame\": %.0f, \"rtf\": %.6f",
+        per_frame, per_frame / ticks_rt);
+}
+
+/**
+ * Output the results of a codec
+ * out             Output stream
+ * name, ticks     Name of the codec, and total ticks
+ * s0, s1          Range of the stages of the codec
+ * n, ticks_rt     Count of frames, and ticks elapsing in a frame duration
+ */
+static void print_codec(FILE *out, const char *name, uint64_t ticks,
+    int s0, int s1, int n, double ticks_rt)
+{
+    fprintf(out, "      \"%s\": {\n        ", name);
+    print_ticks(out, ticks, n, ticks_rt);
+    fprintf(out, ",\n        \"stages\": {\n");
+
+    for (int s = s0; s < s1; s++) {
+        fprintf(out, "          \"%s\": { ", lc3_bench_stage_name[s]);
+        print_ticks(out, lc3_bench.ticks[s], n, ticks_rt);
+        fprintf(out, " }%s\n", s < s1 - 1 ? "," : "");
+    }
+
+    fprintf(out, "        }\n      }");
+}
+
+/**
+ * Run and output the results of a configuration
+ * cfg             Benchmark configuration
+ * dt_us, sr_hz    Frame duration and samplerate
+ * clock_hz        Frequency of the clock
+ * out             Output stream
+ * first           True on the first configuration output
+ * return          0: Successful  -1: Encoding or decoding error
+ */
+static int run_config(const struct lc3_bench_config *cfg,
+    int dt_us, int sr_hz, unsigned long clock_hz, FILE *out, bool first)
+{
+    int bitrate = cfg->bitrate > 0 ? cfg->bitrate : 2 * sr_hz;
+    int nbytes = lc3_frame_bytes(dt_us, bitrate);
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+
+    struct bench_totals totals = { 0 };
+    int ret = 0;
+
+    memset(lc3_bench.ticks, 0, sizeof(lc3_bench.ticks));
+
+    for (int c = 0; !cfg->clips && c < BENCH_NUM_CLIPS && !ret; c++)
+        ret = run_clip(cfg, dt_us, sr_hz, nbytes,
+            NULL, c, cfg->num_frames, &totals);
+
+    for (int c = 0; cfg->clips && c < cfg->num_clips && !ret; c++) {
+        const struct lc3_bench_clip *clip = &cfg->clips[c];
+        if (clip->sample_rate == sr_hz)
+            ret = run_clip(cfg, dt_us, sr_hz, nbytes,
+                clip->pcm, 0, clip->num_samples / ns, &totals);
+    }
+
+    if (ret)
+        return ret;
+
+    /* --- Output the results --- */
+
+    double ticks_rt = (double)clock_hz * dt_us / 1000000;
+    int n = totals.num_frames;
+
+    fprintf(out, "%s    {\n", first ? "" : ",\n");
+    fprintf(out, "      \"frame_us\": %d, \"sample_rate\": %d, "
+        "\"bitrate\": %d, \"frames\": %d,\n", dt_us, sr_hz, bitrate, n);
+
+    print_codec(out, "encoder", totals.encode_ticks,
+        0, LC3_BENCH_NUM_ENCODING_STAGES, n, ticks_rt);
+    fprintf(out, ",\n");
+
+    print_codec(out, "decoder", totals.decode_ticks,
+        LC3_BENCH_NUM_ENCODING_STAGES, LC3_BENCH_NUM_STAGES, n, ticks_rt);
+    fprintf(out, "\n    }");
+
+    return 0;
+}
+
+/**
+ * Run the benchmark, and output the results as JSON
+ */
+int lc3_bench_run(const struct lc3_bench_config *cfg,
+    const char *clock, unsigned long clock_hz, FILE *out)
+{
+    bool first = true;
+
+    fprintf(out, "{\n  \"clock\": \"%s\", \"clock_hz\": %lu, "
+        "\"complexity\": %d,\n", clock, clock_hz, cfg->complexity);
+
+    fprintf(out, "  \"corpus\": [");
+
+    for (int c = 0; !cfg->clips && c < BENCH_NUM_CLIPS; c++)
+        fprintf(out, "%s\"%s\"", c ? ", " : " ", bench_clip_names[c]);
+
+    for (int c = 0; cfg->clips && c < cfg->num_clips; c++)
+        fprintf(out, "%s\"%s\"", c ? ", " : " ", cfg->clips[c].name);
+
+    fprintf(out, " ],\n  \"configurations\": [\n");
+
+    for (int i = 0; i < BENCH_NUM_DT; i++)
+        for (int j = 0; j < BENCH_NUM_SR; j++) {
+            int dt_us = bench_dt_us[i], sr_hz = bench_sr_hz[j];
+
+            /* Configurations left out of the build */
+
+            if (lc3_encoder_size(dt_us, sr_hz) == 0)
+                continue;
+
+            if (run_config(cfg, dt_us, sr_hz, clock_hz, out, first) < 0)
+                return -1;
+
+            first = false;
+        }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    return 0;
+}
+
+#endif /* LC3_BENCH */
@@ -0,0 +1,209 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Per stage cycle counting
+ *
+ * Enabled by the benchmark build (`LC3_BENCH`), and compiled out otherwise.
+ * The clock is read after each stage of the encoding and decoding,
+ * the elapsed ticks since the previous reading are accumulated to the
+ * stage. The counters are global, the benchmarked encoders and decoders
+ * shall run from a single thread.
+ */
+
+#ifndef __LC3_BENCH_H
+#define __LC3_BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <lc3.h>
+
+
+/**
+ * Benchmark build selection
+ */
+
+#ifndef LC3_BENCH
+#define LC3_BENCH 0
+#endif
+
+
+/**
+ * Stages of the encoding and decoding
+ */
+
+enum lc3_bench_stage {
+
+    /* Encoding */
+
+    LC3_BENCH_LOAD,
+    LC3_BENCH_ATTDET,
+    LC3_BENCH_LTPF_ANALYSIS,
+    LC3_BENCH_MDCT,
+    LC3_BENCH_ENERGY,           /* Including the bandwidth detection */
+    LC3_BENCH_SNS_ANALYSIS,
+    LC3_BENCH_TNS_ANALYSIS,
+    LC3_BENCH_SPEC_ANALYSIS,
+    LC3_BENCH_SIDE_ENCODING,
+    LC3_BENCH_SPEC_ENCODING,
+
+    /* Decoding */
+
+    LC3_BENCH_SIDE_DECODING,
+    LC3_BENCH_SPEC_DECODING,
+    LC3_BENCH_TNS_SYNTHESIS,
+    LC3_BENCH_SNS_SYNTHESIS,
+    LC3_BENCH_PLC,
+    LC3_BENCH_IMDCT,
+    LC3_BENCH_LTPF_SYNTHESIS,
+    LC3_BENCH_STORE,
+
+    LC3_BENCH_NUM_STAGES,
+    LC3_BENCH_NUM_ENCODING_STAGES = LC3_BENCH_SIDE_DECODING,
+};
+
+
+/**
+ * Clip of the corpus, mono 16 bits PCM
+ * name            Name of the clip, reported in the output
+ * pcm             Samples of the clip
+ * num_samples     Count of samples
+ * sample_rate     Samplerate, only the configurations of this samplerate
+ *                 run the clip
+ */
+
+struct lc3_bench_clip {
+    const char *name;
+    const int16_t *pcm;
+    int num_samples;
+    int sample_rate;
+};
+
+/**
+ * Benchmark configuration
+ * clips           Clips of the corpus, NULL for the built-in synthetic one
+ * num_clips       Count of clips
+ * num_frames      Frames run of each built-in clip
+ * bitrate         Bitrate, 0 for 2 bits per sample (96 Kbps at 48 KHz)
+ * complexity      Complexity profile of the encoder
+ */
+
+struct lc3_bench_config {
+    const struct lc3_bench_clip *clips;
+    int num_clips;
+    int num_frames;
+    int bitrate;
+    enum lc3_complexity complexity;
+};
+
+
+#if LC3_BENCH
+
+/**
+ * Clock, in CPU cycles on target, and in nanoseconds on host
+ * Can be defined by the build to another source of ticks.
+ */
+
+#ifndef LC3_BENCH_CLOCK
+
+#ifdef ESP_PLATFORM
+
+#include "esp_cpu.h"
+#define LC3_BENCH_CLOCK() ( (uint32_t)esp_cpu_get_cycle_count() )
+
+#else /* ESP_PLATFORM */
+
+#include <time.h>
+
+static inline uint32_t lc3_bench_clock_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+}
+
+#define LC3_BENCH_CLOCK() lc3_bench_clock_ns()
+
+#endif /* ESP_PLATFORM */
+
+#endif /* LC3_BENCH_CLOCK */
+
+
+/**
+ * Counters, and name of the stages
+ * t               Clock ticks of the last reading
+ * ticks           Accumulated ticks of each stage
+ */
+
+struct lc3_bench {
+    uint32_t t;
+    uint64_t ticks[LC3_BENCH_NUM_STAGES];
+};
+
+extern struct lc3_bench lc3_bench;
+
+extern const char *lc3_bench_stage_name[LC3_BENCH_NUM_STAGES];
+
+
+/**
+ * Start the counting of a frame
+ */
+static inline void lc3_bench_start(void)
+{
+    lc3_bench.t = LC3_BENCH_CLOCK();
+}
+
+/**
+ * Accumulate the ticks elapsed since the previous reading to a stage
+ * stage           Stage ending
+ */
+static inline void lc3_bench_mark(enum lc3_bench_stage stage)
+{
+    uint32_t t = LC3_BENCH_CLOCK();
+    lc3_bench.ticks[stage] += (uint32_t)(t - lc3_bench.t);
+    lc3_bench.t = t;
+}
+
+#define LC3_BENCH_START()   lc3_bench_start()
+#define LC3_BENCH_MARK(s)   lc3_bench_mark(LC3_BENCH_ ## s)
+
+
+/**
+ * Run the benchmark, and output the results as JSON
+ * cfg             Corpus, bitrate and complexity
+ * clock, clock_hz Name of the clock ticks, and their frequency
+ * out             Output stream of the JSON results
+ * return          0: Successful  -1: Encoding or decoding error
+ *
+ * The corpus is encoded and decoded with every frame duration and
+ * samplerate built in. The ticks per frame, and the real-time factor
+ * (ticks per frame over ticks elapsing in a frame duration), are reported
+ * for the encoder, the decoder, and each stage.
+ */
+int lc3_bench_run(const struct lc3_bench_config *cfg,
+    const char *clock, unsigned long clock_hz, FILE *out);
+
+#else /* LC3_BENCH */
+
+#define LC3_BENCH_START()
+#define LC3_BENCH_MARK(s)
+
+#endif /* LC3_BENCH */
+
+
+#endif /* __LC3_BENCH_H */
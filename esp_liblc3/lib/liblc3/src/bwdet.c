@@ -20,33 +20,48 @@
 
 
 /**
- * Bandwidth detector
+ * Bandwidth regions (Table 3.6)
  */
-enum lc3_bandwidth lc3_bwdet_run(
-    enum lc3_dt dt, enum lc3_srate sr, const float *e)
+
+static const struct lc3_bwdet_region bws_table[LC3_NUM_DT]
+        [LC3_NUM_BANDWIDTH-1][LC3_NUM_BANDWIDTH-1] = {
+
+    [LC3_DT_7M5] = {
+        { { 51, 63+1 } },
+        { { 45, 55+1 }, { 58, 63+1 } },
+        { { 42, 51+1 }, { 53, 58+1 }, { 60, 63+1 } },
+        { { 40, 48+1 }, { 51, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
+    },
+
+    [LC3_DT_10M] = {
+        { { 53, 63+1 } },
+        { { 47, 56+1 }, { 59, 63+1 } },
+        { { 44, 52+1 }, { 54, 59+1 }, { 60, 63+1 } },
+        { { 41, 49+1 }, { 51, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
+    },
+};
+
+/**
+ * Return the bandwidth regions
+ */
+int lc3_bwdet_get_regions(enum lc3_dt dt, enum lc3_srate sr,
+    const struct lc3_bwdet_region **regions)
 {
-    /* Bandwidth regions (Table 3.6)  */
-
-    struct region { int is : 8; int ie : 8; };
-
-    static const struct region bws_table[LC3_NUM_DT]
-            [LC3_NUM_BANDWIDTH-1][LC3_NUM_BANDWIDTH-1] = {
-
-        [LC3_DT_7M5] = {
-            { { 51, 63+1 } },
-            { { 45, 55+1 }, { 58, 63+1 } },
-            { { 42, 51+1 }, { 53, 58+1 }, { 60, 63+1 } },
-            { { 40, 48+1 }, { 51, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
-        },
-
-        [LC3_DT_10M] = {
-            { { 53, 63+1 } },
-            { { 47, 56+1 }, { 59, 63+1 } },
-            { { 44, 52+1 }, { 54, 59+1 }, { 60, 63+1 } },
-            { { 41, 49+1 }, { 51, 55+1 }, { 57, 60+1 }, { 61, 63+1 } },
-        },
-    };
+    enum lc3_bandwidth bwn = (enum lc3_bandwidth)sr;
+
+    if (bwn <= LC3_BANDWIDTH_NB)
+        return 0;
 
+    *regions = bws_table[dt][bwn-1];
+    return bwn;
+}
+
+/**
+ * Bandwidth detector, from the energy sums of the regions
+ */
+enum lc3_bandwidth lc3_bwdet_run_sums(
+    enum lc3_dt dt, enum lc3_srate sr, const float *e, const float *se)
+{
     static const int l_table[LC3_NUM_DT][LC3_NUM_BANDWIDTH-1] = {
         [LC3_DT_7M5] = { 4, 4, 3, 2 },
         [LC3_DT_10M] = { 4, 4, 3, 1 },
@@ -61,17 +76,12 @@ enum lc3_bandwidth lc3_bwdet_run(
     if (bwn <= bw0)
         return bwn;
 
-    const struct region *bwr = bws_table[dt][bwn-1];
+    const struct lc3_bwdet_region *bwr = bws_table[dt][bwn-1];
 
     for (enum lc3_bandwidth bw = bw0; bw < bwn; bw++) {
-        int i = bwr[bw].is, ie = bwr[bw].ie;
-        int n = ie - i;
-
-        float se = e[i];
-        for (i++; i < ie; i++)
-            se += e[i];
+        int n = bwr[bw].ie - bwr[bw].is;
 
-        if (se >= (10 << (bw == LC3_BANDWIDTH_NB)) * n)
+        if (se[bw] >= (10 << (bw == LC3_BANDWIDTH_NB)) * n)
             bw0 = bw + 1;
     }
 
@@ -96,6 +106,27 @@ enum lc3_bandwidth lc3_bwdet_run(
     return hold ? bw0 : bwn;
 }
 
+/**
+ * Bandwidth detector
+ */
+enum lc3_bandwidth lc3_bwdet_run(
+    enum lc3_dt dt, enum lc3_srate sr, const float *e)
+{
+    const struct lc3_bwdet_region *bwr;
+    int nr = lc3_bwdet_get_regions(dt, sr, &bwr);
+    float se[LC3_NUM_BANDWIDTH-1];
+
+    for (int r = 0; r < nr; r++) {
+        int i = bwr[r].is, ie = bwr[r].ie;
+
+        se[r] = e[i];
+        for (i++; i < ie; i++)
+            se[r] += e[i];
+    }
+
+    return lc3_bwdet_run_sums(dt, sr, e, se);
+}
+
 /**
  * Return number of bits coding the bandwidth value
  */
@@ -30,6 +30,35 @@
 #include "bits.h"
 
 
+/**
+ * Bandwidth region, range of energy bands
+ * is, ie          Index of the first band, and past the last one
+ */
+
+struct lc3_bwdet_region { int8_t is, ie; };
+
+
+/**
+ * Return the bandwidth regions
+ * dt, sr          Duration and samplerate of the frame
+ * regions         Return the regions of bandwidths NB up to below `sr`,
+ *                 in ascending and disjoint ranges of bands
+ * return          Number of regions, 0 when `regions` is left unset
+ */
+int lc3_bwdet_get_regions(enum lc3_dt dt, enum lc3_srate sr,
+    const struct lc3_bwdet_region **regions);
+
+/**
+ * Bandwidth detector, from the energy sums of the regions
+ * dt, sr          Duration and samplerate of the frame
+ * e               Energy estimation per bands
+ * se              Sum of the energy bands of each region, accumulated
+ *                 from the first band to the last
+ * return          Return detected bandwitdth
+ */
+enum lc3_bandwidth lc3_bwdet_run_sums(
+    enum lc3_dt dt, enum lc3_srate sr, const float *e, const float *se);
+
 /**
  * Bandwidth detector (cf. 3.3.5)
  * dt, sr          Duration and samplerate of the frame
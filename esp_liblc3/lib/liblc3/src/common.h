@@ -53,6 +53,64 @@
 #endif /* __clang__ */
 
 
+/**
+ * Hot table attribute
+ * Placement of the tables read by the per-frame transforms.
+ * Can be defined by the build to a memory faster than the constant one.
+ */
+
+#ifndef LC3_HOT_TABLE
+#define LC3_HOT_TABLE
+#endif
+
+
+/**
+ * Frame durations and samplerates built in
+ * The tables of a configuration are left out when its frame duration
+ * or samplerate is disabled, and it's then rejected by the setup.
+ */
+
+#ifndef LC3_CONFIG_DT_7M5
+#define LC3_CONFIG_DT_7M5    1
+#endif
+
+#ifndef LC3_CONFIG_DT_10M
+#define LC3_CONFIG_DT_10M    1
+#endif
+
+#ifndef LC3_CONFIG_SRATE_8K
+#define LC3_CONFIG_SRATE_8K  1
+#endif
+
+#ifndef LC3_CONFIG_SRATE_16K
+#define LC3_CONFIG_SRATE_16K 1
+#endif
+
+#ifndef LC3_CONFIG_SRATE_24K
+#define LC3_CONFIG_SRATE_24K 1
+#endif
+
+#ifndef LC3_CONFIG_SRATE_32K
+#define LC3_CONFIG_SRATE_32K 1
+#endif
+
+#ifndef LC3_CONFIG_SRATE_48K
+#define LC3_CONFIG_SRATE_48K 1
+#endif
+
+#define LC3_CONFIG_7M5_8K  ( LC3_CONFIG_DT_7M5 && LC3_CONFIG_SRATE_8K  )
+#define LC3_CONFIG_7M5_16K ( LC3_CONFIG_DT_7M5 && LC3_CONFIG_SRATE_16K )
+#define LC3_CONFIG_7M5_24K ( LC3_CONFIG_DT_7M5 && LC3_CONFIG_SRATE_24K )
+#define LC3_CONFIG_7M5_32K ( LC3_CONFIG_DT_7M5 && LC3_CONFIG_SRATE_32K )
+#define LC3_CONFIG_7M5_48K ( LC3_CONFIG_DT_7M5 && LC3_CONFIG_SRATE_48K )
+
+#define LC3_CONFIG_10M_8K  ( LC3_CONFIG_DT_10M && LC3_CONFIG_SRATE_8K  )
+#define LC3_CONFIG_10M_16K ( LC3_CONFIG_DT_10M && LC3_CONFIG_SRATE_16K )
+#define LC3_CONFIG_10M_24K ( LC3_CONFIG_DT_10M && LC3_CONFIG_SRATE_24K )
+#define LC3_CONFIG_10M_32K ( LC3_CONFIG_DT_10M && LC3_CONFIG_SRATE_32K )
+#define LC3_CONFIG_10M_48K ( LC3_CONFIG_DT_10M && LC3_CONFIG_SRATE_48K )
+
+
 /**
  * Macros
  * MIN/MAX  Minimum and maximum between 2 values
@@ -17,14 +17,22 @@
  ******************************************************************************/
 
 #include "energy.h"
+#include "bwdet.h"
 #include "tables.h"
 
 
 /**
- * Energy estimation per band
+ * Energy estimation per band, and sums of the bandwidth regions
+ * dt, sr          Duration and samplerate of the frame
+ * x               Input MDCT coefficient
+ * e               Energy estimation per bands
+ * bwr, nr         Bandwidth regions, and number of regions (0 for none)
+ * se              Output sum of the energy bands of each region
+ * return          True when high energy detected near Nyquist frequency
  */
-bool lc3_energy_compute(
-    enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e)
+LC3_HOT static inline bool compute(
+    enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e,
+    const struct lc3_bwdet_region *bwr, int nr, float *se)
 {
     static const int n1_table[LC3_NUM_DT][LC3_NUM_SRATE] = {
         [LC3_DT_7M5] = { 56, 34, 27, 24, 22 },
@@ -43,11 +51,17 @@ bool lc3_energy_compute(
     }
 
     /* Mean the square of coefficients within each band,
-     * note that 7.5ms 8KHz frame has more bands than samples */
+     * note that 7.5ms 8KHz frame has more bands than samples.
+     * The regions lay above the first bands, and are accumulated
+     * band after band, as the energies are computed. */
 
     int nb = LC3_MIN(LC3_NUM_BANDS, LC3_NS(dt, sr));
     int iband_h = nb - 2*(2 - dt);
     const int *lim = lc3_band_lim[dt][sr];
+    int ir = 0;
+
+    for (int r = 0; r < nr; r++)
+        se[r] = 0;
 
     for (int i = lim[iband]; iband < nb; iband++) {
         int ie = lim[iband+1];
@@ -58,7 +72,14 @@ bool lc3_energy_compute(
             sx2 += x[i] * x[i];
 
         *e = sx2 / n;
-        e_sum[iband >= iband_h] += *(e++);
+        e_sum[iband >= iband_h] += *e;
+
+        if (ir < nr && iband >= bwr[ir].is) {
+            se[ir] += *e;
+            ir += iband + 1 >= bwr[ir].ie;
+        }
+
+        e++;
     }
 
     for (; iband < LC3_NUM_BANDS; iband++)
@@ -68,3 +89,28 @@ bool lc3_energy_compute(
 
     return e_sum[1] > 30 * e_sum[0];
 }
+
+/**
+ * Energy estimation per band
+ */
+bool lc3_energy_compute(
+    enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e)
+{
+    return compute(dt, sr, x, e, NULL, 0, NULL);
+}
+
+/**
+ * Energy estimation per band, and bandwidth detection
+ */
+bool lc3_energy_compute_bwdet(enum lc3_dt dt, enum lc3_srate sr,
+    const float *x, float *e, enum lc3_bandwidth *bw)
+{
+    const struct lc3_bwdet_region *bwr = NULL;
+    int nr = lc3_bwdet_get_regions(dt, sr, &bwr);
+    float se[LC3_NUM_BANDWIDTH-1];
+
+    bool nn_flag = compute(dt, sr, x, e, bwr, nr, se);
+
+    *bw = lc3_bwdet_run_sums(dt, sr, e, se);
+    return nn_flag;
+}
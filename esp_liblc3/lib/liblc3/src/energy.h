@@ -40,4 +40,16 @@ bool lc3_energy_compute(
     enum lc3_dt dt, enum lc3_srate sr, const float *x, float *e);
 
 
+/**
+ * Energy estimation per band, and bandwidth detection in the same pass
+ * dt, sr          Duration and samplerate of the frame
+ * x               Input MDCT coefficient
+ * e               Energy estimation per bands
+ * bw              Return the detected bandwidth, as `lc3_bwdet_run()`
+ * return          True when high energy detected near Nyquist frequency
+ */
+bool lc3_energy_compute_bwdet(enum lc3_dt dt, enum lc3_srate sr,
+    const float *x, float *e, enum lc3_bandwidth *bw);
+
+
 #endif /* __LC3_ENERGY_H */
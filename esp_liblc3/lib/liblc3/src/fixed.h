@@ -0,0 +1,282 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Fixed point arithmetic
+ *
+ * Used by the fixed point build (`LC3_FIXED_POINT`), for targets without
+ * floating point unit. The conversions from and to float work on the
+ * binary representation, and do not rely on the emulated float arithmetic.
+ */
+
+#ifndef __LC3_FIXED_H
+#define __LC3_FIXED_H
+
+#include <stdint.h>
+
+
+/**
+ * Fixed point build selection
+ */
+
+#ifndef LC3_FIXED_POINT
+#define LC3_FIXED_POINT 0
+#endif
+
+
+/**
+ * Fixed point number, and complex number
+ * The transform buffers share memory with float ones,
+ * accesses are declared as possibly aliasing any type.
+ */
+
+typedef int32_t __attribute__((may_alias)) lc3_fixed_t;
+
+struct lc3_complex_q31
+{
+    lc3_fixed_t re, im;
+};
+
+
+/**
+ * Saturation bound of converted values
+ * Leaves a guard bit, so that 2 saturated values can be added
+ */
+
+#define LC3_FIXED_MAX  ( (1 << 30) - 1 )
+
+
+/**
+ * Multiply, keeping the high part of the product
+ * a, b            Operands
+ * return          `a * b / 2^32`
+ *
+ * Compiles to a single `mulh` on RV32IM, `mulsh` on Xtensa
+ */
+static inline int32_t lc3_mulh(int32_t a, int32_t b)
+{
+    return ((int64_t)a * b) >> 32;
+}
+
+/**
+ * Arithmetic shift, saturating on the left
+ * x               Value, `|x|` lower or equal to LC3_FIXED_MAX
+ * s               Shift on the left when positive, on the right otherwise
+ * return          `x * 2^s`, saturated to LC3_FIXED_MAX
+ */
+static inline int32_t lc3_fixed_shl(int32_t x, int s)
+{
+    if (s < 0)
+        return x >> (s > -31 ? -s : 31);
+
+    int32_t m = s < 30 ? LC3_FIXED_MAX >> s : 0;
+    return x > m ? LC3_FIXED_MAX : x < -m ? -LC3_FIXED_MAX : x * (1 << s);
+}
+
+/**
+ * Count the number of leading zero bits
+ * x               Value, not null
+ */
+static inline int lc3_clz32(uint32_t x)
+{
+    return __builtin_clz(x);
+}
+
+/**
+ * Exponent of the largest magnitude of float values
+ * x, n            Values, and count
+ * return          Exponent `e` of the largest magnitude `m`,
+ *                 such that `2^e <= m < 2^(e+1)`, -127 when all null
+ *
+ * The magnitudes of floats are ordered as their binary representation,
+ * without sign, considered as integers.
+ */
+static inline int lc3_float_max_exp(const float *x, int n)
+{
+    uint32_t m = 0;
+
+    for (int i = 0; i < n; i++) {
+        union { float f; uint32_t u; } v = { .f = x[i] };
+        m = v.u << 1 > m ? v.u << 1 : m;
+    }
+
+    return (int)(m >> 24) - 127;
+}
+
+/**
+ * Exponent of conversion of float values, in a range
+ * x, n            Values, and count
+ * b               Bound of the converted magnitudes, as a power of 2
+ * return          Exponent `e` such that `|x * 2^e| < 2^b`
+ *
+ * The exponent is limited to 100, so that converted values, not null,
+ * remain in the range of normalized floats when converted back.
+ */
+static inline int lc3_fixed_exp(const float *x, int n, int b)
+{
+    int e = b - 1 - lc3_float_max_exp(x, n);
+    return e < 100 ? e : 100;
+}
+
+/**
+ * Conversion from float
+ * x               Value
+ * e               Exponent of the fixed point representation
+ * return          `x * 2^e`, truncated and saturated to LC3_FIXED_MAX
+ *
+ * Denormals are flushed to 0, infinites and NaN are saturated
+ */
+static inline int32_t lc3_fixed_from_float(float x, int e)
+{
+    union { float f; uint32_t u; } v = { .f = x };
+
+    int s = (int)((v.u >> 23) & 0xff) - (127 + 23) + e;
+    int32_t m = (v.u & 0x7fffff) | 0x800000;
+
+    if ((v.u & 0x7f800000) == 0)
+        return 0;
+
+    m = s > 6 ? LC3_FIXED_MAX :
+        s >= 0 ? m << s : s > -24 ? m >> -s : 0;
+
+    return v.u >> 31 ? -m : m;
+}
+
+/**
+ * Conversion to float
+ * x               Value
+ * e               Exponent of the fixed point representation
+ * return          `x / 2^e`, rounded to nearest
+ *
+ * The result shall be in the range of normalized floats
+ */
+static inline float lc3_fixed_to_float(int32_t x, int e)
+{
+    if (x == 0)
+        return 0;
+
+    uint32_t s = x < 0 ? 1u << 31 : 0;
+    uint32_t m = x < 0 ? -(uint32_t)x : (uint32_t)x;
+
+    int n = lc3_clz32(m);
+    m = (((m << n) >> 7) + 1) >> 1;
+
+    /* The implicit leading bit of the mantissa `m` is added to the
+     * exponent, as well as the carry of the rounding */
+
+    union { uint32_t u; float f; } v = {
+        .u = s | (((uint32_t)(127 + 30 - n - e) << 23) + m) };
+
+    return v.f;
+}
+
+/**
+ * Multiplication of floats
+ * x, y            Operands
+ * return          `x * y`, rounded to nearest
+ *
+ * Denormals and underflows are flushed to 0, the product shall not
+ * overflow. Works on the binary representation, as the conversions.
+ */
+static inline float lc3_float_mul(float x, float y)
+{
+    union { float f; uint32_t u; } a = { .f = x }, b = { .f = y };
+
+    uint32_t s = (a.u ^ b.u) & (1u << 31);
+    int e = (int)((a.u >> 23) & 0xff) + (int)((b.u >> 23) & 0xff) - 127;
+
+    if ((a.u & 0x7f800000) == 0 || (b.u & 0x7f800000) == 0)
+        return 0;
+
+    uint64_t m = (uint64_t)((a.u & 0x7fffff) | 0x800000) *
+                           ((b.u & 0x7fffff) | 0x800000);
+
+    /* The product of the mantissas is in the range [2^46, 2^48[,
+     * the 24 bits result is rounded from 25 bits of the product */
+
+    int n = (int)(m >> 47);
+    uint32_t q = ((uint32_t)(m >> (22 + n)) + 1) >> 1;
+
+    if ((e += n) <= 0)
+        return 0;
+
+    union { uint32_t u; float f; } v = {
+        .u = s | (((uint32_t)(e - 1) << 23) + q) };
+
+    return v.f;
+}
+
+/**
+ * Base 2 logarithm
+ * x               Value, not null
+ * return          `log2(x)`, in fixed Q24
+ *
+ * The approximation error is lower than 2e-5
+ */
+static inline int32_t lc3_fixed_log2(uint32_t x)
+{
+    static const int32_t c[] = {
+        1548299027, -761997644, 448401120, -210758424, 49813200 };
+
+    int n = lc3_clz32(x);
+    int32_t f = ((x << n) >> 1) - (1 << 30);
+
+    /* Polynomial approximation of `log2(1 + f)`,
+     * Horner evaluation in Q30, each product in Q28 is rescaled */
+
+    int32_t p = c[4];
+    p = c[3] + lc3_mulh(p, f) * 4;
+    p = c[2] + lc3_mulh(p, f) * 4;
+    p = c[1] + lc3_mulh(p, f) * 4;
+    p = c[0] + lc3_mulh(p, f) * 4;
+    p = lc3_mulh(p, f) * 4;
+
+    return ((31 - n) << 24) + (p >> 6);
+}
+
+/**
+ * Base 2 exponentiation
+ * x               Value, in fixed Q24
+ * e               Return the exponent of the result
+ * return          Mantissa `m` in the range [2^30, 2^31[,
+ *                 such that `2^x = m / 2^e`
+ *
+ * The relative approximation error is lower than 4e-6
+ */
+static inline int32_t lc3_fixed_exp2(int32_t x, int *e)
+{
+    static const int32_t c[] = {
+        744151297, 259072136, 56096056, 14416077 };
+
+    int32_t f = (x & 0xffffff) << 6;
+
+    /* Polynomial approximation of `2^f - 1`,
+     * Horner evaluation in Q30, each product in Q28 is rescaled */
+
+    int32_t p = c[3];
+    p = c[2] + lc3_mulh(p, f) * 4;
+    p = c[1] + lc3_mulh(p, f) * 4;
+    p = c[0] + lc3_mulh(p, f) * 4;
+    p = lc3_mulh(p, f) * 4;
+
+    *e = 30 - (x >> 24);
+    return (1 << 30) + (p < (1 << 30) ? p : (1 << 30) - 1);
+}
+
+
+#endif /* __LC3_FIXED_H */
@@ -31,6 +31,8 @@
 #include "spec.h"
 #include "plc.h"
 
+#include "bench.h"
+
 
 /**
  * Frame side data
@@ -50,27 +52,60 @@ struct side_data {
  *  General
  * -------------------------------------------------------------------------- */
 
+#if LC3_BENCH
+
+struct lc3_bench lc3_bench;
+
+const char *lc3_bench_stage_name[LC3_BENCH_NUM_STAGES] = {
+    [LC3_BENCH_LOAD          ] = "load",
+    [LC3_BENCH_ATTDET        ] = "attdet",
+    [LC3_BENCH_LTPF_ANALYSIS ] = "ltpf_analysis",
+    [LC3_BENCH_MDCT          ] = "mdct",
+    [LC3_BENCH_ENERGY        ] = "energy_bwdet",
+    [LC3_BENCH_SNS_ANALYSIS  ] = "sns_analysis",
+    [LC3_BENCH_TNS_ANALYSIS  ] = "tns_analysis",
+    [LC3_BENCH_SPEC_ANALYSIS ] = "spec_analysis",
+    [LC3_BENCH_SIDE_ENCODING ] = "side_encoding",
+    [LC3_BENCH_SPEC_ENCODING ] = "spec_encoding",
+    [LC3_BENCH_SIDE_DECODING ] = "side_decoding",
+    [LC3_BENCH_SPEC_DECODING ] = "spec_decoding",
+    [LC3_BENCH_TNS_SYNTHESIS ] = "tns_synthesis",
+    [LC3_BENCH_SNS_SYNTHESIS ] = "sns_synthesis",
+    [LC3_BENCH_PLC           ] = "plc",
+    [LC3_BENCH_IMDCT         ] = "imdct",
+    [LC3_BENCH_LTPF_SYNTHESIS] = "ltpf_synthesis",
+    [LC3_BENCH_STORE         ] = "store",
+};
+
+#endif /* LC3_BENCH */
+
 /**
  * Resolve frame duration in us
  * us              Frame duration in us
  * return          Frame duration identifier, or LC3_NUM_DT
+ *
+ * Frame durations left out of the build are resolved as LC3_NUM_DT
  */
 static enum lc3_dt resolve_dt(int us)
 {
-    return us ==  7500 ? LC3_DT_7M5 :
-           us == 10000 ? LC3_DT_10M : LC3_NUM_DT;
+    return us ==  7500 && LC3_CONFIG_DT_7M5 ? LC3_DT_7M5 :
+           us == 10000 && LC3_CONFIG_DT_10M ? LC3_DT_10M : LC3_NUM_DT;
 }
 
 /**
  * Resolve samplerate in Hz
  * hz              Samplerate in Hz
  * return          Sample rate identifier, or LC3_NUM_SRATE
+ *
+ * Samplerates left out of the build are resolved as LC3_NUM_SRATE
  */
 static enum lc3_srate resolve_sr(int hz)
 {
-    return hz ==  8000 ? LC3_SRATE_8K  : hz == 16000 ? LC3_SRATE_16K :
-           hz == 24000 ? LC3_SRATE_24K : hz == 32000 ? LC3_SRATE_32K :
-           hz == 48000 ? LC3_SRATE_48K : LC3_NUM_SRATE;
+    return hz ==  8000 && LC3_CONFIG_SRATE_8K  ? LC3_SRATE_8K  :
+           hz == 16000 && LC3_CONFIG_SRATE_16K ? LC3_SRATE_16K :
+           hz == 24000 && LC3_CONFIG_SRATE_24K ? LC3_SRATE_24K :
+           hz == 32000 && LC3_CONFIG_SRATE_32K ? LC3_SRATE_32K :
+           hz == 48000 && LC3_CONFIG_SRATE_48K ? LC3_SRATE_48K : LC3_NUM_SRATE;
 }
 
 /**
@@ -258,34 +293,47 @@ static void analyze(struct lc3_encoder *encoder,
     float *xd = encoder->x + encoder->xd_off;
     float *xf = xs;
 
+    bool medium = encoder->complexity >= LC3_COMPLEXITY_MEDIUM;
+    bool low = encoder->complexity >= LC3_COMPLEXITY_LOW;
+
     /* --- Temporal --- */
 
-    bool att = lc3_attdet_run(dt, sr_pcm, nbytes, &encoder->attdet, xt);
+    bool att = !low &&
+        lc3_attdet_run(dt, sr_pcm, nbytes, &encoder->attdet, xt);
+    LC3_BENCH_MARK(ATTDET);
 
-    side->pitch_present =
+    side->pitch_present = medium ?
+        lc3_ltpf_analyse_skip(&encoder->ltpf, &side->ltpf) :
         lc3_ltpf_analyse(dt, sr_pcm, &encoder->ltpf, xt, &side->ltpf);
 
     memmove(xt - nt, xt + (ns-nt), nt * sizeof(*xt));
+    LC3_BENCH_MARK(LTPF_ANALYSIS);
 
     /* --- Spectral --- */
 
     float e[LC3_NUM_BANDS];
 
-    lc3_mdct_forward(dt, sr_pcm, sr, xs, xd, xf);
+    lc3_mdct_forward_plan(encoder->mdct, sr, xs, xd, xf);
+    LC3_BENCH_MARK(MDCT);
 
-    bool nn_flag = lc3_energy_compute(dt, sr, xf, e);
+    bool nn_flag = lc3_energy_compute_bwdet(dt, sr, xf, e, &side->bw);
     if (nn_flag)
         lc3_ltpf_disable(&side->ltpf);
+    LC3_BENCH_MARK(ENERGY);
 
-    side->bw = lc3_bwdet_run(dt, sr, e);
-
-    lc3_sns_analyze(dt, sr, e, att, &side->sns, xf, xf);
+    lc3_sns_analyze(dt, sr, e, att, medium, &side->sns, xf, xf);
+    LC3_BENCH_MARK(SNS_ANALYSIS);
 
-    lc3_tns_analyze(dt, side->bw, nn_flag, nbytes, &side->tns, xf);
+    if (low)
+        lc3_tns_analyze_skip(dt, side->bw, nbytes, &side->tns);
+    else
+        lc3_tns_analyze(dt, side->bw, nn_flag, nbytes, &side->tns, xf);
+    LC3_BENCH_MARK(TNS_ANALYSIS);
 
     lc3_spec_analyze(dt, sr,
         nbytes, side->pitch_present, &side->tns,
         &encoder->spec, xf, xq, &side->spec);
+    LC3_BENCH_MARK(SPEC_ANALYSIS);
 }
 
 /**
@@ -319,11 +367,13 @@ static void encode(struct lc3_encoder *encoder,
 
     if (side->pitch_present)
         lc3_ltpf_put_data(&bits, &side->ltpf);
+    LC3_BENCH_MARK(SIDE_ENCODING);
 
     lc3_spec_encode(&bits,
         dt, sr, bw, nbytes, xq, &side->spec, xf);
 
     lc3_flush_bits(&bits);
+    LC3_BENCH_MARK(SPEC_ENCODING);
 }
 
 /**
@@ -362,6 +412,7 @@ struct lc3_encoder *lc3_setup_encoder(
     *encoder = (struct lc3_encoder){
         .dt = dt, .sr = sr,
         .sr_pcm = sr_pcm,
+        .mdct = lc3_mdct_get_plan(dt, sr_pcm),
 
         .xt_off = nt,
         .xs_off = (nt + ns) / 2,
@@ -374,6 +425,20 @@ struct lc3_encoder *lc3_setup_encoder(
     return encoder;
 }
 
+/**
+ * Set the complexity of an encoder
+ */
+int lc3_encoder_set_complexity(
+    struct lc3_encoder *encoder, enum lc3_complexity complexity)
+{
+    if (!encoder || (unsigned)complexity > LC3_COMPLEXITY_LOW)
+        return -1;
+
+    encoder->complexity = complexity;
+
+    return 0;
+}
+
 /**
  * Encode a frame
  */
@@ -398,7 +463,10 @@ int lc3_encode(struct lc3_encoder *encoder, enum lc3_pcm_format fmt,
     struct side_data side;
     uint16_t xq[LC3_MAX_NE];
 
+    LC3_BENCH_START();
+
     load[fmt](encoder, pcm, stride);
+    LC3_BENCH_MARK(LOAD);
 
     analyze(encoder, nbytes, &side, xq);
 
@@ -543,6 +611,7 @@ static int decode(struct lc3_decoder *decoder,
 
     if (side->pitch_present)
         lc3_ltpf_get_data(&bits, &side->ltpf);
+    LC3_BENCH_MARK(SIDE_DECODING);
 
     if ((ret = lc3_spec_decode(&bits, dt, sr,
                     side->bw, nbytes, &side->spec, xf)) < 0)
@@ -582,21 +651,27 @@ static void synthesize(struct lc3_decoder *decoder,
         lc3_plc_suspend(&decoder->plc);
 
         lc3_tns_synthesize(dt, bw, &side->tns, xf);
+        LC3_BENCH_MARK(TNS_SYNTHESIS);
 
         lc3_sns_synthesize(dt, sr, &side->sns, xf, xg);
+        LC3_BENCH_MARK(SNS_SYNTHESIS);
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xg, xd, xs);
+        lc3_mdct_inverse_plan(decoder->mdct, sr, xg, xd, xs);
 
     } else {
         lc3_plc_synthesize(dt, sr, &decoder->plc, xg, xf);
 
         memset(xf + ne, 0, (ns - ne) * sizeof(float));
+        LC3_BENCH_MARK(PLC);
 
-        lc3_mdct_inverse(dt, sr_pcm, sr, xf, xd, xs);
+        lc3_mdct_inverse_plan(decoder->mdct, sr, xf, xd, xs);
     }
 
+    LC3_BENCH_MARK(IMDCT);
+
     lc3_ltpf_synthesize(dt, sr_pcm, nbytes, &decoder->ltpf,
         side && side->pitch_present ? &side->ltpf : NULL, xh, xs);
+    LC3_BENCH_MARK(LTPF_SYNTHESIS);
 }
 
 /**
@@ -651,6 +726,7 @@ struct lc3_decoder *lc3_setup_decoder(
     *decoder = (struct lc3_decoder){
         .dt = dt, .sr = sr,
         .sr_pcm = sr_pcm,
+        .mdct = lc3_mdct_get_plan(dt, sr_pcm),
 
         .xh_off = 0,
         .xs_off = nh - ns,
@@ -692,13 +768,17 @@ int lc3_decode(struct lc3_decoder *decoder, const void *in, int nbytes,
 
     struct side_data side;
 
+    LC3_BENCH_START();
+
     int ret = !in || (decode(decoder, in, nbytes, &side) < 0);
+    LC3_BENCH_MARK(SPEC_DECODING);
 
     synthesize(decoder, ret ? NULL : &side, nbytes);
 
     store[fmt](decoder, pcm, stride);
 
     complete(decoder);
+    LC3_BENCH_MARK(STORE);
 
     return ret;
 }
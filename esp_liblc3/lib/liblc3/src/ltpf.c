@@ -21,6 +21,8 @@
 
 #include "ltpf_neon.h"
 #include "ltpf_arm.h"
+#include "ltpf_xtensa.h"
+#include "ltpf_fixed.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -30,11 +32,12 @@
 /**
  * Resampling coefficients
  * The coefficients, in fixed Q15, are reordered by phase for each source
- * samplerate (coefficient matrix transposed)
+ * samplerate (coefficient matrix transposed). The phases are aligned
+ * on 32 bits, for dual 16 bits loads.
  */
 
 #ifndef resample_8k_12k8
-static const int16_t h_8k_12k8_q15[8*10] = {
+static const int16_t alignas(int32_t) h_8k_12k8_q15[8*10] = {
       214,   417, -1052, -4529, 26233, -4529, -1052,   417,   214,     0,
       180,     0, -1522, -2427, 24506, -5289,     0,   763,   156,   -28,
        92,  -323, -1361,     0, 19741, -3885,  1317,   861,     0,   -61,
@@ -47,7 +50,7 @@ static const int16_t h_8k_12k8_q15[8*10] = {
 #endif /* resample_8k_12k8 */
 
 #ifndef resample_16k_12k8
-static const int16_t h_16k_12k8_q15[4*20] = {
+static const int16_t alignas(int32_t) h_16k_12k8_q15[4*20] = {
       -61,   214,  -398,   417,     0, -1052,  2686, -4529,  5997, 26233,
      5997, -4529,  2686, -1052,     0,   417,  -398,   214,   -61,     0,
 
@@ -63,7 +66,7 @@ static const int16_t h_16k_12k8_q15[4*20] = {
 #endif /* resample_16k_12k8 */
 
 #ifndef resample_32k_12k8
-static const int16_t h_32k_12k8_q15[2*40] = {
+static const int16_t alignas(int32_t) h_32k_12k8_q15[2*40] = {
       -30,   -31,    46,   107,     0,  -199,  -162,   209,   430,     0,
      -681,  -526,   658,  1343,     0, -2264, -1943,  2999,  9871, 13116,
      9871,  2999, -1943, -2264,     0,  1343,   658,  -526,  -681,     0,
@@ -77,7 +80,7 @@ static const int16_t h_32k_12k8_q15[2*40] = {
 #endif /* resample_32k_12k8 */
 
 #ifndef resample_24k_12k8
-static const int16_t h_24k_12k8_q15[8*30] = {
+static const int16_t alignas(int32_t) h_24k_12k8_q15[8*30] = {
       -50,    19,   143,   -93,  -290,   278,   485,  -658,  -701,  1396,
       901, -3019, -1042, 10276, 17488, 10276, -1042, -3019,   901,  1396,
      -701,  -658,   485,   278,  -290,   -93,   143,    19,   -50,     0,
@@ -113,7 +116,7 @@ static const int16_t h_24k_12k8_q15[8*30] = {
 #endif /* resample_24k_12k8 */
 
 #ifndef resample_48k_12k8
-static const int16_t h_48k_12k8_q15[4*60] = {
+static const int16_t alignas(int32_t) h_48k_12k8_q15[4*60] = {
       -13,   -25,   -20,    10,    51,    71,    38,   -47,  -133,  -145,
       -42,   139,   277,   242,     0,  -329,  -511,  -351,   144,   698,
       895,   450,  -535, -1510, -1697,  -521,  1999,  5138,  7737,  8744,
@@ -178,8 +181,8 @@ LC3_HOT static inline int32_t filter_hp50(
  * The number of previous samples `d` accessed on `x` is :
  *   d: { 10, 20, 40 } - 1 for resampling factors 8, 4 and 2.
  */
-#if !defined(resample_8k_12k8) || !defined(resample_16k_12k8) \
-    || !defined(resample_32k_12k8)
+#if !defined(resample_x64k_12k8) && (!defined(resample_8k_12k8) \
+    || !defined(resample_16k_12k8) || !defined(resample_32k_12k8))
 LC3_HOT static inline void resample_x64k_12k8(const int p, const int16_t *h,
     struct lc3_ltpf_hp50_state *hp50, const int16_t *x, int16_t *y, int n)
 {
@@ -223,7 +226,8 @@ LC3_HOT static inline void resample_x64k_12k8(const int p, const int16_t *h,
  * The number of previous samples `d` accessed on `x` is :
  *   d: { 30, 60 } - 1 for resampling factors 8 and 4.
  */
-#if !defined(resample_24k_12k8) || !defined(resample_48k_12k8)
+#if !defined(resample_x192k_12k8) && (!defined(resample_24k_12k8) \
+    || !defined(resample_48k_12k8))
 LC3_HOT static inline void resample_x192k_12k8(const int p, const int16_t *h,
     struct lc3_ltpf_hp50_state *hp50, const int16_t *x, int16_t *y, int n)
 {
@@ -680,6 +684,25 @@ bool lc3_ltpf_analyse(
      return pitch_present;
 }
 
+/**
+ * LTPF analysis skipped
+ */
+bool lc3_ltpf_analyse_skip(
+    struct lc3_ltpf_analysis *ltpf, struct lc3_ltpf_data *data)
+{
+    /* --- The activation restarts from no pitch ---
+     * The history of resampled signal is left out of date, and
+     * catches up in the first frames analysed again */
+
+    data->active = false;
+
+    ltpf->active = false;
+    ltpf->pitch = 0;
+    ltpf->nc[1] = ltpf->nc[0] = 0;
+
+    return false;
+}
+
 
 /* ----------------------------------------------------------------------------
  *  Synthesis
@@ -705,6 +728,7 @@ bool lc3_ltpf_analyse(
  * c, w            Coefficients `den` then `num`, and width of filter
  * fade            Fading mode of filter  -1: Out  1: In  0: None
  */
+#ifndef synthesize_template
 LC3_HOT static inline void synthesize_template(
     const float *xh, int nh, int lag,
     const float *x0, float *x, int n,
@@ -755,6 +779,7 @@ LC3_HOT static inline void synthesize_template(
             u[j] = 0;
         }
 }
+#endif /* synthesize_template */
 
 /**
  * Synthesis filter for each samplerates (width of filter)
@@ -60,6 +60,14 @@ typedef struct lc3_ltpf_data {
 bool lc3_ltpf_analyse(enum lc3_dt dt, enum lc3_srate sr,
     lc3_ltpf_analysis_t *ltpf, const int16_t *x, lc3_ltpf_data_t *data);
 
+/**
+ * LTPF analysis skipped, on reduced encoder complexity
+ * ltpf            Context of analysis, reset as without pitch
+ * data            Return bitstream data, disabled activation
+ * return          False, no pitch present
+ */
+bool lc3_ltpf_analyse_skip(lc3_ltpf_analysis_t *ltpf, lc3_ltpf_data_t *data);
+
 /**
  * LTPF disable
  * data            LTPF data, disabled activation on return
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Fixed point kernels, for targets without floating point unit
+ *
+ * The synthesis filter runs on samples in fixed point, with 12 fractional
+ * bits as the output of the fixed point MDCT, so that the conversions
+ * are exact. The coefficients are in Q31, and the fading gain in Q30.
+ */
+
+#if LC3_FIXED_POINT
+
+
+/**
+ * Multiply by a coefficient
+ * c, x            Coefficient in Q31, and value lower than 2^30
+ * return          `c * x`
+ */
+static inline int32_t fixed_mul_c(int32_t c, int32_t x)
+{
+    return lc3_mulh(c, 2 * x);
+}
+
+
+/**
+ * Synthesis filter template
+ */
+#ifndef synthesize_template
+
+LC3_HOT static inline void fixed_synthesize_template(
+    const float *xh, int nh, int lag,
+    const float *x0, float *x, int n,
+    const float *c, const int w, int fade)
+{
+    const int e = 12;
+
+    int32_t g = fade <= 0 ? 1 << 30 : 0;
+    int32_t g_incr = ((fade > 0) - (fade < 0)) * ((1 << 30) / n);
+    int32_t cq[2 * 12], u[12];  /* Width of filters up to 12 */
+
+    for (int k = 0; k < 2*w; k++)
+        cq[k] = 2 * lc3_fixed_from_float(c[k], 30);
+
+    /* --- Load previous samples --- */
+
+    lag += (w >> 1);
+
+    const float *y = x - xh < lag ? x + (nh - lag) : x - lag;
+    const float *y_end = xh + nh - 1;
+
+    for (int j = 0; j < w-1; j++) {
+
+        u[j] = 0;
+
+        int32_t yi = lc3_fixed_from_float(*y, e);
+        int32_t xi = lc3_fixed_from_float(*(x0++), e);
+        y = y < y_end ? y + 1 : xh;
+
+        for (int k = 0; k <= j; k++)
+            u[j-k] -= fixed_mul_c(cq[k], yi);
+
+        for (int k = 0; k <= j; k++)
+            u[j-k] += fixed_mul_c(cq[w+k], xi);
+    }
+
+    u[w-1] = 0;
+
+    /* --- Process by filter length --- */
+
+    for (int i = 0; i < n; i += w)
+        for (int j = 0; j < w; j++, g += g_incr) {
+
+            int32_t yi = lc3_fixed_from_float(*y, e);
+            int32_t xi = lc3_fixed_from_float(*x, e);
+            y = y < y_end ? y + 1 : xh;
+
+            for (int k = 0; k < w; k++)
+                u[(j+(w-1)-k)%w] -= fixed_mul_c(cq[k], yi);
+
+            for (int k = 0; k < w; k++)
+                u[(j+(w-1)-k)%w] += fixed_mul_c(cq[w+k], xi);
+
+            *(x++) = lc3_fixed_to_float(
+                xi - (int32_t)(((int64_t)g * u[j]) >> 30), e);
+            u[j] = 0;
+        }
+}
+
+#define synthesize_template fixed_synthesize_template
+
+#endif /* synthesize_template */
+
+#endif /* LC3_FIXED_POINT */
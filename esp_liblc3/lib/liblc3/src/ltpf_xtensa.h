@@ -0,0 +1,259 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Kernels for the Xtensa MAC16 option (ESP32, ESP32-S3)
+ *
+ * The 16x16 multiply-accumulate `mula.aa.*` selects the low or high
+ * half of each operand, so one 32 bits load of each vector feeds two
+ * MACs, in any relative alignment of the vectors. The 40 bits ACC
+ * register holds the sums without the 64 bits additions of the
+ * generic `dot()`, and the results are bit-exact.
+ */
+
+#if __XTENSA__ && !defined(TEST_XTENSA)
+#include <xtensa/config/core-isa.h>
+#endif
+
+#if (__XTENSA__ && XCHAL_HAVE_MAC16 && !defined(TEST_XTENSA)) \
+        || defined(TEST_XTENSA)
+
+#ifndef TEST_XTENSA
+
+/**
+ * ACC = 0, ACC += half(a) * half(b), and read the sign extended ACC
+ * The halves of `a` and `b` are selected by L(ow) and H(igh)
+ */
+
+static inline void __xt_acc_clear(void)
+{
+    __asm volatile ("wsr %0, acclo\n\twsr %0, acchi" : : "r" (0));
+}
+
+static inline void __xt_mula_ll(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.ll %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_hh(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.hh %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_lh(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.lh %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_hl(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.hl %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline int64_t __xt_acc_read(void)
+{
+    uint32_t lo; int32_t hi;
+    __asm volatile ("rsr %0, acclo" : "=r" (lo));
+    __asm volatile ("rsr %0, acchi" : "=r" (hi));
+    return (int64_t)(int8_t)hi * (1LL << 32) + lo;
+}
+
+/**
+ * Load of a 32 bits word, `p` aligned on 32 bits
+ * An unaligned `l32i` raises a LoadStoreAlignment exception
+ */
+
+static inline int32_t __xt_l32i(const int32_t *p)
+{
+    return *p;
+}
+
+#endif /* TEST_XTENSA */
+
+
+/**
+ * Import
+ */
+
+static inline int32_t filter_hp50(struct lc3_ltpf_hp50_state *, int32_t);
+
+
+/**
+ * Accumulate in ACC the dot product of 2 vectors
+ * a, b, n         The 2 vectors of size `n`, even
+ *
+ * The vectors are aligned on 16 bits. As the product commutes, they are
+ * swapped so that `a` is aligned on 32 bits when one of them is. The words
+ * loaded of a vector not aligned on 32 bits hold `x[-1]` and `x[n]` as
+ * their other half, which do not take part in the sum.
+ */
+LC3_HOT static inline void xtensa_dot_acc(
+    const int16_t *a, const int16_t *b, int n)
+{
+    if ((uintptr_t)a & 3) {
+        const int16_t *t = a;
+        a = b, b = t;
+    }
+
+    __xt_acc_clear();
+
+    if ((uintptr_t)a & 3) {
+        const int32_t *an = (const int32_t *)(a - 1);
+        const int32_t *bn = (const int32_t *)(b - 1);
+        int32_t ax = __xt_l32i(an++), bx = __xt_l32i(bn++);
+
+        __xt_mula_hh(ax, bx);
+
+        for (int i = 1; i < (n >> 1); i++) {
+            ax = __xt_l32i(an++); bx = __xt_l32i(bn++);
+            __xt_mula_ll(ax, bx);
+            __xt_mula_hh(ax, bx);
+        }
+
+        ax = __xt_l32i(an); bx = __xt_l32i(bn);
+        __xt_mula_ll(ax, bx);
+
+    } else if (((uintptr_t)b & 3) == 0) {
+        const int32_t *an = (const int32_t *)a;
+        const int32_t *bn = (const int32_t *)b;
+
+        for (int i = 0; i < (n >> 1); i++) {
+            int32_t ax = __xt_l32i(an++), bx = __xt_l32i(bn++);
+            __xt_mula_ll(ax, bx);
+            __xt_mula_hh(ax, bx);
+        }
+
+    } else {
+        const int32_t *an = (const int32_t *)a;
+        const int32_t *bn = (const int32_t *)(b - 1);
+        int32_t b0 = __xt_l32i(bn++), b1;
+
+        for (int i = 0; i < (n >> 1); i++, b0 = b1) {
+            int32_t ax = __xt_l32i(an++); b1 = __xt_l32i(bn++);
+            __xt_mula_lh(ax, b0);
+            __xt_mula_hl(ax, b1);
+        }
+    }
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  Resampling
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Resample from 8 / 16 / 32 KHz to 12.8 KHz Template
+ */
+#ifndef resample_x64k_12k8
+
+LC3_HOT static inline void xtensa_resample_x64k_12k8(const int p,
+    const int16_t *h, struct lc3_ltpf_hp50_state *hp50,
+    const int16_t *x, int16_t *y, int n)
+{
+    const int w = 2*(40 / p);
+
+    x -= w - 1;
+
+    for (int i = 0; i < 5*n; i += 5) {
+        xtensa_dot_acc(h + (i % p) * w, x + (i / p), w);
+        int32_t un = (int32_t)__xt_acc_read();
+
+        int32_t yn = filter_hp50(hp50, un);
+        *(y++) = (yn + (1 << 15)) >> 16;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define resample_x64k_12k8 xtensa_resample_x64k_12k8
+#endif
+
+#endif /* resample_x64k_12k8 */
+
+/**
+ * Resample from 24 / 48 KHz to 12.8 KHz Template
+ */
+#ifndef resample_x192k_12k8
+
+LC3_HOT static inline void xtensa_resample_x192k_12k8(const int p,
+    const int16_t *h, struct lc3_ltpf_hp50_state *hp50,
+    const int16_t *x, int16_t *y, int n)
+{
+    const int w = 2*(120 / p);
+
+    x -= w - 1;
+
+    for (int i = 0; i < 15*n; i += 15) {
+        xtensa_dot_acc(h + (i % p) * w, x + (i / p), w);
+        int32_t un = (int32_t)__xt_acc_read();
+
+        int32_t yn = filter_hp50(hp50, un);
+        *(y++) = (yn + (1 << 15)) >> 16;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define resample_x192k_12k8 xtensa_resample_x192k_12k8
+#endif
+
+#endif /* resample_x192k_12k8 */
+
+
+/* ----------------------------------------------------------------------------
+ *  Analysis
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Return dot product of 2 vectors
+ */
+#ifndef dot
+
+LC3_HOT static inline float xtensa_dot(
+    const int16_t *a, const int16_t *b, int n)
+{
+    xtensa_dot_acc(a, b, n);
+    int64_t v = __xt_acc_read();
+
+    int32_t v32 = (v + (1 << 5)) >> 6;
+    return (float)v32;
+}
+
+#ifndef TEST_XTENSA
+#define dot xtensa_dot
+#endif
+
+#endif /* dot */
+
+/**
+ * Return vector of correlations
+ */
+#ifndef correlate
+
+LC3_HOT static void xtensa_correlate(
+    const int16_t *a, const int16_t *b, int n, float *y, int nc)
+{
+    for (const float *ye = y + nc; y < ye; )
+        *(y++) = xtensa_dot(a, b--, n);
+}
+
+#ifndef TEST_XTENSA
+#define correlate xtensa_correlate
+#endif
+
+#endif /* correlate */
+
+#endif /* __XTENSA__ && XCHAL_HAVE_MAC16 */
@@ -16,16 +16,19 @@
 
 liblc3_src += \
     $(SRC_DIR)/attdet.c \
+    $(SRC_DIR)/bench.c \
     $(SRC_DIR)/bits.c \
     $(SRC_DIR)/bwdet.c \
     $(SRC_DIR)/energy.c \
     $(SRC_DIR)/lc3.c \
     $(SRC_DIR)/ltpf.c \
     $(SRC_DIR)/mdct.c \
+    $(SRC_DIR)/mdct_fixed.c \
     $(SRC_DIR)/plc.c \
     $(SRC_DIR)/sns.c \
     $(SRC_DIR)/spec.c \
     $(SRC_DIR)/tables.c \
+    $(SRC_DIR)/tables_fixed.c \
     $(SRC_DIR)/tns.c
 
 liblc3_cflags += -ffast-math
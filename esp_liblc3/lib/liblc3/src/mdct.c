@@ -19,7 +19,10 @@
 #include "mdct.h"
 #include "tables.h"
 
+#if !LC3_FIXED_POINT
+
 #include "mdct_neon.h"
+#include "mdct_xtensa.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -157,6 +160,66 @@ LC3_HOT static inline void fft_bf2(
 }
 #endif /* fft_bf2 */
 
+/**
+ * FFT Butterflies 2 Points, of 2 successive stages (radix 2^2)
+ * twiddles_a/b    Twiddles factors of the first and second stages
+ * x, y            Input and output coefficients
+ * n               Number of interleaved transforms of the first stage
+ *
+ * The operations are the ones of the 2 stages `fft_bf2()`, in the same
+ * order, the outputs of the first stage are kept in registers : a pass
+ * over the coefficients is saved, for the same results.
+ */
+#if !defined(fft_bf4) && !defined(fft_bf2)
+LC3_HOT static inline void fft_bf4(
+    const struct lc3_fft_bf2_twiddles *twiddles_a,
+    const struct lc3_fft_bf2_twiddles *twiddles_b,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles_a->n2;
+    const struct lc3_complex *wa = twiddles_a->t;
+    const struct lc3_complex *wb0 = twiddles_b->t, *wb1 = wb0 + n2;
+
+    const struct lc3_complex *x0 = x, *x1 = x0 + n*n2;
+    const struct lc3_complex *x2 = x0 + (n >> 1)*n2, *x3 = x1 + (n >> 1)*n2;
+
+    struct lc3_complex *y0 = y, *y1 = y0 + n2;
+    struct lc3_complex *y2 = y1 + n2, *y3 = y2 + n2;
+
+    for (int i = 0; i < (n >> 1); i++,
+            y0 += 4*n2, y1 += 4*n2, y2 += 4*n2, y3 += 4*n2) {
+
+        for (int j = 0; j < n2; j++, x0++, x1++, x2++, x3++) {
+            struct lc3_complex u0, u1, v0, v1;
+
+            u0.re = x0->re + x1->re * wa[j].re - x1->im * wa[j].im;
+            u0.im = x0->im + x1->im * wa[j].re + x1->re * wa[j].im;
+
+            u1.re = x0->re - x1->re * wa[j].re + x1->im * wa[j].im;
+            u1.im = x0->im - x1->im * wa[j].re - x1->re * wa[j].im;
+
+            v0.re = x2->re + x3->re * wa[j].re - x3->im * wa[j].im;
+            v0.im = x2->im + x3->im * wa[j].re + x3->re * wa[j].im;
+
+            v1.re = x2->re - x3->re * wa[j].re + x3->im * wa[j].im;
+            v1.im = x2->im - x3->im * wa[j].re - x3->re * wa[j].im;
+
+            y0[j].re = u0.re + v0.re * wb0[j].re - v0.im * wb0[j].im;
+            y0[j].im = u0.im + v0.im * wb0[j].re + v0.re * wb0[j].im;
+
+            y2[j].re = u0.re - v0.re * wb0[j].re + v0.im * wb0[j].im;
+            y2[j].im = u0.im - v0.im * wb0[j].re - v0.re * wb0[j].im;
+
+            y1[j].re = u1.re + v1.re * wb1[j].re - v1.im * wb1[j].im;
+            y1[j].im = u1.im + v1.im * wb1[j].re + v1.re * wb1[j].im;
+
+            y3[j].re = u1.re - v1.re * wb1[j].re + v1.im * wb1[j].im;
+            y3[j].im = u1.im - v1.im * wb1[j].re - v1.re * wb1[j].im;
+        }
+    }
+}
+#endif /* fft_bf4 */
+
 /**
  * Perform FFT
  * x, y0, y1       Input, and 2 scratch buffers of size `n`
@@ -180,19 +243,100 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
      *       n = 90, 180            n3 = 2, n2 = [1..2]
      *
      * Note that the expression `n & (n-1) == 0` is equivalent
-     * to the check that `n` is a power of 2. */
+     * to the check that `n` is a power of 2.
+     * The radix 2 stages are run by pairs, as radix 2^2 stages,
+     * when the kernel is available. */
 
     fft_5(x, y[is], n /= 5);
 
     for (i3 = 0; n & (n-1); i3++, is ^= 1)
         fft_bf3(lc3_fft_twiddles_bf3[i3], y[is], y[is ^ 1], n /= 3);
 
-    for (i2 = 0; n > 1; i2++, is ^= 1)
+#if defined(fft_bf4) || !defined(fft_bf2)
+    for (i2 = 0; n > 2; i2 += 2, is ^= 1, n >>= 2)
+        fft_bf4(lc3_fft_twiddles_bf2[i2][i3], lc3_fft_twiddles_bf2[i2+1][i3],
+            y[is], y[is ^ 1], n >> 1);
+#else
+    i2 = 0;
+#endif
+
+    for ( ; n > 1; i2++, is ^= 1)
         fft_bf2(lc3_fft_twiddles_bf2[i2][i3], y[is], y[is ^ 1], n >>= 1);
 
     return y[is];
 }
 
+/**
+ * FFT of the common transform sizes, decomposed at compile time
+ * x, y0, y1       Input, and 2 scratch buffers of size `n`
+ * n               Number of points, 240 or 60 (unused)
+ * return          The buffer `y0` or `y1` that hold the result
+ *
+ * The sizes of the butterflies are given as constants,
+ * for the compiler to specialize the loops of the kernels.
+ */
+
+#define FFT_BF3(i3, n3, x, y, n) \
+    fft_bf3(&(const struct lc3_fft_bf3_twiddles){ \
+        n3, lc3_fft_twiddles_bf3[i3]->t }, x, y, n)
+
+#define FFT_BF2(i2, i3, n2, x, y, n) \
+    fft_bf2(&(const struct lc3_fft_bf2_twiddles){ \
+        n2, lc3_fft_twiddles_bf2[i2][i3]->t }, x, y, n)
+
+#define FFT_BF4(i2, i3, n2, x, y, n) \
+    fft_bf4(&(const struct lc3_fft_bf2_twiddles){ \
+                n2, lc3_fft_twiddles_bf2[i2][i3]->t }, \
+            &(const struct lc3_fft_bf2_twiddles){ \
+                2*n2, lc3_fft_twiddles_bf2[i2+1][i3]->t }, x, y, n)
+
+#if LC3_CONFIG_10M_48K
+static struct lc3_complex *fft_240(const struct lc3_complex *x, int n,
+    struct lc3_complex *y0, struct lc3_complex *y1)
+{
+    (void)n;
+
+    fft_5(x, y1, 48);
+    FFT_BF3(0,   5, y1, y0, 16);
+
+#if defined(fft_bf4) || !defined(fft_bf2)
+    FFT_BF4(0, 1,  15, y0, y1, 8);
+    FFT_BF4(2, 1,  60, y1, y0, 2);
+#else
+    FFT_BF2(0, 1,  15, y0, y1, 8);
+    FFT_BF2(1, 1,  30, y1, y0, 4);
+    FFT_BF2(2, 1,  60, y0, y1, 2);
+    FFT_BF2(3, 1, 120, y1, y0, 1);
+#endif
+
+    return y0;
+}
+#endif /* LC3_CONFIG_10M_48K */
+
+#if LC3_CONFIG_7M5_16K
+static struct lc3_complex *fft_60(const struct lc3_complex *x, int n,
+    struct lc3_complex *y0, struct lc3_complex *y1)
+{
+    (void)n;
+
+    fft_5(x, y1, 12);
+    FFT_BF3(0,   5, y1, y0, 4);
+
+#if defined(fft_bf4) || !defined(fft_bf2)
+    FFT_BF4(0, 1,  15, y0, y1, 2);
+    return y1;
+#else
+    FFT_BF2(0, 1,  15, y0, y1, 2);
+    FFT_BF2(1, 1,  30, y1, y0, 1);
+    return y0;
+#endif
+}
+#endif /* LC3_CONFIG_7M5_16K */
+
+#undef FFT_BF3
+#undef FFT_BF2
+#undef FFT_BF4
+
 
 /* ----------------------------------------------------------------------------
  *  MDCT processing
@@ -201,15 +345,16 @@ static struct lc3_complex *fft(const struct lc3_complex *x, int n,
 /**
  * Windowing of samples before MDCT
  * dt, sr          Duration and samplerate (size of the transform)
+ * win             Window coefficients of the transform
  * x, y            Input current and delayed samples
  * y, d            Output windowed samples, and delayed ones
  */
 LC3_HOT static void mdct_window(enum lc3_dt dt, enum lc3_srate sr,
-    const float *x, float *d, float *y)
+    const float *win, const float *x, float *d, float *y)
 {
     int ns = LC3_NS(dt, sr), nd = LC3_ND(dt, sr);
 
-    const float *w0 = lc3_mdct_win[dt][sr], *w1 = w0 + ns;
+    const float *w0 = win, *w1 = w0 + ns;
     const float *w2 = w1, *w3 = w2 + nd;
 
     const float *x0 = x + ns-nd, *x1 = x0;
@@ -240,6 +385,7 @@ LC3_HOT static void mdct_window(enum lc3_dt dt, enum lc3_srate sr,
  *
  * `x` and y` can be the same buffer
  */
+#ifndef mdct_pre_fft
 LC3_HOT static void mdct_pre_fft(const struct lc3_mdct_rot_def *def,
     const float *x, struct lc3_complex *y)
 {
@@ -262,6 +408,7 @@ LC3_HOT static void mdct_pre_fft(const struct lc3_mdct_rot_def *def,
         *(--y1) = v;
     }
 }
+#endif /* mdct_pre_fft */
 
 /**
  * Post-rotate FFT N/4 points coefficients, resulting MDCT N points
@@ -270,6 +417,7 @@ LC3_HOT static void mdct_pre_fft(const struct lc3_mdct_rot_def *def,
  *
  * `x` and y` can be the same buffer
  */
+#ifndef mdct_post_fft
 LC3_HOT static void mdct_post_fft(const struct lc3_mdct_rot_def *def,
     const struct lc3_complex *x, float *y)
 {
@@ -292,6 +440,7 @@ LC3_HOT static void mdct_post_fft(const struct lc3_mdct_rot_def *def,
         *(--y1) = v0;  *(--y1) = v1;
     }
 }
+#endif /* mdct_post_fft */
 
 /**
  * Pre-rotate IMDCT coefficients of N points, before FFT N/4 points FFT
@@ -302,6 +451,7 @@ LC3_HOT static void mdct_post_fft(const struct lc3_mdct_rot_def *def,
  * The real and imaginary parts of `y` are swapped,
  * to operate on FFT instead of IFFT
  */
+#ifndef imdct_pre_fft
 LC3_HOT static void imdct_pre_fft(const struct lc3_mdct_rot_def *def,
     const float *x, struct lc3_complex *y)
 {
@@ -324,6 +474,7 @@ LC3_HOT static void imdct_pre_fft(const struct lc3_mdct_rot_def *def,
         (  y1)->im = - v0 * vw.re + v1 * vw.im;
     }
 }
+#endif /* imdct_pre_fft */
 
 /**
  * Post-rotate FFT N/4 points coefficients, resulting IMDCT N points
@@ -334,6 +485,7 @@ LC3_HOT static void imdct_pre_fft(const struct lc3_mdct_rot_def *def,
  * The real and imaginary parts of `x` are swapped,
  * to operate on FFT instead of IFFT
  */
+#ifndef imdct_post_fft
 LC3_HOT static void imdct_post_fft(const struct lc3_mdct_rot_def *def,
     const struct lc3_complex *x, float *y)
 {
@@ -355,15 +507,17 @@ LC3_HOT static void imdct_post_fft(const struct lc3_mdct_rot_def *def,
         *(y0++) = vz.re * vw.re + vz.im * vw.im;
     }
 }
+#endif /* imdct_post_fft */
 
 /**
  * Apply windowing of samples
  * dt, sr          Duration and samplerate
+ * win             Window coefficients of the transform
  * x, d            Middle half of IMDCT coefficients and delayed samples
  * y, d            Output samples and delayed ones
  */
 LC3_HOT static void imdct_window(enum lc3_dt dt, enum lc3_srate sr,
-    const float *x, float *d, float *y)
+    const float *win, const float *x, float *d, float *y)
 {
     /* The full MDCT coefficients is given by symmetry :
      *   T[   0 ..  n/4-1] = -half[n/4-1 .. 0    ]
@@ -372,7 +526,7 @@ LC3_HOT static void imdct_window(enum lc3_dt dt, enum lc3_srate sr,
      *   T[3n/4 ..    n-1] =  half[n/2-1 .. n/4  ]  */
 
     int n4 = LC3_NS(dt, sr) >> 1, nd = LC3_ND(dt, sr);
-    const float *w2 = lc3_mdct_win[dt][sr], *w0 = w2 + 3*n4, *w1 = w0;
+    const float *w2 = win, *w0 = w2 + 3*n4, *w1 = w0;
 
     const float *x0 = d + nd-n4, *x1 = x0;
     float *y0 = y + nd-n4, *y1 = y0, *y2 = d + nd, *y3 = d;
@@ -422,23 +576,33 @@ LC3_HOT static void rescale(float *x, int n, float f)
 
 /**
  * Forward MDCT transformation
+ * dt, sr          Duration and samplerate (size of the transform)
+ * win, rot        Window and rotation coefficients of the transform
+ * fft             FFT kernel of the size of the transform
+ * sr_dst          Samplerate destination, scale transform accordingly
+ * x, d            Temporal samples and delayed buffer
+ * y, d            Output `ns` coefficients and `nd` delayed samples
  */
-void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
+LC3_HOT static inline void mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
+    const float *win, const struct lc3_mdct_rot_def *rot_def,
+    struct lc3_complex *(*fft)(const struct lc3_complex *, int,
+        struct lc3_complex *, struct lc3_complex *),
     enum lc3_srate sr_dst, const float *x, float *d, float *y)
 {
-    const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
     int ns_dst = LC3_NS(dt, sr_dst);
     int ns = LC3_NS(dt, sr);
 
+    const struct lc3_mdct_rot_def rot = { ns/2, rot_def->w };
+
     struct lc3_complex buffer[LC3_MAX_NS / 2];
     struct lc3_complex *z = (struct lc3_complex *)y;
     union { float *f; struct lc3_complex *z; } u = { .z = buffer };
 
-    mdct_window(dt, sr, x, d, u.f);
+    mdct_window(dt, sr, win, x, d, u.f);
 
-    mdct_pre_fft(rot, u.f, u.z);
+    mdct_pre_fft(&rot, u.f, u.z);
     u.z = fft(u.z, ns/2, u.z, z);
-    mdct_post_fft(rot, u.z, y);
+    mdct_post_fft(&rot, u.z, y);
 
     if (ns != ns_dst)
         rescale(y, ns_dst, sqrtf((float)ns_dst / ns));
@@ -446,24 +610,210 @@ void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
 
 /**
  * Inverse MDCT transformation
+ * dt, sr          Duration and samplerate (size of the transform)
+ * win, rot        Window and rotation coefficients of the transform
+ * fft             FFT kernel of the size of the transform
+ * sr_src          Samplerate source, scale transform accordingly
+ * x, d            Frequency coefficients and delayed buffer
+ * y, d            Output `ns` samples and `nd` delayed ones
  */
-void lc3_mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
+LC3_HOT static inline void mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
+    const float *win, const struct lc3_mdct_rot_def *rot_def,
+    struct lc3_complex *(*fft)(const struct lc3_complex *, int,
+        struct lc3_complex *, struct lc3_complex *),
     enum lc3_srate sr_src, const float *x, float *d, float *y)
 {
-    const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
     int ns_src = LC3_NS(dt, sr_src);
     int ns = LC3_NS(dt, sr);
 
+    const struct lc3_mdct_rot_def rot = { ns/2, rot_def->w };
+
     struct lc3_complex buffer[LC3_MAX_NS / 2];
     struct lc3_complex *z = (struct lc3_complex *)y;
     union { float *f; struct lc3_complex *z; } u = { .z = buffer };
 
-    imdct_pre_fft(rot, x, z);
+    imdct_pre_fft(&rot, x, z);
     z = fft(z, ns/2, z, u.z);
-    imdct_post_fft(rot, z, u.f);
+    imdct_post_fft(&rot, z, u.f);
 
     if (ns != ns_src)
         rescale(u.f, ns, sqrtf((float)ns / ns_src));
 
-    imdct_window(dt, sr, u.f, d, y);
+    imdct_window(dt, sr, win, u.f, d, y);
+}
+
+/**
+ * MDCT plans
+ * dt, sr          Duration and samplerate (size of the transform)
+ * win, rot        Window and rotation coefficients of the transform
+ * forward         Forward transformation kernel
+ * inverse         Inverse transformation kernel
+ *
+ * The kernels of the common 10ms 48KHz and 7.5ms 16KHz configurations
+ * are specialized, the sizes of the transform, the FFT decomposition,
+ * the loops bounds and the tables are known at compile time.
+ */
+
+struct lc3_mdct_plan {
+    enum lc3_dt dt;
+    enum lc3_srate sr;
+
+    const float *win;
+    const struct lc3_mdct_rot_def *rot;
+
+    void (*forward)(const struct lc3_mdct_plan *,
+        enum lc3_srate, const float *, float *, float *);
+    void (*inverse)(const struct lc3_mdct_plan *,
+        enum lc3_srate, const float *, float *, float *);
+};
+
+static void forward_any(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    mdct_forward(plan->dt, plan->sr, plan->win, plan->rot,
+        fft, sr_dst, x, d, y);
+}
+
+static void inverse_any(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    mdct_inverse(plan->dt, plan->sr, plan->win, plan->rot,
+        fft, sr_src, x, d, y);
+}
+
+#if LC3_CONFIG_10M_48K
+
+static void forward_10m_48k(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    (void)plan;
+    mdct_forward(LC3_DT_10M, LC3_SRATE_48K,
+        lc3_mdct_win_10m_480, &lc3_mdct_rot_960, fft_240, sr_dst, x, d, y);
+}
+
+static void inverse_10m_48k(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    (void)plan;
+    mdct_inverse(LC3_DT_10M, LC3_SRATE_48K,
+        lc3_mdct_win_10m_480, &lc3_mdct_rot_960, fft_240, sr_src, x, d, y);
+}
+
+#endif /* LC3_CONFIG_10M_48K */
+
+#if LC3_CONFIG_7M5_16K
+
+static void forward_7m5_16k(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    (void)plan;
+    mdct_forward(LC3_DT_7M5, LC3_SRATE_16K,
+        lc3_mdct_win_7m5_120, &lc3_mdct_rot_240, fft_60, sr_dst, x, d, y);
+}
+
+static void inverse_7m5_16k(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    (void)plan;
+    mdct_inverse(LC3_DT_7M5, LC3_SRATE_16K,
+        lc3_mdct_win_7m5_120, &lc3_mdct_rot_240, fft_60, sr_src, x, d, y);
+}
+
+#endif /* LC3_CONFIG_7M5_16K */
+
+#define PLAN(dt, sr, win, rot, kernels) \
+    { LC3_DT_ ## dt, LC3_SRATE_ ## sr, \
+      lc3_mdct_win_ ## win, &lc3_mdct_rot_ ## rot, \
+      forward_ ## kernels, inverse_ ## kernels }
+
+static const struct lc3_mdct_plan mdct_plans[LC3_NUM_DT][LC3_NUM_SRATE] = {
+
+#if LC3_CONFIG_DT_7M5
+    [LC3_DT_7M5] = {
+#if LC3_CONFIG_7M5_8K
+        [LC3_SRATE_8K ] = PLAN(7M5, 8K , 7m5_60 , 120, any),
+#endif
+#if LC3_CONFIG_7M5_16K
+        [LC3_SRATE_16K] = PLAN(7M5, 16K, 7m5_120, 240, 7m5_16k),
+#endif
+#if LC3_CONFIG_7M5_24K
+        [LC3_SRATE_24K] = PLAN(7M5, 24K, 7m5_180, 360, any),
+#endif
+#if LC3_CONFIG_7M5_32K
+        [LC3_SRATE_32K] = PLAN(7M5, 32K, 7m5_240, 480, any),
+#endif
+#if LC3_CONFIG_7M5_48K
+        [LC3_SRATE_48K] = PLAN(7M5, 48K, 7m5_360, 720, any),
+#endif
+    },
+#endif /* LC3_CONFIG_DT_7M5 */
+
+#if LC3_CONFIG_DT_10M
+    [LC3_DT_10M] = {
+#if LC3_CONFIG_10M_8K
+        [LC3_SRATE_8K ] = PLAN(10M, 8K , 10m_80 , 160, any),
+#endif
+#if LC3_CONFIG_10M_16K
+        [LC3_SRATE_16K] = PLAN(10M, 16K, 10m_160, 320, any),
+#endif
+#if LC3_CONFIG_10M_24K
+        [LC3_SRATE_24K] = PLAN(10M, 24K, 10m_240, 480, any),
+#endif
+#if LC3_CONFIG_10M_32K
+        [LC3_SRATE_32K] = PLAN(10M, 32K, 10m_320, 640, any),
+#endif
+#if LC3_CONFIG_10M_48K
+        [LC3_SRATE_48K] = PLAN(10M, 48K, 10m_480, 960, 10m_48k),
+#endif
+    },
+#endif /* LC3_CONFIG_DT_10M */
+};
+
+#undef PLAN
+
+/**
+ * Return the MDCT plan of a transform size
+ */
+const struct lc3_mdct_plan *lc3_mdct_get_plan(
+    enum lc3_dt dt, enum lc3_srate sr)
+{
+    return &mdct_plans[dt][sr];
+}
+
+/**
+ * Forward MDCT transformation, of a plan
+ */
+void lc3_mdct_forward_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    plan->forward(plan, sr_dst, x, d, y);
+}
+
+/**
+ * Inverse MDCT transformation, of a plan
+ */
+void lc3_mdct_inverse_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    plan->inverse(plan, sr_src, x, d, y);
+}
+
+/**
+ * Forward MDCT transformation
+ */
+void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    lc3_mdct_forward_plan(lc3_mdct_get_plan(dt, sr), sr_dst, x, d, y);
 }
+
+/**
+ * Inverse MDCT transformation
+ */
+void lc3_mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    lc3_mdct_inverse_plan(lc3_mdct_get_plan(dt, sr), sr_src, x, d, y);
+}
+
+#endif /* !LC3_FIXED_POINT */
@@ -29,6 +29,44 @@
 #include "common.h"
 
 
+/**
+ * MDCT plan, the kernels of a transform size resolved once at setup
+ */
+
+struct lc3_mdct_plan;
+
+/**
+ * Return the MDCT plan of a transform size
+ * dt, sr          Duration and samplerate (size of the transform)
+ * return          The plan, valid for the lifetime of the program
+ */
+const struct lc3_mdct_plan *lc3_mdct_get_plan(
+    enum lc3_dt dt, enum lc3_srate sr);
+
+/**
+ * Forward MDCT transformation, of a plan
+ * plan            Plan of the transform, as returned by `lc3_mdct_get_plan()`
+ * sr_dst          Samplerate destination, scale transform accordingly
+ * x, d            Temporal samples and delayed buffer
+ * y, d            Output `ns` coefficients and `nd` delayed samples
+ *
+ * `x` and `y` can be the same buffer
+ */
+void lc3_mdct_forward_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y);
+
+/**
+ * Inverse MDCT transformation, of a plan
+ * plan            Plan of the transform, as returned by `lc3_mdct_get_plan()`
+ * sr_src          Samplerate source, scale transform accordingly
+ * x, d            Frequency coefficients and delayed buffer
+ * y, d            Output `ns` samples and `nd` delayed ones
+ *
+ * `x` and `y` can be the same buffer
+ */
+void lc3_mdct_inverse_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y);
+
 /**
  * Forward MDCT transformation
  * dt, sr          Duration and samplerate (size of the transform)
@@ -0,0 +1,691 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * LC3 - Fixed point LD-MDCT, for targets without floating point unit
+ *
+ * Same interface and algorithm as `mdct.c`, replaced by this one when
+ * `LC3_FIXED_POINT` is set. The samples and coefficients are exchanged
+ * as floats with the other stages of the codec, and converted at the
+ * boundaries :
+ *
+ * - The inputs of the transforms are brought as block floating point,
+ *   the exponent selected on the largest magnitude of a frame.
+ * - The stages of the FFT are also computed as block floating point,
+ *   and the exponent is updated accordingly.
+ * - The windowed samples of the inverse transform are accumulated
+ *   with `PCM_EXP` fractional bits.
+ */
+
+#include "mdct.h"
+#include "tables.h"
+
+#if LC3_FIXED_POINT
+
+
+/**
+ * Fractional bits of temporal samples, leaving a headroom of 16 times
+ * the 16 bits range, before saturation
+ */
+
+#define PCM_EXP  12
+
+static inline int32_t pcm_fixed(float x)
+{
+    return lc3_fixed_from_float(x, PCM_EXP);
+}
+
+static inline float pcm_float(int32_t x)
+{
+    return lc3_fixed_to_float(x, PCM_EXP);
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  FFT processing
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Arithmetic shift
+ * x, s            Value, and shift on the left when positive
+ */
+static inline int32_t shift(int32_t x, int s)
+{
+    return s >= 0 ? x * (1 << s) : x >> -s;
+}
+
+/**
+ * Magnitude bound
+ * x               Value
+ * return          `|x|`, or `|x|-1` when negative, as unsigned
+ */
+static inline uint32_t mag(int32_t x)
+{
+    return x ^ (x >> 31);
+}
+
+/**
+ * Shift bringing a magnitude in range 2^28 to 2^29
+ * m               Magnitude bound, as OR of the magnitudes of values
+ */
+static inline int headroom(uint32_t m)
+{
+    return m ? lc3_clz32(m) - 3 : 0;
+}
+
+/**
+ * Complex multiplication
+ * a, w            Operands
+ * return          `a * w / 2`, with `w` in Q31
+ */
+static inline struct lc3_complex_q31 cmulh(
+    struct lc3_complex_q31 a, struct lc3_complex_q31 w)
+{
+    return (struct lc3_complex_q31){
+        lc3_mulh(a.re, w.re) - lc3_mulh(a.im, w.im),
+        lc3_mulh(a.im, w.re) + lc3_mulh(a.re, w.im) };
+}
+
+/**
+ * FFT 5 Points
+ * x, y            Input and output coefficients, of size 5xn
+ * n               Number of interleaved transform to perform
+ * s               Shift of the input, bringing magnitudes below 2^29
+ * return          Magnitude bound of the output
+ *
+ * The output is scaled by `2^s / 8`
+ */
+LC3_HOT static inline uint32_t fft_5(
+    const struct lc3_complex_q31 *x, struct lc3_complex_q31 *y, int n, int s)
+{
+    static const int32_t cos1 =   663608942;  /* cos(-2Pi 1/5) */
+    static const int32_t cos2 = -1737350766;  /* cos(-2Pi 2/5) */
+
+    static const int32_t sin1 = -2042378317;  /* sin(-2Pi 1/5) */
+    static const int32_t sin2 = -1262259218;  /* sin(-2Pi 2/5) */
+
+    uint32_t m = 0;
+
+    for (int i = 0; i < n; i++, x++, y+= 5) {
+
+        int32_t x0re = shift(x[0*n].re, s-3), x0im = shift(x[0*n].im, s-3);
+        int32_t x1re = shift(x[1*n].re, s-2), x1im = shift(x[1*n].im, s-2);
+        int32_t x2re = shift(x[2*n].re, s-2), x2im = shift(x[2*n].im, s-2);
+        int32_t x3re = shift(x[3*n].re, s-2), x3im = shift(x[3*n].im, s-2);
+        int32_t x4re = shift(x[4*n].re, s-2), x4im = shift(x[4*n].im, s-2);
+
+        struct lc3_complex_q31 s14 = { x1re + x4re, x1im + x4im };
+        struct lc3_complex_q31 d14 = { x1re - x4re, x1im - x4im };
+
+        struct lc3_complex_q31 s23 = { x2re + x3re, x2im + x3im };
+        struct lc3_complex_q31 d23 = { x2re - x3re, x2im - x3im };
+
+        int32_t a1re = lc3_mulh(s14.re, cos1) + lc3_mulh(s23.re, cos2);
+        int32_t a1im = lc3_mulh(s14.im, cos1) + lc3_mulh(s23.im, cos2);
+        int32_t a2re = lc3_mulh(s14.re, cos2) + lc3_mulh(s23.re, cos1);
+        int32_t a2im = lc3_mulh(s14.im, cos2) + lc3_mulh(s23.im, cos1);
+
+        int32_t b1re = lc3_mulh(d14.im, sin1) + lc3_mulh(d23.im, sin2);
+        int32_t b1im = lc3_mulh(d14.re, sin1) + lc3_mulh(d23.re, sin2);
+        int32_t b2re = lc3_mulh(d14.im, sin2) - lc3_mulh(d23.im, sin1);
+        int32_t b2im = lc3_mulh(d14.re, sin2) - lc3_mulh(d23.re, sin1);
+
+        y[0].re = x0re + (s14.re >> 1) + (s23.re >> 1);
+        y[0].im = x0im + (s14.im >> 1) + (s23.im >> 1);
+
+        y[1].re = x0re + a1re - b1re;
+        y[1].im = x0im + a1im + b1im;
+
+        y[2].re = x0re + a2re - b2re;
+        y[2].im = x0im + a2im + b2im;
+
+        y[3].re = x0re + a2re + b2re;
+        y[3].im = x0im + a2im - b2im;
+
+        y[4].re = x0re + a1re + b1re;
+        y[4].im = x0im + a1im - b1im;
+
+        for (int k = 0; k < 5; k++)
+            m |= mag(y[k].re) | mag(y[k].im);
+    }
+
+    return m;
+}
+
+/**
+ * FFT Butterfly 3 Points
+ * x, y            Input and output coefficients
+ * twiddles        Twiddles factors, determine size of transform
+ * n               Number of interleaved transforms
+ * s               Shift of the input, bringing magnitudes below 2^29
+ * return          Magnitude bound of the output
+ *
+ * The output is scaled by `2^s / 4`
+ */
+LC3_HOT static inline uint32_t fft_bf3(
+    const struct lc3_fft_bf3_twiddles_q31 *twiddles,
+    const struct lc3_complex_q31 *x, struct lc3_complex_q31 *y, int n, int s)
+{
+    int n3 = twiddles->n3;
+    const struct lc3_complex_q31 (*w0)[2] = twiddles->t;
+    const struct lc3_complex_q31 (*w1)[2] = w0 + n3, (*w2)[2] = w1 + n3;
+
+    const struct lc3_complex_q31 *x0 = x, *x1 = x0 + n*n3, *x2 = x1 + n*n3;
+    struct lc3_complex_q31 *y0 = y, *y1 = y0 + n3, *y2 = y1 + n3;
+
+    uint32_t m = 0;
+
+    for (int i = 0; i < n; i++, y0 += 3*n3, y1 += 3*n3, y2 += 3*n3)
+        for (int j = 0; j < n3; j++, x0++, x1++, x2++) {
+
+            int32_t x0re = shift(x0->re, s-2), x0im = shift(x0->im, s-2);
+            struct lc3_complex_q31 a1 = { shift(x1->re, s), shift(x1->im, s) };
+            struct lc3_complex_q31 a2 = { shift(x2->re, s), shift(x2->im, s) };
+
+            struct lc3_complex_q31 u1 = cmulh(a1, w0[j][0]);
+            struct lc3_complex_q31 u2 = cmulh(a2, w0[j][1]);
+            struct lc3_complex_q31 v1 = cmulh(a1, w1[j][0]);
+            struct lc3_complex_q31 v2 = cmulh(a2, w1[j][1]);
+            struct lc3_complex_q31 t1 = cmulh(a1, w2[j][0]);
+            struct lc3_complex_q31 t2 = cmulh(a2, w2[j][1]);
+
+            y0[j].re = x0re + ((u1.re + u2.re) >> 1);
+            y0[j].im = x0im + ((u1.im + u2.im) >> 1);
+
+            y1[j].re = x0re + ((v1.re + v2.re) >> 1);
+            y1[j].im = x0im + ((v1.im + v2.im) >> 1);
+
+            y2[j].re = x0re + ((t1.re + t2.re) >> 1);
+            y2[j].im = x0im + ((t1.im + t2.im) >> 1);
+
+            m |= mag(y0[j].re) | mag(y0[j].im) | mag(y1[j].re) |
+                 mag(y1[j].im) | mag(y2[j].re) | mag(y2[j].im);
+        }
+
+    return m;
+}
+
+/**
+ * FFT Butterfly 2 Points
+ * twiddles        Twiddles factors, determine size of transform
+ * x, y            Input and output coefficients
+ * n               Number of interleaved transforms
+ * s               Shift of the input, bringing magnitudes below 2^29
+ * return          Magnitude bound of the output
+ *
+ * The output is scaled by `2^s / 2`
+ */
+LC3_HOT static inline uint32_t fft_bf2(
+    const struct lc3_fft_bf2_twiddles_q31 *twiddles,
+    const struct lc3_complex_q31 *x, struct lc3_complex_q31 *y, int n, int s)
+{
+    int n2 = twiddles->n2;
+    const struct lc3_complex_q31 *w = twiddles->t;
+
+    const struct lc3_complex_q31 *x0 = x, *x1 = x0 + n*n2;
+    struct lc3_complex_q31 *y0 = y, *y1 = y0 + n2;
+
+    uint32_t m = 0;
+
+    for (int i = 0; i < n; i++, y0 += 2*n2, y1 += 2*n2) {
+
+        for (int j = 0; j < n2; j++, x0++, x1++) {
+
+            int32_t x0re = shift(x0->re, s-1), x0im = shift(x0->im, s-1);
+            struct lc3_complex_q31 a1 = { shift(x1->re, s), shift(x1->im, s) };
+            struct lc3_complex_q31 u = cmulh(a1, w[j]);
+
+            y0[j].re = x0re + u.re;
+            y0[j].im = x0im + u.im;
+
+            y1[j].re = x0re - u.re;
+            y1[j].im = x0im - u.im;
+
+            m |= mag(y0[j].re) | mag(y0[j].im) |
+                 mag(y1[j].re) | mag(y1[j].im);
+        }
+    }
+
+    return m;
+}
+
+/**
+ * Perform FFT
+ * x, y0, y1       Input, and 2 scratch buffers of size `n`
+ * n               Number of points 30, 40, 60, 80, 90, 120, 160, 180, 240
+ * scale           Return the scaling of the result, as `2^-scale`
+ * return          The buffer `y0` or `y1` that hold the result
+ *
+ * Input `x` can be the same as the `y0` second scratch buffer
+ *
+ * The butterflies are computed as block floating point : the inputs
+ * of each stage are shifted according to the largest magnitude, so that
+ * the outputs do not overflow, and keep the most significant bits.
+ */
+static struct lc3_complex_q31 *fft(const struct lc3_complex_q31 *x, int n,
+    struct lc3_complex_q31 *y0, struct lc3_complex_q31 *y1, int *scale)
+{
+    struct lc3_complex_q31 *y[2] = { y1, y0 };
+    int i2, i3, is = 0, s;
+    uint32_t m = 0;
+
+    for (int i = 0; i < n; i++)
+        m |= mag(x[i].re) | mag(x[i].im);
+
+    s = headroom(m);
+    m = fft_5(x, y[is], n /= 5, s);
+    *scale = 3 - s;
+
+    for (i3 = 0; n & (n-1); i3++, is ^= 1) {
+        s = headroom(m);
+        m = fft_bf3(lc3_fft_twiddles_bf3_q31[i3], y[is], y[is ^ 1], n /= 3, s);
+        *scale += 2 - s;
+    }
+
+    for (i2 = 0; n > 1; i2++, is ^= 1) {
+        s = headroom(m);
+        m = fft_bf2(lc3_fft_twiddles_bf2_q31[i2][i3], y[is], y[is ^ 1], n >>= 1, s);
+        *scale += 1 - s;
+    }
+
+    return y[is];
+}
+
+
+/* ----------------------------------------------------------------------------
+ *  MDCT processing
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Windowing of samples before MDCT
+ * dt, sr          Duration and samplerate (size of the transform)
+ * x, y            Input current and delayed samples
+ * e               Exponent of the conversion, see `lc3_fixed_from_float()`
+ * y, d            Output windowed samples, and delayed ones
+ *
+ * The output is represented with `e - 2` fractional bits
+ */
+LC3_HOT static void mdct_window(enum lc3_dt dt, enum lc3_srate sr,
+    const float *x, float *d, int e, lc3_fixed_t *y)
+{
+    int ns = LC3_NS(dt, sr), nd = LC3_ND(dt, sr);
+
+    const int32_t *w0 = lc3_mdct_win_q30[dt][sr], *w1 = w0 + ns;
+    const int32_t *w2 = w1, *w3 = w2 + nd;
+
+    const float *x0 = x + ns-nd, *x1 = x0;
+    lc3_fixed_t *y0 = y + ns/2, *y1 = y0;
+    float *d0 = d, *d1 = d + nd;
+
+    #define FIX(x)  lc3_fixed_from_float(x, e)
+
+    while (x1 > x) {
+        *(--y0) = lc3_mulh(FIX(*d0), *(w0++))
+                - lc3_mulh(FIX(*(--x1)), *(--w1));
+        *(y1++) = lc3_mulh(FIX(*(d0++) = *(x0++)), *(w2++));
+
+        *(--y0) = lc3_mulh(FIX(*d0), *(w0++))
+                - lc3_mulh(FIX(*(--x1)), *(--w1));
+        *(y1++) = lc3_mulh(FIX(*(d0++) = *(x0++)), *(w2++));
+    }
+
+    for (x1 += ns; x0 < x1; ) {
+        *(--y0) = lc3_mulh(FIX(*d0), *(w0++))
+                - lc3_mulh(FIX(*(--d1)), *(--w1));
+        *(y1++) = lc3_mulh(FIX(*(d0++) = *(x0++)), *(w2++))
+                + lc3_mulh(FIX(*d1 = *(--x1)), *(--w3));
+
+        *(--y0) = lc3_mulh(FIX(*d0), *(w0++))
+                - lc3_mulh(FIX(*(--d1)), *(--w1));
+        *(y1++) = lc3_mulh(FIX(*(d0++) = *(x0++)), *(w2++))
+                + lc3_mulh(FIX(*d1 = *(--x1)), *(--w3));
+    }
+
+    #undef FIX
+}
+
+/**
+ * Pre-rotate MDCT coefficients of N/2 points, before FFT N/4 points FFT
+ * def             Size and twiddles factors
+ * x, y            Input and output coefficients
+ *
+ * `x` and y` can be the same buffer
+ */
+LC3_HOT static void mdct_pre_fft(const struct lc3_mdct_rot_def_q32 *def,
+    const lc3_fixed_t *x, struct lc3_complex_q31 *y)
+{
+    int n4 = def->n4;
+
+    const lc3_fixed_t *x0 = x, *x1 = x0 + 2*n4;
+    const struct lc3_complex_q31 *w0 = def->w, *w1 = w0 + n4;
+    struct lc3_complex_q31 *y0 = y, *y1 = y0 + n4;
+
+    while (x0 < x1) {
+        struct lc3_complex_q31 u, uw = *(w0++);
+        u.re = - lc3_mulh(*(--x1), uw.re) + lc3_mulh(*x0, uw.im);
+        u.im =   lc3_mulh(*(x0++), uw.re) + lc3_mulh(*x1, uw.im);
+
+        struct lc3_complex_q31 v, vw = *(--w1);
+        v.re = - lc3_mulh(*(--x1), vw.im) + lc3_mulh(*x0, vw.re);
+        v.im = - lc3_mulh(*(x0++), vw.im) - lc3_mulh(*x1, vw.re);
+
+        *(y0++) = u;
+        *(--y1) = v;
+    }
+}
+
+/**
+ * Post-rotate FFT N/4 points coefficients, resulting MDCT N points
+ * def             Size and twiddles factors
+ * x, y            Input and output coefficients
+ * e               Exponent of the input, see `lc3_fixed_to_float()`
+ *
+ * `x` and y` can be the same buffer
+ */
+LC3_HOT static void mdct_post_fft(const struct lc3_mdct_rot_def_q32 *def,
+    const struct lc3_complex_q31 *x, float *y, int e)
+{
+    int n4 = def->n4, n8 = n4 >> 1;
+
+    const struct lc3_complex_q31 *w0 = def->w + n8, *w1 = w0 - 1;
+    const struct lc3_complex_q31 *x0 = x + n8, *x1 = x0 - 1;
+
+    float *y0 = y + n4, *y1 = y0;
+
+    for ( ; y1 > y; x0++, x1--, w0++, w1--) {
+
+        int32_t u0 = lc3_mulh(x0->im, w0->im) + lc3_mulh(x0->re, w0->re);
+        int32_t u1 = lc3_mulh(x1->re, w1->im) - lc3_mulh(x1->im, w1->re);
+
+        int32_t v0 = lc3_mulh(x0->re, w0->im) - lc3_mulh(x0->im, w0->re);
+        int32_t v1 = lc3_mulh(x1->im, w1->im) + lc3_mulh(x1->re, w1->re);
+
+        *(y0++) = lc3_fixed_to_float(u0, e);
+        *(y0++) = lc3_fixed_to_float(u1, e);
+        *(--y1) = lc3_fixed_to_float(v0, e);
+        *(--y1) = lc3_fixed_to_float(v1, e);
+    }
+}
+
+/**
+ * Pre-rotate IMDCT coefficients of N points, before FFT N/4 points FFT
+ * def             Size and twiddles factors
+ * x, y            Input and output coefficients
+ * e               Exponent of the output, see `lc3_fixed_from_float()`
+ *
+ * `x` and `y` can be the same buffer
+ * The real and imaginary parts of `y` are swapped,
+ * to operate on FFT instead of IFFT
+ */
+LC3_HOT static void imdct_pre_fft(const struct lc3_mdct_rot_def_q32 *def,
+    const float *x, struct lc3_complex_q31 *y, int e)
+{
+    int n4 = def->n4;
+
+    const float *x0 = x, *x1 = x0 + 2*n4;
+
+    const struct lc3_complex_q31 *w0 = def->w, *w1 = w0 + n4;
+    struct lc3_complex_q31 *y0 = y, *y1 = y0 + n4;
+
+    while (x0 < x1) {
+        int32_t u0 = lc3_fixed_from_float(*(x0++), e);
+        int32_t u1 = lc3_fixed_from_float(*(--x1), e);
+        int32_t v0 = lc3_fixed_from_float(*(x0++), e);
+        int32_t v1 = lc3_fixed_from_float(*(--x1), e);
+        struct lc3_complex_q31 uw = *(w0++), vw = *(--w1);
+
+        (y0  )->re = - lc3_mulh(u0, uw.re) - lc3_mulh(u1, uw.im);
+        (y0++)->im = - lc3_mulh(u1, uw.re) + lc3_mulh(u0, uw.im);
+
+        (--y1)->re = - lc3_mulh(v1, vw.re) - lc3_mulh(v0, vw.im);
+        (  y1)->im = - lc3_mulh(v0, vw.re) + lc3_mulh(v1, vw.im);
+    }
+}
+
+/**
+ * Post-rotate FFT N/4 points coefficients, resulting IMDCT N points
+ * def             Size and twiddles factors
+ * x, y            Input and output coefficients
+ *
+ * `x` and y` can be the same buffer
+ * The real and imaginary parts of `x` are swapped,
+ * to operate on FFT instead of IFFT
+ */
+LC3_HOT static void imdct_post_fft(const struct lc3_mdct_rot_def_q32 *def,
+    const struct lc3_complex_q31 *x, lc3_fixed_t *y)
+{
+    int n4 = def->n4;
+
+    const struct lc3_complex_q31 *w0 = def->w, *w1 = w0 + n4;
+    const struct lc3_complex_q31 *x0 = x, *x1 = x0 + n4;
+
+    lc3_fixed_t *y0 = y, *y1 = y0 + 2*n4;
+
+    while (x0 < x1) {
+        struct lc3_complex_q31 uz = *(x0++), vz = *(--x1);
+        struct lc3_complex_q31 uw = *(w0++), vw = *(--w1);
+
+        *(y0++) = lc3_mulh(uz.re, uw.im) - lc3_mulh(uz.im, uw.re);
+        *(--y1) = lc3_mulh(uz.re, uw.re) + lc3_mulh(uz.im, uw.im);
+
+        *(--y1) = lc3_mulh(vz.re, vw.im) - lc3_mulh(vz.im, vw.re);
+        *(y0++) = lc3_mulh(vz.re, vw.re) + lc3_mulh(vz.im, vw.im);
+    }
+}
+
+/**
+ * Apply windowing of samples
+ * dt, sr          Duration and samplerate
+ * x, d            Middle half of IMDCT coefficients and delayed samples
+ * s               Shift of windowed coefficients to `PCM_EXP` fractional bits
+ * y, d            Output samples and delayed ones
+ */
+LC3_HOT static void imdct_window(enum lc3_dt dt, enum lc3_srate sr,
+    const lc3_fixed_t *x, int s, float *d, float *y)
+{
+    /* The full MDCT coefficients is given by symmetry :
+     *   T[   0 ..  n/4-1] = -half[n/4-1 .. 0    ]
+     *   T[ n/4 ..  n/2-1] =  half[0     .. n/4-1]
+     *   T[ n/2 .. 3n/4-1] =  half[n/4   .. n/2-1]
+     *   T[3n/4 ..    n-1] =  half[n/2-1 .. n/4  ]  */
+
+    int n4 = LC3_NS(dt, sr) >> 1, nd = LC3_ND(dt, sr);
+    const int32_t *w2 = lc3_mdct_win_q30[dt][sr], *w0 = w2 + 3*n4, *w1 = w0;
+
+    const float *x0 = d + nd-n4, *x1 = x0;
+    float *y0 = y + nd-n4, *y1 = y0, *y2 = d + nd, *y3 = d;
+
+    #define WIN(x, w)  lc3_fixed_shl(lc3_mulh(x, w), s)
+
+    while (y0 > y) {
+        *(--y0) = pcm_float(pcm_fixed(*(--x0)) - WIN(*(x  ), *(w1++)));
+        *(y1++) = pcm_float(pcm_fixed(*(x1++)) + WIN(*(x++), *(--w0)));
+
+        *(--y0) = pcm_float(pcm_fixed(*(--x0)) - WIN(*(x  ), *(w1++)));
+        *(y1++) = pcm_float(pcm_fixed(*(x1++)) + WIN(*(x++), *(--w0)));
+    }
+
+    while (y1 < y + nd) {
+        *(y1++) = pcm_float(pcm_fixed(*(x1++)) + WIN(*(x++), *(--w0)));
+        *(y1++) = pcm_float(pcm_fixed(*(x1++)) + WIN(*(x++), *(--w0)));
+    }
+
+    while (y1 < y + 2*n4) {
+        *(y1++) = pcm_float(WIN(*(x  ), *(--w0)));
+        *(--y2) = pcm_float(WIN(*(x++), *(w2++)));
+
+        *(y1++) = pcm_float(WIN(*(x  ), *(--w0)));
+        *(--y2) = pcm_float(WIN(*(x++), *(w2++)));
+    }
+
+    while (y2 > y3) {
+        *(y3++) = pcm_float(WIN(*(x  ), *(--w0)));
+        *(--y2) = pcm_float(WIN(*(x++), *(w2++)));
+
+        *(y3++) = pcm_float(WIN(*(x  ), *(--w0)));
+        *(--y2) = pcm_float(WIN(*(x++), *(w2++)));
+    }
+
+    #undef WIN
+}
+
+/**
+ * Rescale samples
+ * x, n            Input and count of samples, scaled as output
+ * f               Scale factor in Q29, lower than 4
+ */
+LC3_HOT static void rescale(lc3_fixed_t *x, int n, int32_t f)
+{
+    for (int i = 0; i < (n >> 2); i++) {
+        *x = lc3_mulh(*x, f); x++; *x = lc3_mulh(*x, f); x++;
+        *x = lc3_mulh(*x, f); x++; *x = lc3_mulh(*x, f); x++;
+    }
+}
+
+/**
+ * MDCT plans
+ * dt, sr          Duration and samplerate (size of the transform)
+ */
+
+struct lc3_mdct_plan {
+    enum lc3_dt dt;
+    enum lc3_srate sr;
+};
+
+static const struct lc3_mdct_plan mdct_plans[LC3_NUM_DT][LC3_NUM_SRATE] = {
+
+    [LC3_DT_7M5] = {
+        [LC3_SRATE_8K ] = { LC3_DT_7M5, LC3_SRATE_8K  },
+        [LC3_SRATE_16K] = { LC3_DT_7M5, LC3_SRATE_16K },
+        [LC3_SRATE_24K] = { LC3_DT_7M5, LC3_SRATE_24K },
+        [LC3_SRATE_32K] = { LC3_DT_7M5, LC3_SRATE_32K },
+        [LC3_SRATE_48K] = { LC3_DT_7M5, LC3_SRATE_48K },
+    },
+
+    [LC3_DT_10M] = {
+        [LC3_SRATE_8K ] = { LC3_DT_10M, LC3_SRATE_8K  },
+        [LC3_SRATE_16K] = { LC3_DT_10M, LC3_SRATE_16K },
+        [LC3_SRATE_24K] = { LC3_DT_10M, LC3_SRATE_24K },
+        [LC3_SRATE_32K] = { LC3_DT_10M, LC3_SRATE_32K },
+        [LC3_SRATE_48K] = { LC3_DT_10M, LC3_SRATE_48K },
+    },
+};
+
+/**
+ * Return the MDCT plan of a transform size
+ */
+const struct lc3_mdct_plan *lc3_mdct_get_plan(
+    enum lc3_dt dt, enum lc3_srate sr)
+{
+    return &mdct_plans[dt][sr];
+}
+
+/**
+ * Forward MDCT transformation, of a plan
+ */
+void lc3_mdct_forward_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    enum lc3_dt dt = plan->dt;
+    enum lc3_srate sr = plan->sr;
+
+    const struct lc3_mdct_rot_def_q32 *rot = lc3_mdct_rot_q32[dt][sr];
+    int ns_dst = LC3_NS(dt, sr_dst);
+    int ns = LC3_NS(dt, sr);
+    int nd = LC3_ND(dt, sr);
+    int e, fft_scale;
+
+    struct lc3_complex_q31 buffer[LC3_MAX_NS / 2];
+    struct lc3_complex_q31 *z = (struct lc3_complex_q31 *)y;
+    union { lc3_fixed_t *f; struct lc3_complex_q31 *z; } u = { .z = buffer };
+
+    /* --- Block floating point exponent, with largest magnitude
+     *     below 2^29, and bounds keeping the results representable --- */
+
+    e = LC3_MAX(lc3_float_max_exp(x, ns), lc3_float_max_exp(d, nd));
+    e = LC3_CLIP(28 - e, -60, 90);
+
+    mdct_window(dt, sr, x, d, e, u.f);
+
+    mdct_pre_fft(rot, u.f, u.z);
+    u.z = fft(u.z, ns/2, u.z, z, &fft_scale);
+    mdct_post_fft(rot, u.z, y, (e - 2) - fft_scale);
+
+    if (ns != ns_dst) {
+        float f = sqrtf((float)ns_dst / ns);
+        for (int i = 0; i < ns_dst; i++)
+            y[i] *= f;
+    }
+}
+
+/**
+ * Inverse MDCT transformation, of a plan
+ */
+void lc3_mdct_inverse_plan(const struct lc3_mdct_plan *plan,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    enum lc3_dt dt = plan->dt;
+    enum lc3_srate sr = plan->sr;
+
+    const struct lc3_mdct_rot_def_q32 *rot = lc3_mdct_rot_q32[dt][sr];
+    int ns_src = LC3_NS(dt, sr_src);
+    int ns = LC3_NS(dt, sr);
+    int e, fft_scale;
+
+    struct lc3_complex_q31 buffer[LC3_MAX_NS / 2];
+    struct lc3_complex_q31 *z = (struct lc3_complex_q31 *)y;
+    union { lc3_fixed_t *f; struct lc3_complex_q31 *z; } u = { .z = buffer };
+
+    /* --- Block floating point exponent, with largest magnitude
+     *     below 2^29, and bounds keeping the results representable --- */
+
+    e = LC3_CLIP(28 - lc3_float_max_exp(x, ns), -60, 90);
+
+    imdct_pre_fft(rot, x, z, e);
+    z = fft(z, ns/2, z, u.z, &fft_scale);
+    imdct_post_fft(rot, z, u.f);
+
+    e -= fft_scale;
+
+    if (ns != ns_src) {
+        rescale(u.f, ns, (int32_t)(sqrtf((float)ns / ns_src) * (1 << 29)));
+        e -= 3;
+    }
+
+    imdct_window(dt, sr, u.f, PCM_EXP + 2 - e, d, y);
+}
+
+/**
+ * Forward MDCT transformation
+ */
+void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y)
+{
+    lc3_mdct_forward_plan(lc3_mdct_get_plan(dt, sr), sr_dst, x, d, y);
+}
+
+/**
+ * Inverse MDCT transformation
+ */
+void lc3_mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_src, const float *x, float *d, float *y)
+{
+    lc3_mdct_inverse_plan(lc3_mdct_get_plan(dt, sr), sr_src, x, d, y);
+}
+
+#endif /* LC3_FIXED_POINT */
@@ -0,0 +1,421 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Kernels for the Xtensa single precision FPU (ESP32, ESP32-S3)
+ *
+ * The butterflies and rotations are written as chains of fused
+ * multiply-add `madd.s` / multiply-subtract `msub.s`, with the inputs
+ * of a butterfly loaded once in registers. Common products of the
+ * generic code are computed once.
+ */
+
+#if (__XTENSA__ && !__XTENSA_SOFT_FLOAT__ && !defined(TEST_XTENSA)) \
+        || defined(TEST_XTENSA)
+
+#ifndef TEST_XTENSA
+
+/**
+ * Fused multiply-add `a + b*c`, and multiply-subtract `a - b*c`
+ */
+
+static inline float __xt_madd(float a, float b, float c)
+{
+    __asm("madd.s %0, %1, %2" : "+f" (a) : "f" (b), "f" (c));
+    return a;
+}
+
+static inline float __xt_msub(float a, float b, float c)
+{
+    __asm("msub.s %0, %1, %2" : "+f" (a) : "f" (b), "f" (c));
+    return a;
+}
+
+#endif /* TEST_XTENSA */
+
+
+/* ----------------------------------------------------------------------------
+ *  FFT processing
+ * -------------------------------------------------------------------------- */
+
+/**
+ * FFT 5 Points
+ */
+#ifndef fft_5
+
+LC3_HOT static inline void xtensa_fft_5(
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    const float cos1 =  0.3090169944;  /* cos(-2Pi 1/5) */
+    const float cos2 = -0.8090169944;  /* cos(-2Pi 2/5) */
+
+    const float sin1 = -0.9510565163;  /* sin(-2Pi 1/5) */
+    const float sin2 = -0.5877852523;  /* sin(-2Pi 2/5) */
+
+    for (int i = 0; i < n; i++, x++, y+= 5) {
+
+        struct lc3_complex x0 = x[0*n], x1 = x[1*n];
+        struct lc3_complex x2 = x[2*n], x3 = x[3*n], x4 = x[4*n];
+
+        struct lc3_complex s14 = { x1.re + x4.re, x1.im + x4.im };
+        struct lc3_complex d14 = { x1.re - x4.re, x1.im - x4.im };
+        struct lc3_complex s23 = { x2.re + x3.re, x2.im + x3.im };
+        struct lc3_complex d23 = { x2.re - x3.re, x2.im - x3.im };
+
+        /* Outputs 1 and 4, then 2 and 3, share their cosine terms
+         * and differ by the sign of their sine terms */
+
+        struct lc3_complex a, b, c, e;
+
+        a.re = __xt_madd(__xt_madd(x0.re, s14.re, cos1), s23.re, cos2);
+        a.im = __xt_madd(__xt_madd(x0.im, s14.im, cos1), s23.im, cos2);
+        b.re = __xt_madd(d14.im * sin1, d23.im, sin2);
+        b.im = __xt_madd(d14.re * sin1, d23.re, sin2);
+
+        c.re = __xt_madd(__xt_madd(x0.re, s14.re, cos2), s23.re, cos1);
+        c.im = __xt_madd(__xt_madd(x0.im, s14.im, cos2), s23.im, cos1);
+        e.re = __xt_msub(d14.im * sin2, d23.im, sin1);
+        e.im = __xt_msub(d14.re * sin2, d23.re, sin1);
+
+        y[0].re = x0.re + s14.re + s23.re;
+        y[0].im = x0.im + s14.im + s23.im;
+
+        y[1].re = a.re - b.re;  y[1].im = a.im + b.im;
+        y[2].re = c.re - e.re;  y[2].im = c.im + e.im;
+        y[3].re = c.re + e.re;  y[3].im = c.im - e.im;
+        y[4].re = a.re + b.re;  y[4].im = a.im - b.im;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define fft_5 xtensa_fft_5
+#endif
+
+#endif /* fft_5 */
+
+/**
+ * FFT Butterfly 3 Points
+ */
+#ifndef fft_bf3
+
+LC3_HOT static inline void xtensa_fft_bf3(
+    const struct lc3_fft_bf3_twiddles *twiddles,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n3 = twiddles->n3;
+    const struct lc3_complex (*w0)[2] = twiddles->t;
+    const struct lc3_complex (*w1)[2] = w0 + n3, (*w2)[2] = w1 + n3;
+
+    const struct lc3_complex *x0_ptr = x;
+    const struct lc3_complex *x1_ptr = x0_ptr + n*n3;
+    const struct lc3_complex *x2_ptr = x1_ptr + n*n3;
+
+    struct lc3_complex *y0 = y, *y1 = y0 + n3, *y2 = y1 + n3;
+
+    for (int i = 0; i < n; i++, y0 += 3*n3, y1 += 3*n3, y2 += 3*n3)
+        for (int j = 0; j < n3; j++) {
+
+            struct lc3_complex x0 = *(x0_ptr++);
+            struct lc3_complex x1 = *(x1_ptr++);
+            struct lc3_complex x2 = *(x2_ptr++);
+
+            struct lc3_complex wa, wb;
+
+            wa = w0[j][0], wb = w0[j][1];
+            y0[j].re = __xt_msub(__xt_madd(__xt_msub(__xt_madd(x0.re,
+                x1.re, wa.re), x1.im, wa.im), x2.re, wb.re), x2.im, wb.im);
+            y0[j].im = __xt_madd(__xt_madd(__xt_madd(__xt_madd(x0.im,
+                x1.im, wa.re), x1.re, wa.im), x2.im, wb.re), x2.re, wb.im);
+
+            wa = w1[j][0], wb = w1[j][1];
+            y1[j].re = __xt_msub(__xt_madd(__xt_msub(__xt_madd(x0.re,
+                x1.re, wa.re), x1.im, wa.im), x2.re, wb.re), x2.im, wb.im);
+            y1[j].im = __xt_madd(__xt_madd(__xt_madd(__xt_madd(x0.im,
+                x1.im, wa.re), x1.re, wa.im), x2.im, wb.re), x2.re, wb.im);
+
+            wa = w2[j][0], wb = w2[j][1];
+            y2[j].re = __xt_msub(__xt_madd(__xt_msub(__xt_madd(x0.re,
+                x1.re, wa.re), x1.im, wa.im), x2.re, wb.re), x2.im, wb.im);
+            y2[j].im = __xt_madd(__xt_madd(__xt_madd(__xt_madd(x0.im,
+                x1.im, wa.re), x1.re, wa.im), x2.im, wb.re), x2.re, wb.im);
+        }
+}
+
+#ifndef TEST_XTENSA
+#define fft_bf3 xtensa_fft_bf3
+#endif
+
+#endif /* fft_bf3 */
+
+/**
+ * FFT Butterfly 2 Points
+ * The product `x1 w` is computed once, for both outputs
+ */
+#ifndef fft_bf2
+
+LC3_HOT static inline void xtensa_fft_bf2(
+    const struct lc3_fft_bf2_twiddles *twiddles,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles->n2;
+    const struct lc3_complex *w = twiddles->t;
+
+    const struct lc3_complex *x0_ptr = x, *x1_ptr = x0_ptr + n*n2;
+    struct lc3_complex *y0 = y, *y1 = y0 + n2;
+
+    for (int i = 0; i < n; i++, y0 += 2*n2, y1 += 2*n2) {
+
+        for (int j = 0; j < n2; j++) {
+
+            struct lc3_complex x0 = *(x0_ptr++);
+            struct lc3_complex x1 = *(x1_ptr++);
+            struct lc3_complex wj = w[j], t;
+
+            t.re = __xt_msub(x1.re * wj.re, x1.im, wj.im);
+            t.im = __xt_madd(x1.im * wj.re, x1.re, wj.im);
+
+            y0[j].re = x0.re + t.re;  y0[j].im = x0.im + t.im;
+            y1[j].re = x0.re - t.re;  y1[j].im = x0.im - t.im;
+        }
+    }
+}
+
+#ifndef TEST_XTENSA
+#define fft_bf2 xtensa_fft_bf2
+#endif
+
+#endif /* fft_bf2 */
+
+/**
+ * FFT Butterflies 2 Points, of 2 successive stages (radix 2^2)
+ * The butterflies of `xtensa_fft_bf2()`, the first stage kept in registers
+ */
+#ifndef fft_bf4
+
+LC3_HOT static inline void xtensa_fft_bf4(
+    const struct lc3_fft_bf2_twiddles *twiddles_a,
+    const struct lc3_fft_bf2_twiddles *twiddles_b,
+    const struct lc3_complex *x, struct lc3_complex *y, int n)
+{
+    int n2 = twiddles_a->n2;
+    const struct lc3_complex *wa = twiddles_a->t;
+    const struct lc3_complex *wb0 = twiddles_b->t, *wb1 = wb0 + n2;
+
+    const struct lc3_complex *x0_ptr = x, *x1_ptr = x0_ptr + n*n2;
+    const struct lc3_complex *x2_ptr = x0_ptr + (n >> 1)*n2;
+    const struct lc3_complex *x3_ptr = x1_ptr + (n >> 1)*n2;
+
+    struct lc3_complex *y0 = y, *y1 = y0 + n2;
+    struct lc3_complex *y2 = y1 + n2, *y3 = y2 + n2;
+
+    for (int i = 0; i < (n >> 1); i++,
+            y0 += 4*n2, y1 += 4*n2, y2 += 4*n2, y3 += 4*n2) {
+
+        for (int j = 0; j < n2; j++) {
+
+            struct lc3_complex x0 = *(x0_ptr++), x1 = *(x1_ptr++);
+            struct lc3_complex x2 = *(x2_ptr++), x3 = *(x3_ptr++);
+            struct lc3_complex wj = wa[j], u0, u1, v0, v1, t;
+
+            t.re = __xt_msub(x1.re * wj.re, x1.im, wj.im);
+            t.im = __xt_madd(x1.im * wj.re, x1.re, wj.im);
+
+            u0.re = x0.re + t.re;  u0.im = x0.im + t.im;
+            u1.re = x0.re - t.re;  u1.im = x0.im - t.im;
+
+            t.re = __xt_msub(x3.re * wj.re, x3.im, wj.im);
+            t.im = __xt_madd(x3.im * wj.re, x3.re, wj.im);
+
+            v0.re = x2.re + t.re;  v0.im = x2.im + t.im;
+            v1.re = x2.re - t.re;  v1.im = x2.im - t.im;
+
+            wj = wb0[j];
+            t.re = __xt_msub(v0.re * wj.re, v0.im, wj.im);
+            t.im = __xt_madd(v0.im * wj.re, v0.re, wj.im);
+
+            y0[j].re = u0.re + t.re;  y0[j].im = u0.im + t.im;
+            y2[j].re = u0.re - t.re;  y2[j].im = u0.im - t.im;
+
+            wj = wb1[j];
+            t.re = __xt_msub(v1.re * wj.re, v1.im, wj.im);
+            t.im = __xt_madd(v1.im * wj.re, v1.re, wj.im);
+
+            y1[j].re = u1.re + t.re;  y1[j].im = u1.im + t.im;
+            y3[j].re = u1.re - t.re;  y3[j].im = u1.im - t.im;
+        }
+    }
+}
+
+#ifndef TEST_XTENSA
+#define fft_bf4 xtensa_fft_bf4
+#endif
+
+#endif /* fft_bf4 */
+
+
+/* ----------------------------------------------------------------------------
+ *  MDCT processing
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Pre-rotate MDCT coefficients of N/2 points, before FFT N/4 points FFT
+ * All inputs of an iteration are read before its outputs are written,
+ * `x` and `y` can be the same buffer
+ */
+#ifndef mdct_pre_fft
+
+LC3_HOT static void xtensa_mdct_pre_fft(const struct lc3_mdct_rot_def *def,
+    const float *x, struct lc3_complex *y)
+{
+    int n4 = def->n4;
+
+    const float *x0 = x, *x1 = x0 + 2*n4;
+    const struct lc3_complex *w0 = def->w, *w1 = w0 + n4;
+    struct lc3_complex *y0 = y, *y1 = y0 + n4;
+
+    while (x0 < x1) {
+        float a = x0[0], b = x0[1], c = x1[-1], d = x1[-2];
+        struct lc3_complex uw = *(w0++), vw = *(--w1), u, v;
+
+        x0 += 2, x1 -= 2;
+
+        u.re = __xt_msub(a * uw.im, c, uw.re);
+        u.im = __xt_madd(a * uw.re, c, uw.im);
+
+        v.re = __xt_msub(b * vw.re, d, vw.im);
+        v.im = __xt_msub(-b * vw.im, d, vw.re);
+
+        *(y0++) = u;
+        *(--y1) = v;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define mdct_pre_fft xtensa_mdct_pre_fft
+#endif
+
+#endif /* mdct_pre_fft */
+
+/**
+ * Post-rotate FFT N/4 points coefficients, resulting MDCT N points
+ */
+#ifndef mdct_post_fft
+
+LC3_HOT static void xtensa_mdct_post_fft(const struct lc3_mdct_rot_def *def,
+    const struct lc3_complex *x, float *y)
+{
+    int n4 = def->n4, n8 = n4 >> 1;
+
+    const struct lc3_complex *w0 = def->w + n8, *w1 = w0 - 1;
+    const struct lc3_complex *x0 = x + n8, *x1 = x0 - 1;
+
+    float *y0 = y + n4, *y1 = y0;
+
+    for ( ; y1 > y; x0++, x1--, w0++, w1--) {
+
+        struct lc3_complex u = *x0, v = *x1;
+        struct lc3_complex uw = *w0, vw = *w1;
+
+        float u0 = __xt_madd(u.im * uw.im, u.re, uw.re);
+        float u1 = __xt_msub(v.re * vw.im, v.im, vw.re);
+
+        float v0 = __xt_msub(u.re * uw.im, u.im, uw.re);
+        float v1 = __xt_madd(v.im * vw.im, v.re, vw.re);
+
+        *(y0++) = u0;  *(y0++) = u1;
+        *(--y1) = v0;  *(--y1) = v1;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define mdct_post_fft xtensa_mdct_post_fft
+#endif
+
+#endif /* mdct_post_fft */
+
+/**
+ * Pre-rotate IMDCT coefficients of N points, before FFT N/4 points FFT
+ */
+#ifndef imdct_pre_fft
+
+LC3_HOT static void xtensa_imdct_pre_fft(const struct lc3_mdct_rot_def *def,
+    const float *x, struct lc3_complex *y)
+{
+    int n4 = def->n4;
+
+    const float *x0 = x, *x1 = x0 + 2*n4;
+
+    const struct lc3_complex *w0 = def->w, *w1 = w0 + n4;
+    struct lc3_complex *y0 = y, *y1 = y0 + n4;
+
+    while (x0 < x1) {
+        float u0 = *(x0++), u1 = *(--x1);
+        float v0 = *(x0++), v1 = *(--x1);
+        struct lc3_complex uw = *(w0++), vw = *(--w1), u, v;
+
+        u.re = __xt_msub(-u0 * uw.re, u1, uw.im);
+        u.im = __xt_madd(-u1 * uw.re, u0, uw.im);
+
+        v.re = __xt_msub(-v1 * vw.re, v0, vw.im);
+        v.im = __xt_madd(-v0 * vw.re, v1, vw.im);
+
+        *(y0++) = u;
+        *(--y1) = v;
+    }
+}
+
+#ifndef TEST_XTENSA
+#define imdct_pre_fft xtensa_imdct_pre_fft
+#endif
+
+#endif /* imdct_pre_fft */
+
+/**
+ * Post-rotate FFT N/4 points coefficients, resulting IMDCT N points
+ */
+#ifndef imdct_post_fft
+
+LC3_HOT static void xtensa_imdct_post_fft(const struct lc3_mdct_rot_def *def,
+    const struct lc3_complex *x, float *y)
+{
+    int n4 = def->n4;
+
+    const struct lc3_complex *w0 = def->w, *w1 = w0 + n4;
+    const struct lc3_complex *x0 = x, *x1 = x0 + n4;
+
+    float *y0 = y, *y1 = y0 + 2*n4;
+
+    while (x0 < x1) {
+        struct lc3_complex uz = *(x0++), vz = *(--x1);
+        struct lc3_complex uw = *(w0++), vw = *(--w1);
+
+        *(y0++) = __xt_msub(uz.re * uw.im, uz.im, uw.re);
+        *(--y1) = __xt_madd(uz.re * uw.re, uz.im, uw.im);
+
+        *(--y1) = __xt_msub(vz.re * vw.im, vz.im, vw.re);
+        *(y0++) = __xt_madd(vz.re * vw.re, vz.im, vw.im);
+    }
+}
+
+#ifndef TEST_XTENSA
+#define imdct_post_fft xtensa_imdct_post_fft
+#endif
+
+#endif /* imdct_post_fft */
+
+#endif /* __XTENSA__ && !__XTENSA_SOFT_FLOAT__ */
@@ -18,6 +18,7 @@
 
 #include "sns.h"
 #include "tables.h"
+#include "sns_fixed.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -32,6 +33,7 @@
  *   k = [0..N-1], n = [0..N-1], N = 16
  *   f = sqrt(1/4N) for k=0, sqrt(1/2N) otherwise
  */
+#if !defined(dct16_forward) || !defined(dct16_inverse)
 static const float dct16_m[16][16] = {
 
     {  2.50000000e-01,  3.51850934e-01,  3.46759961e-01,  3.38329500e-01,
@@ -115,28 +117,33 @@ static const float dct16_m[16][16] = {
        1.35299025e-01, -1.02631132e-01,  6.89748448e-02, -3.46542923e-02 },
 
 };
+#endif /* dct16_forward || dct16_inverse */
 
 /**
  * Forward DCT-16 transformation
  * x, y            Input and output 16 values
  */
+#ifndef dct16_forward
 LC3_HOT static void dct16_forward(const float *x, float *y)
 {
     for (int i = 0, j; i < 16; i++)
         for (y[i] = 0, j = 0; j < 16; j++)
             y[i] += x[j] * dct16_m[j][i];
 }
+#endif /* dct16_forward */
 
 /**
  * Inverse DCT-16 transformation
  * x, y            Input and output 16 values
  */
+#ifndef dct16_inverse
 LC3_HOT static void dct16_inverse(const float *x, float *y)
 {
     for (int i = 0, j; i < 16; i++)
         for (y[i] = 0, j = 0; j < 16; j++)
             y[i] += x[j] * dct16_m[i][j];
 }
+#endif /* dct16_inverse */
 
 
 /* ----------------------------------------------------------------------------
@@ -150,6 +157,7 @@ LC3_HOT static void dct16_inverse(const float *x, float *y)
  * att             1: Attack detected  0: Otherwise
  * scf             Output 16 scale factors
  */
+#ifndef compute_scale_factors
 LC3_HOT static void compute_scale_factors(
     enum lc3_dt dt, enum lc3_srate sr,
     const float *eb, bool att, float *scf)
@@ -338,12 +346,14 @@ LC3_HOT static void compute_scale_factors(
         scf[i] = (dt == LC3_DT_7M5 ? 0.3f : 0.5f) *
                  (scf[i] - scf_sum * 1.f/16);
 }
+#endif /* compute_scale_factors */
 
 /**
  * Codebooks
  * scf             Input 16 scale factors
  * lf/hfcb_idx     Output the low and high frequency codebooks index
  */
+#ifndef resolve_codebooks
 LC3_HOT static void resolve_codebooks(
     const float *scf, int *lfcb_idx, int *hfcb_idx)
 {
@@ -367,6 +377,7 @@ LC3_HOT static void resolve_codebooks(
             *hfcb_idx = icb, dhfcb_max = dhfcb;
     }
 }
+#endif /* resolve_codebooks */
 
 /**
  * Unit energy normalize pulse configuration
@@ -391,6 +402,7 @@ LC3_HOT static void normalize(const int *c, float *cn)
  * start, end      Current number of pulses, limit to reach
  * corr, energy    Correlation (x,y) and y energy, updated at output
  */
+#ifndef search_shapes
 LC3_HOT static void add_pulse(const float *x, int *y, int n,
     int start, int end, float *corr, float *energy)
 {
@@ -414,28 +426,15 @@ LC3_HOT static void add_pulse(const float *x, int *y, int n,
 }
 
 /**
- * Quantization of codebooks residual
- * scf             Input 16 scale factors, output quantized version
- * lf/hfcb_idx     Codebooks index
- * c, cn           Output 4 pulse configurations candidates, normalized
- * shape/gain_idx  Output selected shape/gain indexes
+ * Sub-procedure of `quantize()`, search of the pulse configurations
+ * x               Transformed residual
+ * c               Output the 4 shape candidates, not signed
+ * corr, energy    Output the correlation with `|x|` and the energy,
+ *                 of each shape candidate
  */
-LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
-    int (*c)[16], float (*cn)[16], int *shape_idx, int *gain_idx)
+LC3_HOT static void search_shapes(
+    const float *x, int (*c)[16], float *corr_c, float *energy_c)
 {
-    /* --- Residual --- */
-
-    const float *lfcb = lc3_sns_lfcb[lfcb_idx];
-    const float *hfcb = lc3_sns_hfcb[hfcb_idx];
-    float r[16], x[16];
-
-    for (int i = 0; i < 8; i++) {
-        r[  i] = scf[  i] - lfcb[i];
-        r[8+i] = scf[8+i] - hfcb[i];
-    }
-
-    dct16_forward(r, x);
-
     /* --- Shape 3 candidate ---
      * Project to or below pyramid N = 16, K = 6,
      * then add unit pulses until you reach K = 6, over N = 16 */
@@ -453,7 +452,7 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
     int npulses = 0;
 
     for (int i = 0; i < 16; i++) {
-        c[3][i] = floorf(xm[i] * proj_factor);
+        c[3][i] = (int)(xm[i] * proj_factor);
         npulses += c[3][i];
         corr    += c[3][i] * xm[i];
         energy  += c[3][i] * c[3][i];
@@ -462,6 +461,8 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
     add_pulse(xm, c[3], 16, npulses, 6, &corr, &energy);
     npulses = 6;
 
+    corr_c[3] = corr, energy_c[3] = energy;
+
     /* --- Shape 2 candidate ---
      * Add unit pulses until you reach K = 8 on shape 3 */
 
@@ -470,6 +471,8 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
     add_pulse(xm, c[2], 16, npulses, 8, &corr, &energy);
     npulses = 8;
 
+    corr_c[2] = corr, energy_c[2] = energy;
+
     /* --- Shape 1 candidate ---
      * Remove any unit pulses from shape 2 that are not part of 0 to 9
      * Update energy and correlation terms accordingly
@@ -487,6 +490,8 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
     add_pulse(xm, c[1], 10, npulses, 10, &corr, &energy);
     npulses = 10;
 
+    corr_c[1] = corr, energy_c[1] = energy;
+
     /* --- Shape 0 candidate ---
      * Add unit pulses until you reach K = 1, on shape 1 */
 
@@ -494,44 +499,132 @@ LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
 
     add_pulse(xm + 10, c[0] + 10, 6, 0, 1, &corr, &energy);
 
-    /* --- Add sign and unit energy normalize --- */
+    corr_c[0] = corr, energy_c[0] = energy;
+}
+#endif /* search_shapes */
 
-    for (int j = 0; j < 16; j++)
-        for (int i = 0; i < 4; i++)
-            c[i][j] = x[j] < 0 ? -c[i][j] : c[i][j];
+/**
+ * Sub-procedure of `quantize()`, sign and normalize a pulse configuration
+ * x               Transformed residual, giving the signs
+ * c, cn           Pulse configuration signed, and normalized as output
+ */
+LC3_HOT static void sign_normalize(const float *x, int *c, float *cn)
+{
+    for (int i = 0; i < 16; i++)
+        c[i] = x[i] < 0 ? -c[i] : c[i];
 
-    for (int i = 0; i < 4; i++)
-        normalize(c[i], cn[i]);
+    normalize(c, cn);
+}
 
-    /* --- Determe shape & gain index ---
-     * Search the Mean Square Error, within (shape, gain) combinations */
+/**
+ * Sub-procedure of `quantize()`, mean square error of a gain and shape
+ * x, cn           Transformed residual, and normalized pulse configuration
+ * g               Gain
+ * return          The mean square error
+ */
+LC3_HOT static float shape_gain_mse(const float *x, const float *cn, float g)
+{
+    float mse = 0;
+    for (int i = 0; i < 16; i++)
+        mse += (x[i] - g * cn[i]) * (x[i] - g * cn[i]);
 
-    float mse_min = INFINITY;
-    *shape_idx = *gain_idx = 0;
+    return mse;
+}
 
-    for (int ic = 0; ic < 4; ic++) {
+/**
+ * Quantization of codebooks residual
+ * scf             Input 16 scale factors, output quantized version
+ * lf/hfcb_idx     Codebooks index
+ * nshapes         Number of shapes searched, 4 or the 2 regular ones
+ * c, cn           Output pulse configurations candidates, and normalized
+ *                 version, only the selected one is signed and normalized
+ * shape/gain_idx  Output selected shape/gain indexes
+ */
+LC3_HOT static void quantize(const float *scf, int lfcb_idx, int hfcb_idx,
+    int nshapes, int (*c)[16], float (*cn)[16], int *shape_idx, int *gain_idx)
+{
+    /* --- Residual --- */
+
+    const float *lfcb = lc3_sns_lfcb[lfcb_idx];
+    const float *hfcb = lc3_sns_hfcb[hfcb_idx];
+    float r[16], x[16];
+
+    for (int i = 0; i < 8; i++) {
+        r[  i] = scf[  i] - lfcb[i];
+        r[8+i] = scf[8+i] - hfcb[i];
+    }
+
+    dct16_forward(r, x);
+
+    /* --- Shape candidates --- */
+
+    float corr_c[4], energy_c[4];
+    float x2_sum = 0;
+
+    for (int i = 0; i < 16; i++)
+        x2_sum += x[i] * x[i];
+
+    search_shapes(x, c, corr_c, energy_c);
+
+    /* --- Determine shape & gain index ---
+     * Search the Mean Square Error, within (shape, gain) combinations.
+     * The correlation and energy tracked while adding the pulses
+     * give the MSE of each combination, without the normalized shapes :
+     *
+     *   mse = |x|^2 - 2 g (x,c) / |c| + g^2
+     *
+     * The first combination of the minimal MSE is selected. The ones
+     * within rounding errors of the minimum, including exact ties, are
+     * resolved as the exhaustive search does, on the normalized shapes. */
+
+    float mse[4][8], mse_min = INFINITY;
+
+    for (int ic = 0; ic < nshapes; ic++) {
         const struct lc3_sns_vq_gains *cgains = lc3_sns_vq_gains + ic;
-        float cmse_min = INFINITY;
-        int cgain_idx = 0;
+        float b = 2 * corr_c[ic] / sqrtf(energy_c[ic]);
 
         for (int ig = 0; ig < cgains->count; ig++) {
             float g = cgains->v[ig];
 
-            float mse = 0;
-            for (int i = 0; i < 16; i++)
-                mse += (x[i] - g * cn[ic][i]) * (x[i] - g * cn[ic][i]);
+            mse[ic][ig] = x2_sum - g * b + g * g;
+            mse_min = fminf(mse_min, mse[ic][ig]);
+        }
+    }
+
+    float mse_tol = 1e-4f * (x2_sum + 32);
+    int ncandidates = 0;
+
+    for (int ic = 0; ic < nshapes; ic++)
+        for (int ig = 0; ig < lc3_sns_vq_gains[ic].count; ig++)
+            if (mse[ic][ig] <= mse_min + mse_tol && ncandidates++ == 0)
+                *shape_idx = ic, *gain_idx = ig;
+
+    if (ncandidates > 1) {
+        float cmse_min = INFINITY;
+        int normalized = 0;
+
+        for (int ic = 0; ic < nshapes; ic++) {
+            const struct lc3_sns_vq_gains *cgains = lc3_sns_vq_gains + ic;
 
-            if (mse < cmse_min) {
-                cgain_idx = ig,
-                cmse_min = mse;
+            for (int ig = 0; ig < cgains->count; ig++) {
+                if (mse[ic][ig] > mse_min + mse_tol)
+                    continue;
+
+                if (!(normalized & (1 << ic)))
+                    sign_normalize(x, c[ic], cn[ic]);
+                normalized |= 1 << ic;
+
+                float cmse = shape_gain_mse(x, cn[ic], cgains->v[ig]);
+                if (cmse < cmse_min)
+                    *shape_idx = ic, *gain_idx = ig, cmse_min = cmse;
             }
         }
 
-        if (cmse_min < mse_min) {
-            *shape_idx = ic, *gain_idx = cgain_idx;
-            mse_min = cmse_min;
-        }
+        if (normalized & (1 << *shape_idx))
+            return;
     }
+
+    sign_normalize(x, c[*shape_idx], cn[*shape_idx]);
 }
 
 /**
@@ -675,6 +768,7 @@ static void deenumerate(int shape,
  *
  * `x` and `y` can be the same buffer
  */
+#ifndef spectral_shaping
 LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
     const float *scf_q, bool inv, const float *x, float *y)
 {
@@ -714,6 +808,7 @@ LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
             y[i] = x[i] * g_sns;
     }
 }
+#endif /* spectral_shaping */
 
 
 /* ----------------------------------------------------------------------------
@@ -724,7 +819,7 @@ LC3_HOT static void spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
  * SNS analysis
  */
 void lc3_sns_analyze(enum lc3_dt dt, enum lc3_srate sr,
-    const float *eb, bool att, struct lc3_sns_data *data,
+    const float *eb, bool att, bool reduced, struct lc3_sns_data *data,
     const float *x, float *y)
 {
     /* Processing steps :
@@ -741,7 +836,7 @@ void lc3_sns_analyze(enum lc3_dt dt, enum lc3_srate sr,
 
     resolve_codebooks(scf, &data->lfcb, &data->hfcb);
 
-    quantize(scf, data->lfcb, data->hfcb,
+    quantize(scf, data->lfcb, data->hfcb, reduced ? 2 : 4,
         c, cn, &data->shape, &data->gain);
 
     unquantize(data->lfcb, data->hfcb,
@@ -51,6 +51,7 @@ typedef struct lc3_sns_data {
  * dt, sr          Duration and samplerate of the frame
  * eb              Energy estimation per bands, and count of bands
  * att             1: Attack detected  0: Otherwise
+ * reduced         Search the regular shapes only, on reduced complexity
  * data            Return bitstream data
  * x               Spectral coefficients
  * y               Return shapped coefficients
@@ -58,7 +59,7 @@ typedef struct lc3_sns_data {
  * `x` and `y` can be the same buffer
  */
 void lc3_sns_analyze(enum lc3_dt dt, enum lc3_srate sr,
-    const float *eb, bool att, lc3_sns_data_t *data,
+    const float *eb, bool att, bool reduced, lc3_sns_data_t *data,
     const float *x, float *y);
 
 /**
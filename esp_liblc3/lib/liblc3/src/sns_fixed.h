@@ -0,0 +1,422 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Fixed point kernels, for targets without floating point unit
+ *
+ * The 16 scale factors are exchanged in float between the kernels,
+ * and computed in Q20 :
+ *
+ * - The band energies are converted as block floating point,
+ *   smoothed, and taken to the logarithm domain where the pre-emphasis
+ *   is an addition. The energy sum, giving the noise floor, is
+ *   accumulated back in linear domain, relatively to the largest term.
+ * - The residual of codebooks is transformed and searched for pulses
+ *   as integers. The selection of the shape and gain, over 16 values,
+ *   is left in float.
+ * - The gains of the spectral shaping are exponentiated in fixed point,
+ *   and applied on the binary representation of the coefficients.
+ */
+
+#if LC3_FIXED_POINT
+
+
+/**
+ * Multiply by a constant
+ * x, c            Value lower than 2^30, and constant in Q31
+ * return          `x * c`
+ */
+static inline int32_t fixed_mul_q31(int32_t x, int32_t c)
+{
+    return lc3_mulh(2 * x, c);
+}
+
+
+/**
+ * DCT-16 transformations
+ */
+#ifndef dct16_forward
+
+LC3_HOT static void fixed_dct16(const float *x, float *y, bool inv)
+{
+    int32_t xf[16];
+    int e = lc3_fixed_exp(x, 16, 28);
+
+    for (int i = 0; i < 16; i++)
+        xf[i] = lc3_fixed_from_float(x[i], e);
+
+    /* The transform is orthonormal, the output magnitudes are lower
+     * than 4 times the largest input one */
+
+    for (int i = 0; i < 16; i++) {
+        int64_t v = 0;
+
+        for (int j = 0; j < 16; j++)
+            v += (int64_t)xf[j] *
+                (inv ? lc3_sns_dct16_q31[i][j] : lc3_sns_dct16_q31[j][i]);
+
+        y[i] = lc3_fixed_to_float((int32_t)(v >> 31), e);
+    }
+}
+
+static void fixed_dct16_forward(const float *x, float *y)
+{
+    fixed_dct16(x, y, false);
+}
+
+static void fixed_dct16_inverse(const float *x, float *y)
+{
+    fixed_dct16(x, y, true);
+}
+
+#define dct16_forward fixed_dct16_forward
+#define dct16_inverse fixed_dct16_inverse
+
+#endif /* dct16_forward */
+
+/**
+ * Scale factors
+ */
+#ifndef compute_scale_factors
+
+LC3_HOT static void fixed_compute_scale_factors(
+    enum lc3_dt dt, enum lc3_srate sr,
+    const float *eb, bool att, float *scf)
+{
+    /* Slope of the pre-emphasis, in logarithm domain :
+     * log2(Ge[b]) = b * g_tilt * log2(10) / 630, in Q24 */
+
+    static const int32_t ge_slope[LC3_NUM_SRATE] = {
+        [LC3_SRATE_8K ] = 1238505, [LC3_SRATE_16K] = 1592363,
+        [LC3_SRATE_24K] = 1946221, [LC3_SRATE_32K] = 2300080,
+        [LC3_SRATE_48K] = 2653938,
+    };
+
+    int32_t e[LC3_NUM_BANDS];
+
+    /* --- Copy and padding --- */
+
+    int nb = LC3_MIN(lc3_band_lim[dt][sr][LC3_NUM_BANDS], LC3_NUM_BANDS);
+    int n2 = LC3_NUM_BANDS - nb;
+    int ee = lc3_fixed_exp(eb, nb, 30);
+
+    for (int i2 = 0; i2 < n2; i2++)
+        e[2*i2 + 0] = e[2*i2 + 1] = lc3_fixed_from_float(eb[i2], ee);
+
+    for (int i = n2; i < nb; i++)
+        e[n2 + i] = lc3_fixed_from_float(eb[i], ee);
+
+    /* --- Smoothing, pre-emphasis and logarithm ---
+     * The logarithms, in Q24, are floored to -64. It leaves the
+     * noise floor, not lower than -32, unchanged. */
+
+    int32_t l[LC3_NUM_BANDS], l_max = -(64 << 24);
+
+    for (int i = 0; i < LC3_NUM_BANDS; i++) {
+        uint32_t s = ((uint32_t)e[LC3_MAX(i-1, 0)] + 2 * (uint32_t)e[i] +
+                      (uint32_t)e[LC3_MIN(i+1, LC3_NUM_BANDS-1)]) >> 2;
+
+        l[i] = s == 0 ? -(64 << 24) : LC3_MAX(-(64 << 24),
+            lc3_fixed_log2(s) - ee * (1 << 24) + i * ge_slope[sr]);
+        l_max = LC3_MAX(l_max, l[i]);
+    }
+
+    /* --- Noise floor ---
+     * The sum is taken relatively to the largest term,
+     * the terms lower by more than 2^24 are neglected */
+
+    int32_t e_sum = 0;
+
+    for (int i = 0; i < LC3_NUM_BANDS; i++) {
+        int32_t m;
+        int s;
+
+        if (l[i] < l_max - (24 << 24))
+            continue;
+
+        m = lc3_fixed_exp2(l[i] - l_max, &s);
+        e_sum += m >> (s - 24);
+    }
+
+    const int32_t log2_nf = -323594117;  /* log2(1e-4 / 64), Q24 */
+
+    int32_t noise_floor = LC3_MAX(-(32 << 24),
+        lc3_fixed_log2(e_sum) - (24 << 24) + l_max + log2_nf);
+
+    /* The logarithms are halved, and brought to Q20 */
+
+    for (int i = 0; i < LC3_NUM_BANDS; i++)
+        e[i] = LC3_MAX(l[i], noise_floor) >> 5;
+
+    /* --- Grouping & scaling --- */
+
+    const int32_t c_1_12 = 178956971;  /* 1/12 in Q31 */
+    int32_t scf_q[16], scf_sum;
+
+    scf_q[0] = fixed_mul_q31((e[0] + e[4]) + (e[0] + e[3]) * 2 +
+                             (e[1] + e[2]) * 3, c_1_12);
+    scf_sum = scf_q[0];
+
+    for (int i = 1; i < 15; i++) {
+        scf_q[i] = fixed_mul_q31((e[4*i-1] + e[4*i+4]) +
+                                 (e[4*i  ] + e[4*i+3]) * 2 +
+                                 (e[4*i+1] + e[4*i+2]) * 3, c_1_12);
+        scf_sum += scf_q[i];
+    }
+
+    scf_q[15] = fixed_mul_q31((e[59] + e[63]) + (e[60] + e[63]) * 2 +
+                              (e[61] + e[62]) * 3, c_1_12);
+    scf_sum += scf_q[15];
+
+    for (int i = 0; i < 16; i++)
+        scf_q[i] = fixed_mul_q31(scf_q[i] - (scf_sum >> 4), 1825361101);
+
+    /* --- Attack handling --- */
+
+    if (att) {
+        const int32_t c_1_3 = 715827883, c_1_5 = 429496730;
+
+        int32_t s0, s1 = scf_q[0], s2 = scf_q[1], s3 = scf_q[2],
+                s4 = scf_q[3];
+        int32_t sn = s1 + s2;
+
+        scf_q[0] = fixed_mul_q31(sn += s3, c_1_3);
+        scf_q[1] = (sn += s4) >> 2;
+        scf_sum = scf_q[0] + scf_q[1];
+
+        for (int i = 2; i < 14; i++, sn -= s0) {
+            s0 = s1, s1 = s2, s2 = s3, s3 = s4, s4 = scf_q[i+2];
+            scf_q[i] = fixed_mul_q31(sn += s4, c_1_5);
+            scf_sum += scf_q[i];
+        }
+
+        scf_q[14] = (sn      ) >> 2;
+        scf_q[15] = fixed_mul_q31(sn -= s1, c_1_3);
+        scf_sum += scf_q[14] + scf_q[15];
+
+        for (int i = 0; i < 16; i++)
+            scf_q[i] = dt == LC3_DT_7M5 ?
+                fixed_mul_q31(scf_q[i] - (scf_sum >> 4), 644245094) :
+                (scf_q[i] - (scf_sum >> 4)) >> 1;
+    }
+
+    for (int i = 0; i < 16; i++)
+        scf[i] = lc3_fixed_to_float(scf_q[i], 20);
+}
+
+#define compute_scale_factors fixed_compute_scale_factors
+
+#endif /* compute_scale_factors */
+
+/**
+ * Codebooks
+ */
+#ifndef resolve_codebooks
+
+LC3_HOT static void fixed_resolve_codebooks(
+    const float *scf, int *lfcb_idx, int *hfcb_idx)
+{
+    int32_t s[16];
+    int64_t dlfcb_max = 0, dhfcb_max = 0;
+    *lfcb_idx = *hfcb_idx = 0;
+
+    for (int i = 0; i < 16; i++)
+        s[i] = lc3_fixed_from_float(scf[i], 20);
+
+    for (int icb = 0; icb < 32; icb++) {
+        const int32_t *lfcb = lc3_sns_lfcb_q20[icb];
+        const int32_t *hfcb = lc3_sns_hfcb_q20[icb];
+        int64_t dlfcb = 0, dhfcb = 0;
+
+        for (int i = 0; i < 8; i++) {
+            int32_t dl = s[  i] - lfcb[i];
+            int32_t dh = s[8+i] - hfcb[i];
+
+            dlfcb += (int64_t)dl * dl;
+            dhfcb += (int64_t)dh * dh;
+        }
+
+        if (icb == 0 || dlfcb < dlfcb_max)
+            *lfcb_idx = icb, dlfcb_max = dlfcb;
+
+        if (icb == 0 || dhfcb < dhfcb_max)
+            *hfcb_idx = icb, dhfcb_max = dhfcb;
+    }
+}
+
+#define resolve_codebooks fixed_resolve_codebooks
+
+#endif /* resolve_codebooks */
+
+/**
+ * Search of the pulse configurations
+ */
+#ifndef search_shapes
+
+LC3_HOT static void fixed_add_pulse(const int32_t *x, int *y, int n,
+    int start, int end, int32_t *corr, int *energy)
+{
+    for (int k = start; k < end; k++) {
+        uint32_t best_c2 = (uint32_t)(*corr + x[0]) * (*corr + x[0]);
+        int best_e = *energy + 2*y[0] + 1;
+        int nbest = 0;
+
+        for (int i = 1; i < n; i++) {
+            uint32_t c2 = (uint32_t)(*corr + x[i]) * (*corr + x[i]);
+            int e = *energy + 2*y[i] + 1;
+
+            if ((uint64_t)c2 * best_e > (uint64_t)best_c2 * e)
+                best_c2 = c2, best_e = e, nbest = i;
+        }
+
+        *corr += x[nbest];
+        *energy += 2*y[nbest] + 1;
+        y[nbest]++;
+    }
+}
+
+LC3_HOT static void fixed_search_shapes(
+    const float *x, int (*c)[16], float *corr_c, float *energy_c)
+{
+    /* The magnitudes are brought lower than 2^12. The correlations,
+     * over at most 11 pulses, are then lower than 2^16 and their
+     * squares hold on 32 bits. */
+
+    int e = lc3_fixed_exp(x, 16, 12);
+    int32_t xm[16], xm_sum = 0;
+
+    for (int i = 0; i < 16; i++) {
+        xm[i] = LC3_ABS(lc3_fixed_from_float(x[i], e));
+        xm_sum += xm[i];
+    }
+
+    /* --- Shape 3 candidate --- */
+
+    int32_t corr = 0;
+    int energy = 0, npulses = 0;
+
+    for (int i = 0; i < 16; i++) {
+        c[3][i] = xm_sum > 0 ? (6 - 1) * xm[i] / xm_sum : 0;
+        npulses += c[3][i];
+        corr    += c[3][i] * xm[i];
+        energy  += c[3][i] * c[3][i];
+    }
+
+    fixed_add_pulse(xm, c[3], 16, npulses, 6, &corr, &energy);
+    npulses = 6;
+
+    corr_c[3] = lc3_fixed_to_float(corr, e), energy_c[3] = energy;
+
+    /* --- Shape 2 candidate --- */
+
+    memcpy(c[2], c[3], sizeof(c[2]));
+
+    fixed_add_pulse(xm, c[2], 16, npulses, 8, &corr, &energy);
+    npulses = 8;
+
+    corr_c[2] = lc3_fixed_to_float(corr, e), energy_c[2] = energy;
+
+    /* --- Shape 1 candidate --- */
+
+    memcpy(c[1], c[2], sizeof(c[1]));
+
+    for (int i = 10; i < 16; i++) {
+        c[1][i] = 0;
+        npulses -= c[2][i];
+        corr    -= c[2][i] * xm[i];
+        energy  -= c[2][i] * c[2][i];
+    }
+
+    fixed_add_pulse(xm, c[1], 10, npulses, 10, &corr, &energy);
+    npulses = 10;
+
+    corr_c[1] = lc3_fixed_to_float(corr, e), energy_c[1] = energy;
+
+    /* --- Shape 0 candidate --- */
+
+    memcpy(c[0], c[1], sizeof(c[0]));
+
+    fixed_add_pulse(xm + 10, c[0] + 10, 6, 0, 1, &corr, &energy);
+
+    corr_c[0] = lc3_fixed_to_float(corr, e), energy_c[0] = energy;
+}
+
+#define search_shapes fixed_search_shapes
+
+#endif /* search_shapes */
+
+/**
+ * Spectral shaping
+ */
+#ifndef spectral_shaping
+
+LC3_HOT static void fixed_spectral_shaping(enum lc3_dt dt, enum lc3_srate sr,
+    const float *scf_q, bool inv, const float *x, float *y)
+{
+    /* --- Interpolate scale factors ---
+     * The scale factors, in Q20, are limited to +/- 32 */
+
+    int32_t scf[LC3_NUM_BANDS], q[16];
+
+    for (int i = 0; i < 16; i++) {
+        int32_t v = lc3_fixed_from_float(scf_q[i], 20);
+        v = LC3_CLIP(v, -(32 << 20), 32 << 20);
+        q[i] = inv ? -v : v;
+    }
+
+    int32_t s0, s1 = q[0];
+
+    scf[0] = scf[1] = s1;
+    for (int i = 0; i < 15; i++) {
+        s0 = s1, s1 = q[i+1];
+        scf[4*i+2] = s0 + (    (s1 - s0) >> 3);
+        scf[4*i+3] = s0 + (3 * (s1 - s0) >> 3);
+        scf[4*i+4] = s0 + (5 * (s1 - s0) >> 3);
+        scf[4*i+5] = s0 + (7 * (s1 - s0) >> 3);
+    }
+    scf[62] = s1 + (    (s1 - s0) >> 3);
+    scf[63] = s1 + (3 * (s1 - s0) >> 3);
+
+    int nb = LC3_MIN(lc3_band_lim[dt][sr][LC3_NUM_BANDS], LC3_NUM_BANDS);
+    int n2 = LC3_NUM_BANDS - nb;
+
+    for (int i2 = 0; i2 < n2; i2++)
+        scf[i2] = (scf[2*i2] + scf[2*i2+1]) >> 1;
+
+    if (n2 > 0)
+        memmove(scf + n2, scf + 2*n2, (nb - n2) * sizeof(*scf));
+
+    /* --- Spectral shaping --- */
+
+    const int *lim = lc3_band_lim[dt][sr];
+
+    for (int i = 0, ib = 0; ib < nb; ib++) {
+        int e;
+        int32_t m = lc3_fixed_exp2(-scf[ib] * 16, &e);
+        float g_sns = lc3_fixed_to_float(m, e);
+
+        for ( ; i < lim[ib+1]; i++)
+            y[i] = lc3_float_mul(x[i], g_sns);
+    }
+}
+
+#define spectral_shaping fixed_spectral_shaping
+
+#endif /* spectral_shaping */
+
+#endif /* LC3_FIXED_POINT */
@@ -19,6 +19,7 @@
 #include "spec.h"
 #include "bits.h"
 #include "tables.h"
+#include "spec_fixed.h"
 
 
 /* ----------------------------------------------------------------------------
@@ -36,6 +37,35 @@ static int resolve_gain_offset(enum lc3_srate sr, int nbytes)
     return 105 + 5*(1 + sr) + LC3_MIN(g_off, 115);
 }
 
+/**
+ * Energy (dB) by 4 MDCT blocks
+ * x, n            Spectral coefficients, and count of blocks
+ * e               Output the energies in dB, in fixed Q16
+ * return          The largest square of the coefficients
+ */
+#ifndef compute_block_energies
+LC3_HOT static float compute_block_energies(const float *x, int n, int *e)
+{
+    float x2_max = 0;
+
+    for (int i = 0; i < n; i++, x += 4) {
+        float x0 = x[0] * x[0];
+        float x1 = x[1] * x[1];
+        float x2 = x[2] * x[2];
+        float x3 = x[3] * x[3];
+
+        x2_max = fmaxf(x2_max, x0);
+        x2_max = fmaxf(x2_max, x1);
+        x2_max = fmaxf(x2_max, x2);
+        x2_max = fmaxf(x2_max, x3);
+
+        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
+    }
+
+    return x2_max;
+}
+#endif /* compute_block_energies */
+
 /**
  * Global Gain Estimation
  * dt, sr          Duration and samplerate of the frame
@@ -55,21 +85,7 @@ LC3_HOT static int estimate_gain(
 
     /* --- Energy (dB) by 4 MDCT blocks --- */
 
-    float x2_max = 0;
-
-    for (int i = 0; i < ne; i++, x += 4) {
-        float x0 = x[0] * x[0];
-        float x1 = x[1] * x[1];
-        float x2 = x[2] * x[2];
-        float x3 = x[3] * x[3];
-
-        x2_max = fmaxf(x2_max, x0);
-        x2_max = fmaxf(x2_max, x1);
-        x2_max = fmaxf(x2_max, x2);
-        x2_max = fmaxf(x2_max, x3);
-
-        e[i] = fast_db_q16(fmaxf(x0 + x1 + x2 + x3, 1e-10f));
-    }
+    float x2_max = compute_block_energies(x, ne, e);
 
     /* --- Determine gain index --- */
 
@@ -205,6 +221,7 @@ static float unquantize_gain(int g_int)
  *   b0       0:positive or zero  1:negative
  *   b15..b1  Absolute value
  */
+#ifndef quantize
 LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
     int g_int, float *x, uint16_t *xq, int *nq)
 {
@@ -228,6 +245,7 @@ LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
         *nq = x0 || x1 ? ne : *nq - 2;
     }
 }
+#endif /* quantize */
 
 /**
  * Spectrum quantization inverse
@@ -236,6 +254,7 @@ LC3_HOT static void quantize(enum lc3_dt dt, enum lc3_srate sr,
  * x, nq           Spectral quantized, and count of significants
  * return          Unquantized gain value
  */
+#ifndef unquantize
 LC3_HOT static float unquantize(enum lc3_dt dt, enum lc3_srate sr,
     int g_int, float *x, int nq)
 {
@@ -250,6 +269,7 @@ LC3_HOT static float unquantize(enum lc3_dt dt, enum lc3_srate sr,
 
     return g;
 }
+#endif /* unquantize */
 
 
 /* ----------------------------------------------------------------------------
@@ -661,6 +681,7 @@ LC3_HOT static void get_lsb(lc3_bits_t *bits,
  *   b0       0:positive or zero  1:negative
  *   b15..b1  Absolute value
  */
+#ifndef estimate_noise
 LC3_HOT static int estimate_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
     const uint16_t *xq, int nq, const float *x)
 {
@@ -684,6 +705,7 @@ LC3_HOT static int estimate_noise(enum lc3_dt dt, enum lc3_bandwidth bw,
 
     return LC3_CLIP(nf, 0, 7);
 }
+#endif /* estimate_noise */
 
 /**
  * Noise filling
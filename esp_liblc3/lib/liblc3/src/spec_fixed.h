@@ -0,0 +1,190 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Fixed point kernels, for targets without floating point unit
+ *
+ * - The energies of the blocks, estimating the global gain, are
+ *   accumulated on the coefficients converted as block floating point.
+ * - The scaling of the coefficients by the quantization gain
+ *   is applied on their binary representation, before the rounding
+ *   of the magnitudes in fixed point.
+ * - The level of the noise is estimated on magnitudes, lower than 1,
+ *   converted in Q20.
+ */
+
+#if LC3_FIXED_POINT
+
+
+/**
+ * Import
+ */
+
+static float unquantize_gain(int g_int);
+
+
+/**
+ * Energy (dB) by 4 MDCT blocks
+ */
+#ifndef compute_block_energies
+
+LC3_HOT static float fixed_compute_block_energies(
+    const float *x, int n, int *e)
+{
+    const int32_t db_q24 = 50504453;  /* 10 log10(2) / 2^8, in Q32 */
+    const int32_t db_exp = 197283;    /* 10 log10(2), in Q16 */
+
+    int ex = lc3_fixed_exp(x, 4*n, 30);
+    uint32_t x_max = 0;
+
+    /* The squares are lower than 2^60, and their sum than 2^62.
+     * The energies in dB are floored to -100, as in float. */
+
+    for (int i = 0; i < n; i++, x += 4) {
+        uint64_t x2 = 0;
+
+        for (int k = 0; k < 4; k++) {
+            int32_t v = lc3_fixed_from_float(x[k], ex);
+            uint32_t m = LC3_ABS(v);
+
+            x_max = LC3_MAX(x_max, m);
+            x2 += (uint64_t)m * m;
+        }
+
+        if (x2 == 0) {
+            e[i] = -(100 << 16);
+            continue;
+        }
+
+        uint32_t x2_hi = x2 >> 32;
+        int s = x2_hi ? 32 - lc3_clz32(x2_hi) : 0;
+
+        e[i] = LC3_MAX(-(100 << 16),
+            lc3_mulh(lc3_fixed_log2(x2 >> s), db_q24) + (s - 2*ex) * db_exp);
+    }
+
+    float v_max = lc3_fixed_to_float(x_max, ex);
+    return lc3_float_mul(v_max, v_max);
+}
+
+#define compute_block_energies fixed_compute_block_energies
+
+#endif /* compute_block_energies */
+
+/**
+ * Spectrum quantization
+ */
+#ifndef quantize
+
+LC3_HOT static void fixed_quantize(enum lc3_dt dt, enum lc3_srate sr,
+    int g_int, float *x, uint16_t *xq, int *nq)
+{
+    float g_inv = 1 / unquantize_gain(g_int);
+    int ne = LC3_NE(dt, sr);
+
+    *nq = ne;
+
+    /* The magnitudes, truncated in Q4, are rounded adding 6/16 */
+
+    for (int i = 0; i < ne; i += 2) {
+        int32_t v0, v1;
+        uint16_t x0, x1;
+
+        x[i+0] = lc3_float_mul(x[i+0], g_inv);
+        x[i+1] = lc3_float_mul(x[i+1], g_inv);
+
+        v0 = lc3_fixed_from_float(x[i+0], 4);
+        v1 = lc3_fixed_from_float(x[i+1], 4);
+
+        x0 = LC3_MIN((LC3_ABS(v0) + 6) >> 4, INT16_MAX);
+        x1 = LC3_MIN((LC3_ABS(v1) + 6) >> 4, INT16_MAX);
+
+        xq[i+0] = (x0 << 1) + ((x0 > 0) & (v0 < 0));
+        xq[i+1] = (x1 << 1) + ((x1 > 0) & (v1 < 0));
+
+        *nq = x0 || x1 ? ne : *nq - 2;
+    }
+}
+
+#define quantize fixed_quantize
+
+#endif /* quantize */
+
+/**
+ * Spectrum quantization inverse
+ */
+#ifndef unquantize
+
+LC3_HOT static float fixed_unquantize(enum lc3_dt dt, enum lc3_srate sr,
+    int g_int, float *x, int nq)
+{
+    float g = unquantize_gain(g_int);
+    int i, ne = LC3_NE(dt, sr);
+
+    for (i = 0; i < nq; i++)
+        x[i] = lc3_float_mul(x[i], g);
+
+    for ( ; i < ne; i++)
+        x[i] = 0;
+
+    return g;
+}
+
+#define unquantize fixed_unquantize
+
+#endif /* unquantize */
+
+/**
+ * Estimate noise level
+ */
+#ifndef estimate_noise
+
+LC3_HOT static int fixed_estimate_noise(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const uint16_t *xq, int nq, const float *x)
+{
+    int bw_stop = (dt == LC3_DT_7M5 ? 60 : 80) * (1 + bw);
+    int w = 2 + dt;
+
+    /* The coefficients summed are quantized to 0, their magnitudes
+     * are lower than 10/16. The sum of the 400 at most is lower than
+     * 2^28 in Q20. */
+
+    int32_t sum = 0;
+    int i, n = 0, z = 0;
+
+    for (i = 6*(3 + dt) - w; i < LC3_MIN(nq, bw_stop); i++) {
+        z = xq[i] ? 0 : z + 1;
+        if (z > 2*w)
+            sum += LC3_ABS(lc3_fixed_from_float(x[i - w], 20)), n++;
+    }
+
+    for ( ; i < bw_stop + w; i++)
+        if (++z > 2*w)
+            sum += LC3_ABS(lc3_fixed_from_float(x[i - w], 20)), n++;
+
+    int nf = n ? 8 - ((16 * (sum / n) + (1 << 19)) >> 20) : 0;
+
+    return LC3_CLIP(nf, 0, 7);
+}
+
+#define estimate_noise fixed_estimate_noise
+
+#endif /* estimate_noise */
+
+#endif /* LC3_FIXED_POINT */
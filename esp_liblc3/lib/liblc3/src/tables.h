@@ -20,11 +20,46 @@
 #define __LC3_TABLES_H
 
 #include "common.h"
+#include "fixed.h"
 #include "bits.h"
 
 
+/**
+ * Sizes of FFT, of half the number of samples of a frame,
+ * and twiddles of the butterflies, used by the configurations built in
+ */
+
+#define LC3_CONFIG_FFT_30   LC3_CONFIG_7M5_8K
+#define LC3_CONFIG_FFT_40   LC3_CONFIG_10M_8K
+#define LC3_CONFIG_FFT_60   LC3_CONFIG_7M5_16K
+#define LC3_CONFIG_FFT_80   LC3_CONFIG_10M_16K
+#define LC3_CONFIG_FFT_90   LC3_CONFIG_7M5_24K
+#define LC3_CONFIG_FFT_120  ( LC3_CONFIG_7M5_32K || LC3_CONFIG_10M_24K )
+#define LC3_CONFIG_FFT_160  LC3_CONFIG_10M_32K
+#define LC3_CONFIG_FFT_180  LC3_CONFIG_7M5_48K
+#define LC3_CONFIG_FFT_240  LC3_CONFIG_10M_48K
+
+#define LC3_CONFIG_FFT_TW3_45   ( LC3_CONFIG_FFT_90  || LC3_CONFIG_FFT_180 )
+#define LC3_CONFIG_FFT_TW3_15   ( LC3_CONFIG_FFT_TW2_30 || LC3_CONFIG_FFT_TW3_45 )
+
+#define LC3_CONFIG_FFT_TW2_160  ( LC3_CONFIG_FFT_160 )
+#define LC3_CONFIG_FFT_TW2_80   ( LC3_CONFIG_FFT_80  || LC3_CONFIG_FFT_TW2_160 )
+#define LC3_CONFIG_FFT_TW2_40   ( LC3_CONFIG_FFT_40  || LC3_CONFIG_FFT_TW2_80  )
+#define LC3_CONFIG_FFT_TW2_20   ( LC3_CONFIG_FFT_TW2_40 )
+#define LC3_CONFIG_FFT_TW2_10   ( LC3_CONFIG_FFT_TW2_40 )
+
+#define LC3_CONFIG_FFT_TW2_240  ( LC3_CONFIG_FFT_240 )
+#define LC3_CONFIG_FFT_TW2_120  ( LC3_CONFIG_FFT_120 || LC3_CONFIG_FFT_TW2_240 )
+#define LC3_CONFIG_FFT_TW2_60   ( LC3_CONFIG_FFT_60  || LC3_CONFIG_FFT_TW2_120 )
+#define LC3_CONFIG_FFT_TW2_30   ( LC3_CONFIG_FFT_30  || LC3_CONFIG_FFT_TW2_60  )
+
+#define LC3_CONFIG_FFT_TW2_180  ( LC3_CONFIG_FFT_180 )
+#define LC3_CONFIG_FFT_TW2_90   ( LC3_CONFIG_FFT_90  || LC3_CONFIG_FFT_TW2_180 )
+
+
 /**
  * MDCT Twiddles and window coefficients
+ * The tables of configurations not built in are NULL
  */
 
 struct lc3_fft_bf3_twiddles { int n3; const struct lc3_complex (*t)[2]; };
@@ -37,6 +72,39 @@ extern const struct lc3_mdct_rot_def *lc3_mdct_rot[LC3_NUM_DT][LC3_NUM_SRATE];
 
 extern const float *lc3_mdct_win[LC3_NUM_DT][LC3_NUM_SRATE];
 
+extern const struct lc3_mdct_rot_def
+    lc3_mdct_rot_120, lc3_mdct_rot_160, lc3_mdct_rot_240,
+    lc3_mdct_rot_320, lc3_mdct_rot_360, lc3_mdct_rot_480,
+    lc3_mdct_rot_640, lc3_mdct_rot_720, lc3_mdct_rot_960;
+
+extern const float
+    lc3_mdct_win_7m5_60[], lc3_mdct_win_7m5_120[], lc3_mdct_win_7m5_180[],
+    lc3_mdct_win_7m5_240[], lc3_mdct_win_7m5_360[];
+
+extern const float
+    lc3_mdct_win_10m_80[], lc3_mdct_win_10m_160[], lc3_mdct_win_10m_240[],
+    lc3_mdct_win_10m_320[], lc3_mdct_win_10m_480[];
+
+
+/**
+ * MDCT Twiddles and window coefficients, fixed point
+ * FFT twiddles in Q31, rotations in Q32 and windows in Q30
+ */
+
+struct lc3_fft_bf3_twiddles_q31 {
+    int n3; const struct lc3_complex_q31 (*t)[2]; };
+struct lc3_fft_bf2_twiddles_q31 {
+    int n2; const struct lc3_complex_q31 *t; };
+struct lc3_mdct_rot_def_q32 {
+    int n4; const struct lc3_complex_q31 *w; };
+
+extern const struct lc3_fft_bf3_twiddles_q31 *lc3_fft_twiddles_bf3_q31[];
+extern const struct lc3_fft_bf2_twiddles_q31 *lc3_fft_twiddles_bf2_q31[][3];
+extern const struct lc3_mdct_rot_def_q32
+    *lc3_mdct_rot_q32[LC3_NUM_DT][LC3_NUM_SRATE];
+
+extern const int32_t *lc3_mdct_win_q30[LC3_NUM_DT][LC3_NUM_SRATE];
+
 
 /**
  * Limits of bands
@@ -63,6 +131,17 @@ extern const struct lc3_sns_vq_gains lc3_sns_vq_gains[4];
 extern const int32_t lc3_sns_mpvq_offsets[][11];
 
 
+/**
+ * SNS Quantization, fixed point
+ * Codebooks in Q20, and DCT-16 matrix in Q31
+ */
+
+extern const int32_t lc3_sns_lfcb_q20[32][8];
+extern const int32_t lc3_sns_hfcb_q20[32][8];
+
+extern const int32_t lc3_sns_dct16_q31[16][16];
+
+
 /**
  * TNS Arithmetic Coding
  */
@@ -0,0 +1,2365 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Generated by `tables/mktables_fixed.c` from `tables.c`
+ */
+
+#include "tables.h"
+
+
+/**
+ * Twiddles FFT 3 points, Q31
+ */
+
+#if LC3_CONFIG_FFT_TW3_15
+
+static const struct lc3_complex_q31
+    fft_twiddles_15_q31_t[15][2] LC3_HOT_TABLE = {
+    { {  2147483647,           0 }, {  2147483647,           0 } },
+    { {  1961824000,  -873460288 }, {  1436947072, -1595891328 } },
+    { {  1436947072, -1595891328 }, {  -224473152, -2135719552 } },
+    { {   663608960, -2042378368 }, { -1737350784, -1262259200 } },
+    { {  -224473152, -2135719552 }, { -2100556032,   446486944 } },
+    { { -1073741824, -1859775360 }, { -1073741824,  1859775360 } },
+    { { -1737350784, -1262259200 }, {   663608960,  2042378368 } },
+    { { -2100556032,  -446486944 }, {  1961824000,   873460288 } },
+    { { -2100556032,   446486944 }, {  1961824000,  -873460288 } },
+    { { -1737350784,  1262259200 }, {   663608960, -2042378368 } },
+    { { -1073741824,  1859775360 }, { -1073741824, -1859775360 } },
+    { {  -224473152,  2135719552 }, { -2100556032,  -446486944 } },
+    { {   663608960,  2042378368 }, { -1737350784,  1262259200 } },
+    { {  1436947072,  1595891328 }, {  -224473152,  2135719552 } },
+    { {  1961824000,   873460288 }, {  1436947072,  1595891328 } },
+};
+
+static const struct lc3_fft_bf3_twiddles_q31 fft_twiddles_15_q31 = {
+    .n3 = 15/3, .t = fft_twiddles_15_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW3_15 */
+
+#if LC3_CONFIG_FFT_TW3_45
+
+static const struct lc3_complex_q31
+    fft_twiddles_45_q31_t[45][2] LC3_HOT_TABLE = {
+    { {  2147483647,           0 }, {  2147483647,           0 } },
+    { {  2126584448,  -298871968 }, {  2064293760,  -591926720 } },
+    { {  2064293760,  -591926720 }, {  1821169408, -1137992960 } },
+    { {  1961824000,  -873460288 }, {  1436947072, -1595891328 } },
+    { {  1821169408, -1137992960 }, {   941394880, -1930145536 } },
+    { {  1645067904, -1380375936 }, {   372906624, -2114858496 } },
+    { {  1436947072, -1595891328 }, {  -224473152, -2135719552 } },
+    { {  1200857600, -1780344576 }, {  -804461504, -1991112192 } },
+    { {   941394880, -1930145536 }, { -1322123008, -1692240256 } },
+    { {   663608960, -2042378368 }, { -1737350784, -1262259200 } },
+    { {   372906624, -2114858496 }, { -2017974528,  -734482688 } },
+    { {    74946096, -2146175488 }, { -2142252544,  -149800880 } },
+    { {  -224473152, -2135719552 }, { -2100556032,   446486944 } },
+    { {  -519523328, -2083694208 }, { -1896115456,  1008182528 } },
+    { {  -804461504, -1991112192 }, { -1544770432,  1491767552 } },
+    { { -1073741824, -1859775360 }, { -1073741824,  1859775360 } },
+    { { -1322123008, -1692240256 }, {  -519523328,  2083694208 } },
+    { { -1544770432, -1491767552 }, {    74946096,  2146175488 } },
+    { { -1737350784, -1262259200 }, {   663608960,  2042378368 } },
+    { { -1896115456, -1008182528 }, {  1200857600,  1780344576 } },
+    { { -2017974528,  -734482688 }, {  1645067904,  1380375936 } },
+    { { -2100556032,  -446486944 }, {  1961824000,   873460288 } },
+    { { -2142252544,  -149800880 }, {  2126584448,   298871968 } },
+    { { -2142252544,   149800880 }, {  2126584448,  -298871968 } },
+    { { -2100556032,   446486944 }, {  1961824000,  -873460288 } },
+    { { -2017974528,   734482688 }, {  1645067904, -1380375936 } },
+    { { -1896115456,  1008182528 }, {  1200857600, -1780344576 } },
+    { { -1737350784,  1262259200 }, {   663608960, -2042378368 } },
+    { { -1544770432,  1491767552 }, {    74946096, -2146175488 } },
+    { { -1322123008,  1692240256 }, {  -519523328, -2083694208 } },
+    { { -1073741824,  1859775360 }, { -1073741824, -1859775360 } },
+    { {  -804461504,  1991112192 }, { -1544770432, -1491767552 } },
+    { {  -519523328,  2083694208 }, { -1896115456, -1008182528 } },
+    { {  -224473152,  2135719552 }, { -2100556032,  -446486944 } },
+    { {    74946096,  2146175488 }, { -2142252544,   149800880 } },
+    { {   372906624,  2114858496 }, { -2017974528,   734482688 } },
+    { {   663608960,  2042378368 }, { -1737350784,  1262259200 } },
+    { {   941394880,  1930145536 }, { -1322123008,  1692240256 } },
+    { {  1200857600,  1780344576 }, {  -804461504,  1991112192 } },
+    { {  1436947072,  1595891328 }, {  -224473152,  2135719552 } },
+    { {  1645067904,  1380375936 }, {   372906624,  2114858496 } },
+    { {  1821169408,  1137992960 }, {   941394880,  1930145536 } },
+    { {  1961824000,   873460288 }, {  1436947072,  1595891328 } },
+    { {  2064293760,   591926720 }, {  1821169408,  1137992960 } },
+    { {  2126584448,   298871968 }, {  2064293760,   591926720 } },
+};
+
+static const struct lc3_fft_bf3_twiddles_q31 fft_twiddles_45_q31 = {
+    .n3 = 45/3, .t = fft_twiddles_45_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW3_45 */
+
+const struct lc3_fft_bf3_twiddles_q31 *lc3_fft_twiddles_bf3_q31[] = {
+#if LC3_CONFIG_FFT_TW3_15
+    &fft_twiddles_15_q31,
+#else
+    NULL,
+#endif
+#if LC3_CONFIG_FFT_TW3_45
+    &fft_twiddles_45_q31,
+#endif
+};
+
+
+/**
+ * Twiddles FFT 2 points, Q31
+ */
+
+#if LC3_CONFIG_FFT_TW2_10
+
+static const struct lc3_complex_q31
+    fft_twiddles_10_q31_t[10/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  1737350784, -1262259200 },
+    {   663608960, -2042378368 }, {  -663608960, -2042378368 },
+    { -1737350784, -1262259200 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_10_q31 = {
+    .n2 = 10/2, .t = fft_twiddles_10_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_10 */
+
+#if LC3_CONFIG_FFT_TW2_20
+
+static const struct lc3_complex_q31
+    fft_twiddles_20_q31_t[20/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2042378368,  -663608960 },
+    {  1737350784, -1262259200 }, {  1262259200, -1737350784 },
+    {   663608960, -2042378368 }, {           0, -2147483647 },
+    {  -663608960, -2042378368 }, { -1262259200, -1737350784 },
+    { -1737350784, -1262259200 }, { -2042378368,  -663608960 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_20_q31 = {
+    .n2 = 20/2, .t = fft_twiddles_20_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_20 */
+
+#if LC3_CONFIG_FFT_TW2_30
+
+static const struct lc3_complex_q31
+    fft_twiddles_30_q31_t[30/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2100556032,  -446486944 },
+    {  1961824000,  -873460288 }, {  1737350784, -1262259200 },
+    {  1436947072, -1595891328 }, {  1073741824, -1859775360 },
+    {   663608960, -2042378368 }, {   224473152, -2135719552 },
+    {  -224473152, -2135719552 }, {  -663608960, -2042378368 },
+    { -1073741824, -1859775360 }, { -1436947072, -1595891328 },
+    { -1737350784, -1262259200 }, { -1961824000,  -873460288 },
+    { -2100556032,  -446486944 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_30_q31 = {
+    .n2 = 30/2, .t = fft_twiddles_30_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_30 */
+
+#if LC3_CONFIG_FFT_TW2_40
+
+static const struct lc3_complex_q31
+    fft_twiddles_40_q31_t[40/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2121044608,  -335940480 },
+    {  2042378368,  -663608960 }, {  1913421952,  -974937152 },
+    {  1737350784, -1262259200 }, {  1518500224, -1518500224 },
+    {  1262259200, -1737350784 }, {   974937152, -1913421952 },
+    {   663608960, -2042378368 }, {   335940480, -2121044608 },
+    {           0, -2147483647 }, {  -335940480, -2121044608 },
+    {  -663608960, -2042378368 }, {  -974937152, -1913421952 },
+    { -1262259200, -1737350784 }, { -1518500224, -1518500224 },
+    { -1737350784, -1262259200 }, { -1913421952,  -974937152 },
+    { -2042378368,  -663608960 }, { -2121044608,  -335940480 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_40_q31 = {
+    .n2 = 40/2, .t = fft_twiddles_40_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_40 */
+
+#if LC3_CONFIG_FFT_TW2_60
+
+static const struct lc3_complex_q31
+    fft_twiddles_60_q31_t[60/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2135719552,  -224473152 },
+    {  2100556032,  -446486944 }, {  2042378368,  -663608960 },
+    {  1961824000,  -873460288 }, {  1859775360, -1073741824 },
+    {  1737350784, -1262259200 }, {  1595891328, -1436947072 },
+    {  1436947072, -1595891328 }, {  1262259200, -1737350784 },
+    {  1073741824, -1859775360 }, {   873460288, -1961824000 },
+    {   663608960, -2042378368 }, {   446486944, -2100556032 },
+    {   224473152, -2135719552 }, {           0, -2147483647 },
+    {  -224473152, -2135719552 }, {  -446486944, -2100556032 },
+    {  -663608960, -2042378368 }, {  -873460288, -1961824000 },
+    { -1073741824, -1859775360 }, { -1262259200, -1737350784 },
+    { -1436947072, -1595891328 }, { -1595891328, -1436947072 },
+    { -1737350784, -1262259200 }, { -1859775360, -1073741824 },
+    { -1961824000,  -873460288 }, { -2042378368,  -663608960 },
+    { -2100556032,  -446486944 }, { -2135719552,  -224473152 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_60_q31 = {
+    .n2 = 60/2, .t = fft_twiddles_60_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_60 */
+
+#if LC3_CONFIG_FFT_TW2_80
+
+static const struct lc3_complex_q31
+    fft_twiddles_80_q31_t[80/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2140863616,  -168489632 },
+    {  2121044608,  -335940480 }, {  2088148480,  -501320096 },
+    {  2042378368,  -663608960 }, {  1984016128,  -821806400 },
+    {  1913421952,  -974937152 }, {  1831030784, -1122057088 },
+    {  1737350784, -1262259200 }, {  1632959360, -1394679040 },
+    {  1518500224, -1518500224 }, {  1394679040, -1632959360 },
+    {  1262259200, -1737350784 }, {  1122057088, -1831030784 },
+    {   974937152, -1913421952 }, {   821806400, -1984016128 },
+    {   663608960, -2042378368 }, {   501320096, -2088148480 },
+    {   335940480, -2121044608 }, {   168489632, -2140863616 },
+    {           0, -2147483647 }, {  -168489632, -2140863616 },
+    {  -335940480, -2121044608 }, {  -501320096, -2088148480 },
+    {  -663608960, -2042378368 }, {  -821806400, -1984016128 },
+    {  -974937152, -1913421952 }, { -1122057088, -1831030784 },
+    { -1262259200, -1737350784 }, { -1394679040, -1632959360 },
+    { -1518500224, -1518500224 }, { -1632959360, -1394679040 },
+    { -1737350784, -1262259200 }, { -1831030784, -1122057088 },
+    { -1913421952,  -974937152 }, { -1984016128,  -821806400 },
+    { -2042378368,  -663608960 }, { -2088148480,  -501320096 },
+    { -2121044608,  -335940480 }, { -2140863616,  -168489632 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_80_q31 = {
+    .n2 = 80/2, .t = fft_twiddles_80_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_80 */
+
+#if LC3_CONFIG_FFT_TW2_90
+
+static const struct lc3_complex_q31
+    fft_twiddles_90_q31_t[90/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2142252544,  -149800880 },
+    {  2126584448,  -298871968 }, {  2100556032,  -446486944 },
+    {  2064293760,  -591926720 }, {  2017974528,  -734482688 },
+    {  1961824000,  -873460288 }, {  1896115456, -1008182528 },
+    {  1821169408, -1137992960 }, {  1737350784, -1262259200 },
+    {  1645067904, -1380375936 }, {  1544770432, -1491767552 },
+    {  1436947072, -1595891328 }, {  1322123008, -1692240256 },
+    {  1200857600, -1780344576 }, {  1073741824, -1859775360 },
+    {   941394880, -1930145536 }, {   804461504, -1991112192 },
+    {   663608960, -2042378368 }, {   519523328, -2083694208 },
+    {   372906624, -2114858496 }, {   224473152, -2135719552 },
+    {    74946096, -2146175488 }, {   -74946096, -2146175488 },
+    {  -224473152, -2135719552 }, {  -372906624, -2114858496 },
+    {  -519523328, -2083694208 }, {  -663608960, -2042378368 },
+    {  -804461504, -1991112192 }, {  -941394880, -1930145536 },
+    { -1073741824, -1859775360 }, { -1200857600, -1780344576 },
+    { -1322123008, -1692240256 }, { -1436947072, -1595891328 },
+    { -1544770432, -1491767552 }, { -1645067904, -1380375936 },
+    { -1737350784, -1262259200 }, { -1821169408, -1137992960 },
+    { -1896115456, -1008182528 }, { -1961824000,  -873460288 },
+    { -2017974528,  -734482688 }, { -2064293760,  -591926720 },
+    { -2100556032,  -446486944 }, { -2126584448,  -298871968 },
+    { -2142252544,  -149800880 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_90_q31 = {
+    .n2 = 90/2, .t = fft_twiddles_90_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_90 */
+
+#if LC3_CONFIG_FFT_TW2_120
+
+static const struct lc3_complex_q31
+    fft_twiddles_120_q31_t[120/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2144540544,  -112390608 },
+    {  2135719552,  -224473152 }, {  2121044608,  -335940480 },
+    {  2100556032,  -446486944 }, {  2074309888,  -555809664 },
+    {  2042378368,  -663608960 }, {  2004848768,  -769589312 },
+    {  1961824000,  -873460288 }, {  1913421952,  -974937152 },
+    {  1859775360, -1073741824 }, {  1801031296, -1169603456 },
+    {  1737350784, -1262259200 }, {  1668908288, -1351455232 },
+    {  1595891328, -1436947072 }, {  1518500224, -1518500224 },
+    {  1436947072, -1595891328 }, {  1351455232, -1668908288 },
+    {  1262259200, -1737350784 }, {  1169603456, -1801031296 },
+    {  1073741824, -1859775360 }, {   974937152, -1913421952 },
+    {   873460288, -1961824000 }, {   769589312, -2004848768 },
+    {   663608960, -2042378368 }, {   555809664, -2074309888 },
+    {   446486944, -2100556032 }, {   335940480, -2121044608 },
+    {   224473152, -2135719552 }, {   112390608, -2144540544 },
+    {           0, -2147483647 }, {  -112390608, -2144540544 },
+    {  -224473152, -2135719552 }, {  -335940480, -2121044608 },
+    {  -446486944, -2100556032 }, {  -555809664, -2074309888 },
+    {  -663608960, -2042378368 }, {  -769589312, -2004848768 },
+    {  -873460288, -1961824000 }, {  -974937152, -1913421952 },
+    { -1073741824, -1859775360 }, { -1169603456, -1801031296 },
+    { -1262259200, -1737350784 }, { -1351455232, -1668908288 },
+    { -1436947072, -1595891328 }, { -1518500224, -1518500224 },
+    { -1595891328, -1436947072 }, { -1668908288, -1351455232 },
+    { -1737350784, -1262259200 }, { -1801031296, -1169603456 },
+    { -1859775360, -1073741824 }, { -1913421952,  -974937152 },
+    { -1961824000,  -873460288 }, { -2004848768,  -769589312 },
+    { -2042378368,  -663608960 }, { -2074309888,  -555809664 },
+    { -2100556032,  -446486944 }, { -2121044608,  -335940480 },
+    { -2135719552,  -224473152 }, { -2144540544,  -112390608 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_120_q31 = {
+    .n2 = 120/2, .t = fft_twiddles_120_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_120 */
+
+#if LC3_CONFIG_FFT_TW2_160
+
+static const struct lc3_complex_q31
+    fft_twiddles_160_q31_t[160/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2145827968,   -84309816 },
+    {  2140863616,  -168489632 }, {  2132598272,  -252409648 },
+    {  2121044608,  -335940480 }, {  2106220288,  -418953280 },
+    {  2088148480,  -501320096 }, {  2066856832,  -582913920 },
+    {  2042378368,  -663608960 }, {  2014750592,  -743280704 },
+    {  1984016128,  -821806400 }, {  1950222592,  -899064960 },
+    {  1913421952,  -974937152 }, {  1873670912, -1049306112 },
+    {  1831030784, -1122057088 }, {  1785567360, -1193078016 },
+    {  1737350784, -1262259200 }, {  1686455296, -1329494144 },
+    {  1632959360, -1394679040 }, {  1576945536, -1457713536 },
+    {  1518500224, -1518500224 }, {  1457713536, -1576945536 },
+    {  1394679040, -1632959360 }, {  1329494144, -1686455296 },
+    {  1262259200, -1737350784 }, {  1193078016, -1785567360 },
+    {  1122057088, -1831030784 }, {  1049306112, -1873670912 },
+    {   974937152, -1913421952 }, {   899064960, -1950222592 },
+    {   821806400, -1984016128 }, {   743280704, -2014750592 },
+    {   663608960, -2042378368 }, {   582913920, -2066856832 },
+    {   501320096, -2088148480 }, {   418953280, -2106220288 },
+    {   335940480, -2121044608 }, {   252409648, -2132598272 },
+    {   168489632, -2140863616 }, {    84309816, -2145827968 },
+    {           0, -2147483647 }, {   -84309816, -2145827968 },
+    {  -168489632, -2140863616 }, {  -252409648, -2132598272 },
+    {  -335940480, -2121044608 }, {  -418953280, -2106220288 },
+    {  -501320096, -2088148480 }, {  -582913920, -2066856832 },
+    {  -663608960, -2042378368 }, {  -743280704, -2014750592 },
+    {  -821806400, -1984016128 }, {  -899064960, -1950222592 },
+    {  -974937152, -1913421952 }, { -1049306112, -1873670912 },
+    { -1122057088, -1831030784 }, { -1193078016, -1785567360 },
+    { -1262259200, -1737350784 }, { -1329494144, -1686455296 },
+    { -1394679040, -1632959360 }, { -1457713536, -1576945536 },
+    { -1518500224, -1518500224 }, { -1576945536, -1457713536 },
+    { -1632959360, -1394679040 }, { -1686455296, -1329494144 },
+    { -1737350784, -1262259200 }, { -1785567360, -1193078016 },
+    { -1831030784, -1122057088 }, { -1873670912, -1049306112 },
+    { -1913421952,  -974937152 }, { -1950222592,  -899064960 },
+    { -1984016128,  -821806400 }, { -2014750592,  -743280704 },
+    { -2042378368,  -663608960 }, { -2066856832,  -582913920 },
+    { -2088148480,  -501320096 }, { -2106220288,  -418953280 },
+    { -2121044608,  -335940480 }, { -2132598272,  -252409648 },
+    { -2140863616,  -168489632 }, { -2145827968,   -84309816 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_160_q31 = {
+    .n2 = 160/2, .t = fft_twiddles_160_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_160 */
+
+#if LC3_CONFIG_FFT_TW2_180
+
+static const struct lc3_complex_q31
+    fft_twiddles_180_q31_t[180/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2146175488,   -74946096 },
+    {  2142252544,  -149800880 }, {  2135719552,  -224473152 },
+    {  2126584448,  -298871968 }, {  2114858496,  -372906624 },
+    {  2100556032,  -446486944 }, {  2083694208,  -519523328 },
+    {  2064293760,  -591926720 }, {  2042378368,  -663608960 },
+    {  2017974528,  -734482688 }, {  1991112192,  -804461504 },
+    {  1961824000,  -873460288 }, {  1930145536,  -941394880 },
+    {  1896115456, -1008182528 }, {  1859775360, -1073741824 },
+    {  1821169408, -1137992960 }, {  1780344576, -1200857600 },
+    {  1737350784, -1262259200 }, {  1692240256, -1322123008 },
+    {  1645067904, -1380375936 }, {  1595891328, -1436947072 },
+    {  1544770432, -1491767552 }, {  1491767552, -1544770432 },
+    {  1436947072, -1595891328 }, {  1380375936, -1645067904 },
+    {  1322123008, -1692240256 }, {  1262259200, -1737350784 },
+    {  1200857600, -1780344576 }, {  1137992960, -1821169408 },
+    {  1073741824, -1859775360 }, {  1008182528, -1896115456 },
+    {   941394880, -1930145536 }, {   873460288, -1961824000 },
+    {   804461504, -1991112192 }, {   734482688, -2017974528 },
+    {   663608960, -2042378368 }, {   591926720, -2064293760 },
+    {   519523328, -2083694208 }, {   446486944, -2100556032 },
+    {   372906624, -2114858496 }, {   298871968, -2126584448 },
+    {   224473152, -2135719552 }, {   149800880, -2142252544 },
+    {    74946096, -2146175488 }, {           0, -2147483647 },
+    {   -74946096, -2146175488 }, {  -149800880, -2142252544 },
+    {  -224473152, -2135719552 }, {  -298871968, -2126584448 },
+    {  -372906624, -2114858496 }, {  -446486944, -2100556032 },
+    {  -519523328, -2083694208 }, {  -591926720, -2064293760 },
+    {  -663608960, -2042378368 }, {  -734482688, -2017974528 },
+    {  -804461504, -1991112192 }, {  -873460288, -1961824000 },
+    {  -941394880, -1930145536 }, { -1008182528, -1896115456 },
+    { -1073741824, -1859775360 }, { -1137992960, -1821169408 },
+    { -1200857600, -1780344576 }, { -1262259200, -1737350784 },
+    { -1322123008, -1692240256 }, { -1380375936, -1645067904 },
+    { -1436947072, -1595891328 }, { -1491767552, -1544770432 },
+    { -1544770432, -1491767552 }, { -1595891328, -1436947072 },
+    { -1645067904, -1380375936 }, { -1692240256, -1322123008 },
+    { -1737350784, -1262259200 }, { -1780344576, -1200857600 },
+    { -1821169408, -1137992960 }, { -1859775360, -1073741824 },
+    { -1896115456, -1008182528 }, { -1930145536,  -941394880 },
+    { -1961824000,  -873460288 }, { -1991112192,  -804461504 },
+    { -2017974528,  -734482688 }, { -2042378368,  -663608960 },
+    { -2064293760,  -591926720 }, { -2083694208,  -519523328 },
+    { -2100556032,  -446486944 }, { -2114858496,  -372906624 },
+    { -2126584448,  -298871968 }, { -2135719552,  -224473152 },
+    { -2142252544,  -149800880 }, { -2146175488,   -74946096 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_180_q31 = {
+    .n2 = 180/2, .t = fft_twiddles_180_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_180 */
+
+#if LC3_CONFIG_FFT_TW2_240
+
+static const struct lc3_complex_q31
+    fft_twiddles_240_q31_t[240/2] LC3_HOT_TABLE = {
+    {  2147483647,           0 }, {  2146747776,   -56214568 },
+    {  2144540544,  -112390608 }, {  2140863616,  -168489632 },
+    {  2135719552,  -224473152 }, {  2129111680,  -280302848 },
+    {  2121044608,  -335940480 }, {  2111523840,  -391347808 },
+    {  2100556032,  -446486944 }, {  2088148480,  -501320096 },
+    {  2074309888,  -555809664 }, {  2059049728,  -609918272 },
+    {  2042378368,  -663608960 }, {  2024307200,  -716844800 },
+    {  2004848768,  -769589312 }, {  1984016128,  -821806400 },
+    {  1961824000,  -873460288 }, {  1938287104,  -924515520 },
+    {  1913421952,  -974937152 }, {  1887245312, -1024690624 },
+    {  1859775360, -1073741824 }, {  1831030784, -1122057088 },
+    {  1801031296, -1169603456 }, {  1769797504, -1216348160 },
+    {  1737350784, -1262259200 }, {  1703713280, -1307305216 },
+    {  1668908288, -1351455232 }, {  1632959360, -1394679040 },
+    {  1595891328, -1436947072 }, {  1557729536, -1478230144 },
+    {  1518500224, -1518500224 }, {  1478230144, -1557729536 },
+    {  1436947072, -1595891328 }, {  1394679040, -1632959360 },
+    {  1351455232, -1668908288 }, {  1307305216, -1703713280 },
+    {  1262259200, -1737350784 }, {  1216348160, -1769797504 },
+    {  1169603456, -1801031296 }, {  1122057088, -1831030784 },
+    {  1073741824, -1859775360 }, {  1024690624, -1887245312 },
+    {   974937152, -1913421952 }, {   924515520, -1938287104 },
+    {   873460288, -1961824000 }, {   821806400, -1984016128 },
+    {   769589312, -2004848768 }, {   716844800, -2024307200 },
+    {   663608960, -2042378368 }, {   609918272, -2059049728 },
+    {   555809664, -2074309888 }, {   501320096, -2088148480 },
+    {   446486944, -2100556032 }, {   391347808, -2111523840 },
+    {   335940480, -2121044608 }, {   280302848, -2129111680 },
+    {   224473152, -2135719552 }, {   168489632, -2140863616 },
+    {   112390608, -2144540544 }, {    56214568, -2146747776 },
+    {           0, -2147483647 }, {   -56214568, -2146747776 },
+    {  -112390608, -2144540544 }, {  -168489632, -2140863616 },
+    {  -224473152, -2135719552 }, {  -280302848, -2129111680 },
+    {  -335940480, -2121044608 }, {  -391347808, -2111523840 },
+    {  -446486944, -2100556032 }, {  -501320096, -2088148480 },
+    {  -555809664, -2074309888 }, {  -609918272, -2059049728 },
+    {  -663608960, -2042378368 }, {  -716844800, -2024307200 },
+    {  -769589312, -2004848768 }, {  -821806400, -1984016128 },
+    {  -873460288, -1961824000 }, {  -924515520, -1938287104 },
+    {  -974937152, -1913421952 }, { -1024690624, -1887245312 },
+    { -1073741824, -1859775360 }, { -1122057088, -1831030784 },
+    { -1169603456, -1801031296 }, { -1216348160, -1769797504 },
+    { -1262259200, -1737350784 }, { -1307305216, -1703713280 },
+    { -1351455232, -1668908288 }, { -1394679040, -1632959360 },
+    { -1436947072, -1595891328 }, { -1478230144, -1557729536 },
+    { -1518500224, -1518500224 }, { -1557729536, -1478230144 },
+    { -1595891328, -1436947072 }, { -1632959360, -1394679040 },
+    { -1668908288, -1351455232 }, { -1703713280, -1307305216 },
+    { -1737350784, -1262259200 }, { -1769797504, -1216348160 },
+    { -1801031296, -1169603456 }, { -1831030784, -1122057088 },
+    { -1859775360, -1073741824 }, { -1887245312, -1024690624 },
+    { -1913421952,  -974937152 }, { -1938287104,  -924515520 },
+    { -1961824000,  -873460288 }, { -1984016128,  -821806400 },
+    { -2004848768,  -769589312 }, { -2024307200,  -716844800 },
+    { -2042378368,  -663608960 }, { -2059049728,  -609918272 },
+    { -2074309888,  -555809664 }, { -2088148480,  -501320096 },
+    { -2100556032,  -446486944 }, { -2111523840,  -391347808 },
+    { -2121044608,  -335940480 }, { -2129111680,  -280302848 },
+    { -2135719552,  -224473152 }, { -2140863616,  -168489632 },
+    { -2144540544,  -112390608 }, { -2146747776,   -56214568 },
+};
+
+static const struct lc3_fft_bf2_twiddles_q31 fft_twiddles_240_q31 = {
+    .n2 = 240/2, .t = fft_twiddles_240_q31_t };
+
+#endif /* LC3_CONFIG_FFT_TW2_240 */
+
+const struct lc3_fft_bf2_twiddles_q31 *lc3_fft_twiddles_bf2_q31[][3] = {
+#if LC3_CONFIG_FFT_TW2_10
+    [0][0] = &fft_twiddles_10_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_30
+    [0][1] = &fft_twiddles_30_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_90
+    [0][2] = &fft_twiddles_90_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_20
+    [1][0] = &fft_twiddles_20_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_60
+    [1][1] = &fft_twiddles_60_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_180
+    [1][2] = &fft_twiddles_180_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_40
+    [2][0] = &fft_twiddles_40_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_120
+    [2][1] = &fft_twiddles_120_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_80
+    [3][0] = &fft_twiddles_80_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_240
+    [3][1] = &fft_twiddles_240_q31,
+#endif
+#if LC3_CONFIG_FFT_TW2_160
+    [4][0] = &fft_twiddles_160_q31,
+#endif
+};
+
+
+/**
+ * MDCT Rotation twiddles, Q32 (magnitudes lower than 1/2)
+ */
+
+#if LC3_CONFIG_FFT_30
+
+static const struct lc3_complex_q31
+    mdct_rot_120_q32_w[120/4] LC3_HOT_TABLE = {
+    {  1835144448,    12011164 }, {  1832000768,   108038736 },
+    {  1823835776,   203770192 }, {  1810671744,   298943104 },
+    {  1792544896,   393296672 }, {  1769504640,   486572192 },
+    {  1741614336,   578514112 }, {  1708950528,   668870336 },
+    {  1671602432,   757393216 }, {  1629672704,   843840192 },
+    {  1583276032,   927974208 }, {  1532539904,  1009564736 },
+    {  1477603072,  1088388096 }, {  1418616192,  1164228224 },
+    {  1355741056,  1236877312 }, {  1289149952,  1306136192 },
+    {  1219025280,  1371815168 }, {  1145559424,  1433734016 },
+    {  1068953600,  1491723008 }, {   989417856,  1545623296 },
+    {   907170240,  1595287296 }, {   822436096,  1640578560 },
+    {   735447744,  1681373184 }, {   646443584,  1717559296 },
+    {   555667520,  1749037696 }, {   463368416,  1775722112 },
+    {   369799296,  1797539328 }, {   275216544,  1814429696 },
+    {   179879456,  1826346752 }, {    84049336,  1833257984 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_120_q32 = {
+    .n4 = 120/4, .w = mdct_rot_120_q32_w };
+
+#endif /* LC3_CONFIG_FFT_30 */
+
+#if LC3_CONFIG_FFT_40
+
+static const struct lc3_complex_q31
+    mdct_rot_160_q32_w[160/4] LC3_HOT_TABLE = {
+    {  1707810304,     8383262 }, {  1706164480,    75425112 },
+    {  1701888000,   142350672 }, {  1694987136,   209056736 },
+    {  1685472896,   275440448 }, {  1673359744,   341399456 },
+    {  1658666368,   406832032 }, {  1641415424,   471637312 },
+    {  1621633536,   535715360 }, {  1599351296,   598967360 },
+    {  1574602880,   661295808 }, {  1547426560,   722604608 },
+    {  1517864192,   782799168 }, {  1485961472,   841786752 },
+    {  1451767424,   899476352 }, {  1415334912,   955779008 },
+    {  1376720000,  1010607936 }, {  1335982336,  1063878592 },
+    {  1293184640,  1115508736 }, {  1248392960,  1165418880 },
+    {  1201676416,  1213532160 }, {  1153106944,  1259774080 },
+    {  1102759424,  1304073600 }, {  1050711552,  1346362368 },
+    {   997043520,  1386575104 }, {   941838144,  1424649856 },
+    {   885180544,  1460527872 }, {   827158016,  1494153984 },
+    {   767860096,  1525476096 }, {   707378176,  1554445952 },
+    {   645805568,  1581019136 }, {   583237184,  1605154432 },
+    {   519769472,  1626814720 }, {   455500256,  1645966592 },
+    {   390528768,  1662580480 }, {   324955072,  1676630784 },
+    {   258880336,  1688095744 }, {   192406432,  1696957952 },
+    {   125635832,  1703203456 }, {    58671520,  1706822784 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_160_q32 = {
+    .n4 = 160/4, .w = mdct_rot_160_q32_w };
+
+#endif /* LC3_CONFIG_FFT_40 */
+
+#if LC3_CONFIG_FFT_60
+
+static const struct lc3_complex_q31
+    mdct_rot_240_q32_w[240/4] LC3_HOT_TABLE = {
+    {  1543191168,     5050100 }, {  1542530176,    45444404 },
+    {  1540811904,    85807560 }, {  1538037760,   126111912 },
+    {  1534209536,   166329840 }, {  1529329792,   206433760 },
+    {  1523401856,   246396208 }, {  1516429952,   286189792 },
+    {  1508418816,   325787232 }, {  1499373696,   365161376 },
+    {  1489301120,   404285280 }, {  1478207872,   443132096 },
+    {  1466101376,   481675200 }, {  1452990208,   519888224 },
+    {  1438883200,   557744896 }, {  1423790080,   595219392 },
+    {  1407721216,   632285888 }, {  1390687488,   668919040 },
+    {  1372700672,   705093760 }, {  1353773056,   740785280 },
+    {  1333917696,   775969088 }, {  1313148032,   810621120 },
+    {  1291478528,   844717504 }, {  1268923776,   878235008 },
+    {  1245499520,   911150592 }, {  1221221504,   943441728 },
+    {  1196106624,   975086336 }, {  1170171904,  1006062592 },
+    {  1143435392,  1036349376 }, {  1115915008,  1065925888 },
+    {  1087629952,  1094771840 }, {  1058599488,  1122867584 },
+    {  1028843456,  1150193664 }, {   998382400,  1176731520 },
+    {   967236992,  1202462848 }, {   935428736,  1227370112 },
+    {   902979392,  1251436160 }, {   869911168,  1274644608 },
+    {   836246784,  1296979456 }, {   802009280,  1318425472 },
+    {   767222080,  1338967808 }, {   731909056,  1358592512 },
+    {   696094464,  1377286016 }, {   659802752,  1395035776 },
+    {   623058880,  1411829376 }, {   585888000,  1427655296 },
+    {   548315584,  1442502912 }, {   510367360,  1456361728 },
+    {   472069344,  1469222528 }, {   433447840,  1481076480 },
+    {   394529248,  1491915264 }, {   355340256,  1501731584 },
+    {   315907744,  1510518656 }, {   276258720,  1518270592 },
+    {   236420352,  1524981888 }, {   196419968,  1530648064 },
+    {   156284960,  1535265280 }, {   116042856,  1538830208 },
+    {    75721208,  1541340544 }, {    35347668,  1542794496 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_240_q32 = {
+    .n4 = 240/4, .w = mdct_rot_240_q32_w };
+
+#endif /* LC3_CONFIG_FFT_60 */
+
+#if LC3_CONFIG_FFT_80
+
+static const struct lc3_complex_q31
+    mdct_rot_320_q32_w[320/4] LC3_HOT_TABLE = {
+    {  1436104576,     3524738 }, {  1435758464,    31720094 },
+    {  1434859008,    59903220 }, {  1433406336,    88063256 },
+    {  1431400960,   116189336 }, {  1428843776,   144270624 },
+    {  1425735808,   172296304 }, {  1422078208,   200255536 },
+    {  1417872384,   228137584 }, {  1413119872,   255931680 },
+    {  1407822592,   283627104 }, {  1401982592,   311213184 },
+    {  1395602048,   338679296 }, {  1388683520,   366014848 },
+    {  1381229568,   393209248 }, {  1373243264,   420252096 },
+    {  1364727424,   447132928 }, {  1355685504,   473841376 },
+    {  1346120832,   500367168 }, {  1336037376,   526700032 },
+    {  1325438720,   552829824 }, {  1314329088,   578746560 },
+    {  1302712832,   604440128 }, {  1290594432,   629900672 },
+    {  1277978240,   655118400 }, {  1264869632,   680083520 },
+    {  1251273216,   704786496 }, {  1237194496,   729217728 },
+    {  1222638720,   753367872 }, {  1207611648,   777227584 },
+    {  1192119040,   800787648 }, {  1176166784,   824038976 },
+    {  1159761152,   846972672 }, {  1142908416,   869579776 },
+    {  1125615104,   891851648 }, {  1107887744,   913779712 },
+    {  1089733376,   935355520 }, {  1071158784,   956570752 },
+    {  1052171264,   977417152 }, {  1032778176,   997886720 },
+    {  1012986880,  1017971648 }, {   992805120,  1037664064 },
+    {   972240512,  1056956480 }, {   951301184,  1075841408 },
+    {   929995072,  1094311552 }, {   908330432,  1112359936 },
+    {   886315584,  1129979392 }, {   863959104,  1147163136 },
+    {   841269504,  1163904768 }, {   818255616,  1180197632 },
+    {   794926208,  1196035584 }, {   771290368,  1211412352 },
+    {   747357184,  1226322048 }, {   723135936,  1240759040 },
+    {   698635904,  1254717696 }, {   673866432,  1268192640 },
+    {   648837248,  1281178752 }, {   623557888,  1293670784 },
+    {   598038208,  1305664256 }, {   572287872,  1317154304 },
+    {   546316992,  1328136448 }, {   520135456,  1338606720 },
+    {   493753376,  1348560768 }, {   467180992,  1357995136 },
+    {   440428480,  1366905728 }, {   413506176,  1375289600 },
+    {   386424448,  1383143168 }, {   359193760,  1390463360 },
+    {   331824608,  1397247744 }, {   304327520,  1403493248 },
+    {   276713088,  1409197824 }, {   248991984,  1414359040 },
+    {   221174896,  1418975104 }, {   193272544,  1423044096 },
+    {   165295680,  1426564352 }, {   137255088,  1429534848 },
+    {   109161592,  1431954048 }, {    81026008,  1433821312 },
+    {    52859180,  1435135744 }, {    24671976,  1435896960 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_320_q32 = {
+    .n4 = 320/4, .w = mdct_rot_320_q32_w };
+
+#endif /* LC3_CONFIG_FFT_80 */
+
+#if LC3_CONFIG_FFT_90
+
+static const struct lc3_complex_q31
+    mdct_rot_360_q32_w[360/4] LC3_HOT_TABLE = {
+    {  1394434688,     3042190 }, {  1394169216,    27377968 },
+    {  1393479168,    51705408 }, {  1392364544,    76017096 },
+    {  1390825728,   100305632 }, {  1388863360,   124563616 },
+    {  1386477952,   148783648 }, {  1383670144,   172958368 },
+    {  1380440832,   197080400 }, {  1376791040,   221142384 },
+    {  1372721920,   245137024 }, {  1368234624,   269056992 },
+    {  1363330560,   292895008 }, {  1358011136,   316643776 },
+    {  1352278144,   340296128 }, {  1346133120,   363844800 },
+    {  1339578240,   387282656 }, {  1332615168,   410602528 },
+    {  1325246208,   433797312 }, {  1317473536,   456860000 },
+    {  1309299584,   479783488 }, {  1300726784,   502560864 },
+    {  1291757696,   525185120 }, {  1282395264,   547649408 },
+    {  1272642176,   569946880 }, {  1262501376,   592070720 },
+    {  1251976064,   614014272 }, {  1241069312,   635770752 },
+    {  1229784576,   657333568 }, {  1218125184,   678696128 },
+    {  1206094848,   699851968 }, {  1193697024,   720794624 },
+    {  1180935680,   741517760 }, {  1167814528,   762014976 },
+    {  1154337664,   782280128 }, {  1140509184,   802306944 },
+    {  1126333312,   822089408 }, {  1111814272,   841621376 },
+    {  1096956672,   860897024 }, {  1081764864,   879910464 },
+    {  1066243520,   898655872 }, {  1050397440,   917127488 },
+    {  1034231360,   935319744 }, {  1017750272,   953227136 },
+    {  1000959168,   970844160 }, {   983863104,   988165440 },
+    {   966467392,  1005185664 }, {   948777280,  1021899776 },
+    {   930798208,  1038302592 }, {   912535552,  1054389120 },
+    {   893994944,  1070154496 }, {   875182016,  1085593856 },
+    {   856102464,  1100702592 }, {   836762176,  1115475968 },
+    {   817166976,  1129909504 }, {   797322944,  1143998976 },
+    {   777235904,  1157739904 }, {   756912192,  1171128320 },
+    {   736357952,  1184159872 }, {   715579328,  1196830720 },
+    {   694582784,  1209137024 }, {   673374656,  1221074944 },
+    {   651961408,  1232641024 }, {   630349568,  1243831552 },
+    {   608545664,  1254643328 }, {   586556416,  1265072768 },
+    {   564388544,  1275116928 }, {   542048704,  1284772608 },
+    {   519543776,  1294036992 }, {   496880608,  1302907264 },
+    {   474066048,  1311380608 }, {   451107104,  1319454464 },
+    {   428010752,  1327126400 }, {   404784000,  1334393984 },
+    {   381433984,  1341255296 }, {   357967744,  1347707904 },
+    {   334392480,  1353750016 }, {   310715360,  1359379840 },
+    {   286943584,  1364595456 }, {   263084400,  1369395584 },
+    {   239145088,  1373778432 }, {   215132912,  1377742848 },
+    {   191055232,  1381287552 }, {   166919328,  1384411648 },
+    {   142732592,  1387113856 }, {   118502384,  1389393664 },
+    {    94236072,  1391250176 }, {    69941056,  1392683008 },
+    {    45624732,  1393691520 }, {    21294516,  1394275456 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_360_q32 = {
+    .n4 = 360/4, .w = mdct_rot_360_q32_w };
+
+#endif /* LC3_CONFIG_FFT_90 */
+
+#if LC3_CONFIG_FFT_120
+
+static const struct lc3_complex_q31
+    mdct_rot_480_q32_w[480/4] LC3_HOT_TABLE = {
+    {  1297669120,     2123308 }, {  1297530112,    19109090 },
+    {  1297168896,    36091596 }, {  1296585344,    53067920 },
+    {  1295779584,    70035152 }, {  1294751872,    86990384 },
+    {  1293502208,   103930712 }, {  1292030976,   120853224 },
+    {  1290338432,   137755040 }, {  1288424704,   154633248 },
+    {  1286290176,   171484960 }, {  1283935360,   188307280 },
+    {  1281360512,   205097344 }, {  1278566016,   221852256 },
+    {  1275552640,   238569168 }, {  1272320512,   255245200 },
+    {  1268870528,   271877504 }, {  1265202944,   288463200 },
+    {  1261318784,   304999488 }, {  1257218304,   321483488 },
+    {  1252902528,   337912448 }, {  1248372096,   354283488 },
+    {  1243627648,   370593824 }, {  1238670208,   386840640 },
+    {  1233500544,   403021184 }, {  1228119424,   419132704 },
+    {  1222528000,   435172352 }, {  1216727040,   451137472 },
+    {  1210717568,   467025280 }, {  1204500608,   482833088 },
+    {  1198077440,   498558176 }, {  1191448832,   514197792 },
+    {  1184616064,   529749312 }, {  1177580416,   545210048 },
+    {  1170342912,   560577408 }, {  1162904960,   575848704 },
+    {  1155267712,   591021376 }, {  1147432448,   606092672 },
+    {  1139400704,   621060160 }, {  1131173632,   635921280 },
+    {  1122752768,   650673408 }, {  1114139520,   665313984 },
+    {  1105335424,   679840640 }, {  1096341888,   694250816 },
+    {  1087160448,   708542016 }, {  1077792768,   722711808 },
+    {  1068240448,   736757760 }, {  1058505088,   750677504 },
+    {  1048588288,   764468544 }, {  1038491904,   778128704 },
+    {  1028217536,   791655488 }, {  1017767040,   805046592 },
+    {  1007142080,   818299776 }, {   996344576,   831412736 },
+    {   985376320,   844383296 }, {   974239296,   857209088 },
+    {   962935296,   869888000 }, {   951466368,   882417984 },
+    {   939834304,   894796672 }, {   928041280,   907022080 },
+    {   916089216,   919092032 }, {   903980224,   931004544 },
+    {   891716288,   942757504 }, {   879299520,   954348928 },
+    {   866732224,   965776896 }, {   854016320,   977039296 },
+    {   841154112,   988134336 }, {   828147776,   999060032 },
+    {   814999488,  1009814528 }, {   801711616,  1020396032 },
+    {   788286336,  1030802688 }, {   774726016,  1041032768 },
+    {   761032960,  1051084416 }, {   747209536,  1060955968 },
+    {   733257984,  1070645760 }, {   719180864,  1080152064 },
+    {   704980480,  1089473408 }, {   690659328,  1098607872 },
+    {   676219840,  1107554176 }, {   661664448,  1116310784 },
+    {   646995712,  1124876032 }, {   632216128,  1133248640 },
+    {   617328192,  1141426944 }, {   602334464,  1149409792 },
+    {   587237568,  1157195648 }, {   572040064,  1164783232 },
+    {   556744512,  1172171136 }, {   541353536,  1179358336 },
+    {   525869824,  1186343424 }, {   510296032,  1193125120 },
+    {   494634816,  1199702528 }, {   478888800,  1206074240 },
+    {   463060736,  1212239360 }, {   447153344,  1218196864 },
+    {   431169312,  1223945472 }, {   415111456,  1229484544 },
+    {   398982432,  1234812800 }, {   382785056,  1239929472 },
+    {   366522080,  1244833792 }, {   350196288,  1249524736 },
+    {   333810528,  1254001664 }, {   317367552,  1258263680 },
+    {   300870208,  1262310144 }, {   284321280,  1266140160 },
+    {   267723680,  1269753344 }, {   251080176,  1273149056 },
+    {   234393664,  1276326400 }, {   217666976,  1279285248 },
+    {   200903008,  1282024832 }, {   184104608,  1284544640 },
+    {   167274672,  1286844544 }, {   150416064,  1288923904 },
+    {   133531680,  1290782336 }, {   116624424,  1292419584 },
+    {    99697184,  1293835392 }, {    82752856,  1295029632 },
+    {    65794356,  1296001792 }, {    48824580,  1296752000 },
+    {    31846436,  1297280000 }, {    14862838,  1297585664 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_480_q32 = {
+    .n4 = 480/4, .w = mdct_rot_480_q32_w };
+
+#endif /* LC3_CONFIG_FFT_120 */
+
+#if LC3_CONFIG_FFT_160
+
+static const struct lc3_complex_q31
+    mdct_rot_640_q32_w[640/4] LC3_HOT_TABLE = {
+    {  1207617920,     1481971 }, {  1207545088,    13337470 },
+    {  1207356032,    25191684 }, {  1207050496,    37043468 },
+    {  1206628608,    48891684 }, {  1206090496,    60735188 },
+    {  1205436160,    72572832 }, {  1204665600,    84403488 },
+    {  1203778944,    96226008 }, {  1202776320,   108039256 },
+    {  1201657600,   119842088 }, {  1200423168,   131633368 },
+    {  1199073024,   143411968 }, {  1197607296,   155176736 },
+    {  1196026240,   166926544 }, {  1194329856,   178660272 },
+    {  1192518272,   190376784 }, {  1190591872,   202074944 },
+    {  1188550656,   213753632 }, {  1186394880,   225411696 },
+    {  1184124672,   237048064 }, {  1181740544,   248661568 },
+    {  1179242368,   260251104 }, {  1176630528,   271815552 },
+    {  1173905408,   283353824 }, {  1171067008,   294864768 },
+    {  1168115840,   306347296 }, {  1165052032,   317800288 },
+    {  1161875840,   329222688 }, {  1158587776,   340613312 },
+    {  1155188096,   351971136 }, {  1151677056,   363295008 },
+    {  1148054912,   374583904 }, {  1144322176,   385836672 },
+    {  1140479104,   397052256 }, {  1136526208,   408229568 },
+    {  1132463744,   419367520 }, {  1128292096,   430465088 },
+    {  1124011648,   441521120 }, {  1119622912,   452534624 },
+    {  1115126272,   463504544 }, {  1110522240,   474429728 },
+    {  1105811072,   485309216 }, {  1100993408,   496141952 },
+    {  1096069504,   506926816 }, {  1091040000,   517662880 },
+    {  1085905408,   528349024 }, {  1080666112,   538984192 },
+    {  1075322624,   549567488 }, {  1069875520,   560097792 },
+    {  1064325312,   570574144 }, {  1058672512,   580995456 },
+    {  1052917696,   591360768 }, {  1047061376,   601669056 },
+    {  1041104128,   611919424 }, {  1035046528,   622110784 },
+    {  1028889152,   632242176 }, {  1022632704,   642312640 },
+    {  1016277632,   652321216 }, {  1009824576,   662266880 },
+    {  1003274240,   672148736 }, {   996627200,   681965888 },
+    {   989884096,   691717184 }, {   983045568,   701401856 },
+    {   976112320,   711018880 }, {   969084992,   720567488 },
+    {   961964224,   730046528 }, {   954750784,   739455296 },
+    {   947445312,   748792768 }, {   940048512,   758058048 },
+    {   932561088,   767250240 }, {   924983808,   776368576 },
+    {   917317376,   785411968 }, {   909562560,   794379712 },
+    {   901720000,   803270912 }, {   893790592,   812084672 },
+    {   885775040,   820820160 }, {   877674048,   829476544 },
+    {   869488576,   838052992 }, {   861219264,   846548672 },
+    {   852866880,   854962688 }, {   844432384,   863294400 },
+    {   835916416,   871542848 }, {   827319936,   879707328 },
+    {   818643648,   887786944 }, {   809888512,   895781056 },
+    {   801055360,   903688832 }, {   792144960,   911509504 },
+    {   783158144,   919242304 }, {   774095936,   926886528 },
+    {   764959104,   934441408 }, {   755748544,   941906240 },
+    {   746465088,   949280256 }, {   737109760,   956562816 },
+    {   727683328,   963753152 }, {   718186816,   970850624 },
+    {   708621056,   977854464 }, {   698987008,   984764096 },
+    {   689285568,   991578816 }, {   679517696,   998297984 },
+    {   669684352,  1004920896 }, {   659786432,  1011446976 },
+    {   649824960,  1017875584 }, {   639800832,  1024206080 },
+    {   629715072,  1030437888 }, {   619568512,  1036570304 },
+    {   609362368,  1042602816 }, {   599097408,  1048534912 },
+    {   588774720,  1054365888 }, {   578395328,  1060095296 },
+    {   567960192,  1065722496 }, {   557470272,  1071246976 },
+    {   546926592,  1076668160 }, {   536330272,  1081985664 },
+    {   525682208,  1087198848 }, {   514983488,  1092307200 },
+    {   504235136,  1097310336 }, {   493438176,  1102207744 },
+    {   482593696,  1106998912 }, {   471702688,  1111683328 },
+    {   460766208,  1116260608 }, {   449785312,  1120730240 },
+    {   438761056,  1125091968 }, {   427694528,  1129345152 },
+    {   416586784,  1133489536 }, {   405438880,  1137524736 },
+    {   394251904,  1141450240 }, {   383026912,  1145265664 },
+    {   371765024,  1148970880 }, {   360467296,  1152565120 },
+    {   349134816,  1156048512 }, {   337768672,  1159420288 },
+    {   326370016,  1162680448 }, {   314939872,  1165828480 },
+    {   303479392,  1168864128 }, {   291989664,  1171787136 },
+    {   280471776,  1174597248 }, {   268926848,  1177294080 },
+    {   257356032,  1179877504 }, {   245760384,  1182347264 },
+    {   234141072,  1184702976 }, {   222499184,  1186944512 },
+    {   210835840,  1189071616 }, {   199152176,  1191084160 },
+    {   187449328,  1192981888 }, {   175728416,  1194764672 },
+    {   163990560,  1196432256 }, {   152236896,  1197984640 },
+    {   140468560,  1199421440 }, {   128686696,  1200742656 },
+    {   116892416,  1201948160 }, {   105086880,  1203037824 },
+    {    93271208,  1204011520 }, {    81446544,  1204869120 },
+    {    69614040,  1205610624 }, {    57774816,  1206236032 },
+    {    45930028,  1206745088 }, {    34080812,  1207137792 },
+    {    22228312,  1207414272 }, {    10373671,  1207574272 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_640_q32 = {
+    .n4 = 640/4, .w = mdct_rot_640_q32_w };
+
+#endif /* LC3_CONFIG_FFT_160 */
+
+#if LC3_CONFIG_FFT_180
+
+static const struct lc3_complex_q31
+    mdct_rot_720_q32_w[720/4] LC3_HOT_TABLE = {
+    {  1172577280,     1279084 }, {  1172521472,    11511572 },
+    {  1172376448,    21743184 }, {  1172141952,    31973140 },
+    {  1171818368,    42200660 }, {  1171405440,    52424968 },
+    {  1170903296,    62645284 }, {  1170312064,    72860832 },
+    {  1169631744,    83070824 }, {  1168862208,    93274496 },
+    {  1168003840,   103471064 }, {  1167056384,   113659744 },
+    {  1166020096,   123839776 }, {  1164894976,   134010376 },
+    {  1163681152,   144170768 }, {  1162378752,   154320192 },
+    {  1160987776,   164457856 }, {  1159508480,   174582992 },
+    {  1157940864,   184694832 }, {  1156285056,   194792608 },
+    {  1154541056,   204875568 }, {  1152709248,   214942896 },
+    {  1150789632,   224993872 }, {  1148782464,   235027712 },
+    {  1146687744,   245043664 }, {  1144505600,   255040944 },
+    {  1142236416,   265018800 }, {  1139880320,   274976480 },
+    {  1137437312,   284913216 }, {  1134907648,   294828256 },
+    {  1132291584,   304720832 }, {  1129589376,   314590208 },
+    {  1126801024,   324435648 }, {  1123926912,   334256352 },
+    {  1120967296,   344051616 }, {  1117922176,   353820672 },
+    {  1114792064,   363562784 }, {  1111576960,   373277216 },
+    {  1108277120,   382963232 }, {  1104893056,   392620064 },
+    {  1101424768,   402247008 }, {  1097872640,   411843296 },
+    {  1094236800,   421408256 }, {  1090517760,   430941088 },
+    {  1086715648,   440441120 }, {  1082830720,   449907616 },
+    {  1078863360,   459339840 }, {  1074813824,   468737088 },
+    {  1070682368,   478098656 }, {  1066469504,   487423808 },
+    {  1062175360,   496711808 }, {  1057800320,   505962016 },
+    {  1053344768,   515173696 }, {  1048808960,   524346112 },
+    {  1044193280,   533478624 }, {  1039498112,   542570496 },
+    {  1034723776,   551621056 }, {  1029870656,   560629568 },
+    {  1024939072,   569595456 }, {  1019929472,   578517952 },
+    {  1014842176,   587396352 }, {  1009677568,   596230080 },
+    {  1004436096,   605018368 }, {   999118208,   613760512 },
+    {   993724160,   622456000 }, {   988254400,   631104064 },
+    {   982709440,   639704128 }, {   977089600,   648255360 },
+    {   971395392,   656757312 }, {   965627136,   665209216 },
+    {   959785408,   673610496 }, {   953870592,   681960384 },
+    {   947883136,   690258432 }, {   941823424,   698503872 },
+    {   935692096,   706696128 }, {   929489472,   714834624 },
+    {   923216000,   722918592 }, {   916872320,   730947584 },
+    {   910458752,   738920832 }, {   903975872,   746837888 },
+    {   897424128,   754697984 }, {   890804032,   762500672 },
+    {   884116160,   770245248 }, {   877360960,   777931200 },
+    {   870538816,   785557888 }, {   863650560,   793124736 },
+    {   856696448,   800631232 }, {   849677056,   808076736 },
+    {   842593024,   815460672 }, {   835444736,   822782592 },
+    {   828232896,   830041792 }, {   820957952,   837237824 },
+    {   813620544,   844370048 }, {   806221120,   851437952 },
+    {   798760320,   858441088 }, {   791238656,   865378816 },
+    {   783656832,   872250624 }, {   776015232,   879056000 },
+    {   768314560,   885794496 }, {   760555392,   892465472 },
+    {   752738304,   899068480 }, {   744863872,   905603072 },
+    {   736932736,   912068672 }, {   728945472,   918464768 },
+    {   720902720,   924790976 }, {   712805056,   931046784 },
+    {   704653120,   937231616 }, {   696447488,   943345088 },
+    {   688188864,   949386752 }, {   679877760,   955356096 },
+    {   671514944,   961252736 }, {   663100928,   967076160 },
+    {   654636480,   972825920 }, {   646122176,   978501504 },
+    {   637558656,   984102656 }, {   628946560,   989628864 },
+    {   620286592,   995079744 }, {   611579328,  1000454848 },
+    {   602825536,  1005753664 }, {   594025856,  1010975936 },
+    {   585180928,  1016121280 }, {   576291392,  1021189184 },
+    {   567358080,  1026179328 }, {   558381440,  1031091264 },
+    {   549362304,  1035924736 }, {   540301376,  1040679360 },
+    {   531199264,  1045354688 }, {   522056704,  1049950400 },
+    {   512874400,  1054466176 }, {   503653024,  1058901696 },
+    {   494393344,  1063256448 }, {   485095936,  1067530368 },
+    {   475761632,  1071722880 }, {   466391104,  1075833856 },
+    {   456985024,  1079862784 }, {   447544192,  1083809664 },
+    {   438069216,  1087673856 }, {   428560928,  1091455360 },
+    {   419020000,  1095153536 }, {   409447136,  1098768512 },
+    {   399843104,  1102299648 }, {   390208608,  1105746944 },
+    {   380544416,  1109110016 }, {   370851232,  1112388608 },
+    {   361129824,  1115582592 }, {   351380896,  1118691456 },
+    {   341605216,  1121715200 }, {   331803520,  1124653568 },
+    {   321976576,  1127506176 }, {   312125088,  1130273024 },
+    {   302249824,  1132953728 }, {   292351552,  1135548160 },
+    {   282431040,  1138056192 }, {   272488992,  1140477440 },
+    {   262526192,  1142811904 }, {   252543408,  1145059328 },
+    {   242541392,  1147219584 }, {   232520912,  1149292416 },
+    {   222482704,  1151277824 }, {   212427568,  1153175424 },
+    {   202356256,  1154985344 }, {   192269536,  1156707200 },
+    {   182168160,  1158340992 }, {   172052928,  1159886592 },
+    {   161924576,  1161343872 }, {   151783904,  1162712704 },
+    {   141631680,  1163992960 }, {   131468656,  1165184640 },
+    {   121295624,  1166287488 }, {   111113352,  1167301504 },
+    {   100922624,  1168226816 }, {    90724216,  1169063040 },
+    {    80518888,  1169810176 }, {    70307432,  1170468224 },
+    {    60090620,  1171037312 }, {    49869236,  1171517056 },
+    {    39644052,  1171907584 }, {    29415850,  1172209024 },
+    {    19185406,  1172420992 }, {     8953502,  1172543872 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_720_q32 = {
+    .n4 = 720/4, .w = mdct_rot_720_q32_w };
+
+#endif /* LC3_CONFIG_FFT_180 */
+
+#if LC3_CONFIG_FFT_240
+
+static const struct lc3_complex_q31
+    mdct_rot_960_q32_w[960/4] LC3_HOT_TABLE = {
+    {  1091206400,      892741 }, {  1091177216,     8034601 },
+    {  1091101184,    15176115 }, {  1090978560,    22316980 },
+    {  1090809088,    29456888 }, {  1090592896,    36595536 },
+    {  1090330112,    43732616 }, {  1090020480,    50867824 },
+    {  1089664256,    58000848 }, {  1089261312,    65131392 },
+    {  1088811648,    72259144 }, {  1088315392,    79383800 },
+    {  1087772544,    86505056 }, {  1087183104,    93622608 },
+    {  1086547072,   100736144 }, {  1085864448,   107845376 },
+    {  1085135360,   114949984 }, {  1084359808,   122049664 },
+    {  1083537792,   129144112 }, {  1082669312,   136233040 },
+    {  1081754496,   143316128 }, {  1080793344,   150393072 },
+    {  1079785856,   157463568 }, {  1078732160,   164527328 },
+    {  1077632256,   171584032 }, {  1076486144,   178633408 },
+    {  1075293952,   185675104 }, {  1074055552,   192708864 },
+    {  1072771392,   199734368 }, {  1071441152,   206751312 },
+    {  1070065024,   213759392 }, {  1068643072,   220758320 },
+    {  1067175360,   227747808 }, {  1065661888,   234727520 },
+    {  1064102784,   241697184 }, {  1062498048,   248656496 },
+    {  1060847872,   255605152 }, {  1059152256,   262542864 },
+    {  1057411264,   269469312 }, {  1055624896,   276384256 },
+    {  1053793344,   283287328 }, {  1051916736,   290178272 },
+    {  1049995008,   297056768 }, {  1048028288,   303922560 },
+    {  1046016704,   310775328 }, {  1043960256,   317614784 },
+    {  1041859136,   324440640 }, {  1039713408,   331252608 },
+    {  1037523072,   338050368 }, {  1035288320,   344833664 },
+    {  1033009280,   351602176 }, {  1030685952,   358355616 },
+    {  1028318400,   365093728 }, {  1025906880,   371816192 },
+    {  1023451392,   378522720 }, {  1020952064,   385213024 },
+    {  1018409024,   391886848 }, {  1015822272,   398543872 },
+    {  1013192128,   405183840 }, {  1010518528,   411806432 },
+    {  1007801600,   418411392 }, {  1005041536,   424998432 },
+    {  1002238464,   431567232 }, {   999392448,   438117632 },
+    {   996503552,   444649216 }, {   993572032,   451161696 },
+    {   990597888,   457654912 }, {   987581376,   464128512 },
+    {   984522496,   470582272 }, {   981421504,   477015808 },
+    {   978278464,   483428928 }, {   975093440,   489821344 },
+    {   971866752,   496192768 }, {   968598336,   502542944 },
+    {   965288512,   508871584 }, {   961937280,   515178464 },
+    {   958544896,   521463232 }, {   955111360,   527725696 },
+    {   951636992,   533965536 }, {   948121856,   540182528 },
+    {   944566080,   546376320 }, {   940969856,   552546752 },
+    {   937333312,   558693504 }, {   933656640,   564816320 },
+    {   929939968,   570914944 }, {   926183424,   576989120 },
+    {   922387200,   583038592 }, {   918551488,   589063040 },
+    {   914676480,   595062336 }, {   910762240,   601036096 },
+    {   906808960,   606984064 }, {   902816896,   612906112 },
+    {   898786112,   618801856 }, {   894716864,   624671104 },
+    {   890609280,   630513600 }, {   886463488,   636329024 },
+    {   882279808,   642117312 }, {   878058240,   647878016 },
+    {   873799168,   653610944 }, {   869502592,   659315904 },
+    {   865168768,   664992640 }, {   860797888,   670640832 },
+    {   856390208,   676260352 }, {   851945792,   681850880 },
+    {   847464832,   687412224 }, {   842947584,   692944128 },
+    {   838394304,   698446272 }, {   833804992,   703918592 },
+    {   829180096,   709360704 }, {   824519616,   714772480 },
+    {   819823808,   720153600 }, {   815092864,   725503872 },
+    {   810327040,   730823040 }, {   805526464,   736110912 },
+    {   800691456,   741367296 }, {   795822080,   746591872 },
+    {   790918592,   751784512 }, {   785981312,   756944896 },
+    {   781010368,   762072896 }, {   776005888,   767168192 },
+    {   770968192,   772230720 }, {   765897472,   777260096 },
+    {   760793920,   782256192 }, {   755657856,   787218816 },
+    {   750489344,   792147648 }, {   745288704,   797042624 },
+    {   740056128,   801903424 }, {   734791872,   806729856 },
+    {   729496128,   811521728 }, {   724169216,   816278912 },
+    {   718811200,   821001024 }, {   713422400,   825688000 },
+    {   708003008,   830339648 }, {   702553344,   834955712 },
+    {   697073536,   839536000 }, {   691563904,   844080320 },
+    {   686024640,   848588480 }, {   680456000,   853060288 },
+    {   674858176,   857495552 }, {   669231488,   861894080 },
+    {   663576128,   866255680 }, {   657892288,   870580224 },
+    {   652180288,   874867456 }, {   646440384,   879117184 },
+    {   640672768,   883329280 }, {   634877696,   887503488 },
+    {   629055488,   891639744 }, {   623206272,   895737792 },
+    {   617330368,   899797440 }, {   611428032,   903818560 },
+    {   605499520,   907800960 }, {   599545024,   911744448 },
+    {   593564864,   915648960 }, {   587559296,   919514176 },
+    {   581528576,   923340032 }, {   575472896,   927126272 },
+    {   569392576,   930872896 }, {   563287872,   934579584 },
+    {   557159040,   938246208 }, {   551006400,   941872704 },
+    {   544830016,   945458816 }, {   538630400,   949004480 },
+    {   532407712,   952509440 }, {   526162176,   955973632 },
+    {   519894144,   959396800 }, {   513603840,   962779008 },
+    {   507291488,   966119872 }, {   500957440,   969419328 },
+    {   494601920,   972677312 }, {   488225216,   975893632 },
+    {   481827552,   979068096 }, {   475409344,   982200704 },
+    {   468970688,   985291200 }, {   462511968,   988339456 },
+    {   456033440,   991345408 }, {   449535360,   994308864 },
+    {   443018048,   997229760 }, {   436481760,  1000107904 },
+    {   429926784,  1002943232 }, {   423353376,  1005735616 },
+    {   416761824,  1008484928 }, {   410152416,  1011190976 },
+    {   403525472,  1013853760 }, {   396881216,  1016473088 },
+    {   390219968,  1019048832 }, {   383541984,  1021580992 },
+    {   376847584,  1024069376 }, {   370137056,  1026513920 },
+    {   363410656,  1028914432 }, {   356668672,  1031270912 },
+    {   349911456,  1033583168 }, {   343139200,  1035851200 },
+    {   336352288,  1038074816 }, {   329550944,  1040254016 },
+    {   322735488,  1042388608 }, {   315906208,  1044478592 },
+    {   309063392,  1046523776 }, {   302207328,  1048524160 },
+    {   295338336,  1050479616 }, {   288456672,  1052390144 },
+    {   281562688,  1054255488 }, {   274656608,  1056075712 },
+    {   267738784,  1057850752 }, {   260809472,  1059580416 },
+    {   253869008,  1061264704 }, {   246917648,  1062903488 },
+    {   239955728,  1064496832 }, {   232983520,  1066044544 },
+    {   226001328,  1067546560 }, {   219009472,  1069002816 },
+    {   212008224,  1070413376 }, {   204997888,  1071777984 },
+    {   197978784,  1073096704 }, {   190951184,  1074369536 },
+    {   183915424,  1075596288 }, {   176871760,  1076776960 },
+    {   169820544,  1077911552 }, {   162762032,  1078999936 },
+    {   155696560,  1080041984 }, {   148624416,  1081037952 },
+    {   141545920,  1081987456 }, {   134461344,  1082890752 },
+    {   127371008,  1083747584 }, {   120275224,  1084557952 },
+    {   113174280,  1085321984 }, {   106068488,  1086039424 },
+    {    98958152,  1086710400 }, {    91843584,  1087334784 },
+    {    84725080,  1087912576 }, {    77602944,  1088443904 },
+    {    70477488,  1088928384 }, {    63349008,  1089366400 },
+    {    56217816,  1089757696 }, {    49084212,  1090102272 },
+    {    41948508,  1090400128 }, {    34811008,  1090651392 },
+    {    27672018,  1090855808 }, {    20531842,  1091013632 },
+    {    13390785,  1091124608 }, {     6249156,  1091188864 },
+};
+
+static const struct lc3_mdct_rot_def_q32 mdct_rot_960_q32 = {
+    .n4 = 960/4, .w = mdct_rot_960_q32_w };
+
+#endif /* LC3_CONFIG_FFT_240 */
+
+const struct lc3_mdct_rot_def_q32
+    *lc3_mdct_rot_q32[LC3_NUM_DT][LC3_NUM_SRATE] = {
+
+#if LC3_CONFIG_DT_7M5
+    [LC3_DT_7M5] = {
+#if LC3_CONFIG_7M5_8K
+        [LC3_SRATE_8K ] = &mdct_rot_120_q32,
+#endif
+#if LC3_CONFIG_7M5_16K
+        [LC3_SRATE_16K] = &mdct_rot_240_q32,
+#endif
+#if LC3_CONFIG_7M5_24K
+        [LC3_SRATE_24K] = &mdct_rot_360_q32,
+#endif
+#if LC3_CONFIG_7M5_32K
+        [LC3_SRATE_32K] = &mdct_rot_480_q32,
+#endif
+#if LC3_CONFIG_7M5_48K
+        [LC3_SRATE_48K] = &mdct_rot_720_q32,
+#endif
+    },
+#endif
+
+#if LC3_CONFIG_DT_10M
+    [LC3_DT_10M] = {
+#if LC3_CONFIG_10M_8K
+        [LC3_SRATE_8K ] = &mdct_rot_160_q32,
+#endif
+#if LC3_CONFIG_10M_16K
+        [LC3_SRATE_16K] = &mdct_rot_320_q32,
+#endif
+#if LC3_CONFIG_10M_24K
+        [LC3_SRATE_24K] = &mdct_rot_480_q32,
+#endif
+#if LC3_CONFIG_10M_32K
+        [LC3_SRATE_32K] = &mdct_rot_640_q32,
+#endif
+#if LC3_CONFIG_10M_48K
+        [LC3_SRATE_48K] = &mdct_rot_960_q32,
+#endif
+    },
+#endif
+};
+
+
+/**
+ * Low delay MDCT windows, Q30
+ */
+
+#if LC3_CONFIG_7M5_8K
+
+static const int32_t mdct_win_7m5_60_q30[60+46] LC3_HOT_TABLE = {
+       3168192,     7704539,    14784928,    24798450,    38014352,
+      54577148,    74592448,    98127576,   125203208,   155771536,
+     189742176,   226927760,   267113264,   309990432,   355219424,
+     402454048,   451302304,   501335328,   552102336,   603131584,
+     653937088,   704021376,   752927488,   800196096,   845431232,
+     888224832,   928264512,   965269632,   999017472,  1029288832,
+    1055968960,  1078984704,  1098280960,  1113905024,  1125923456,
+    1134474624,  1139770240,  1142059520,  1141666432,  1138966272,
+    1134339456,  1128175104,  1120905216,  1112908928,  1104589056,
+    1096360064,  1088781312,  1081552768,  1075591296,  1070852992,
+    1067283456,  1064811904,  1063353728,  1062813952,  1063084672,
+    1064051648,  1065595200,  1067592640,  1069918400,  1072444352,
+    1075040896,  1077578880,  1079926400,  1081950720,  1083520256,
+    1084505856,  1084782080,  1084231424,  1082746624,  1080239232,
+    1076638464,  1071895488,  1065987264,  1058910144,  1049726720,
+    1038788608,  1025562752,  1009735936,   991019968,   969167232,
+     944036672,   915517120,   883562048,   848225664,   809633920,
+     768000000,   723634240,   676902656,   628223616,   578100992,
+     527028736,   475545024,   424225760,   373666816,   324481248,
+     277269600,   232616944,   191042416,   152987328,   118811888,
+      88798016,    63171936,    42093992,    25622606,    13633968,
+       5751663,
+};
+
+#endif /* LC3_CONFIG_7M5_8K */
+
+#if LC3_CONFIG_7M5_16K
+
+static const int32_t mdct_win_7m5_120_q30[120+92] LC3_HOT_TABLE = {
+       2371089,     4091111,     6351747,     9216586,    12751728,
+      17001124,    22002972,    27797414,    34404396,    41834776,
+      50116060,    59254372,    69260472,    80145280,    91912320,
+     104565992,   118104728,   132520440,   147806416,   163950112,
+     180939840,   198742208,   217336528,   236706784,   256804624,
+     277590368,   299035520,   321090080,   343709984,   366853152,
+     390476992,   414531648,   438962048,   463718016,   488742560,
+     513975072,   539367168,   564853632,   590376832,   615873472,
+     641283008,   666546944,   691596736,   716375168,   740837696,
+     764912192,   788552128,   811713024,   834337088,   856371520,
+     877774144,   898503872,   918529536,   937806976,   956312832,
+     974022080,   990901312,  1006915712,  1022052096,  1036301120,
+    1049643328,  1062066176,  1073577472,  1084157952,  1093801728,
+    1102533760,  1110345472,  1117241216,  1123250304,  1128379904,
+    1132650368,  1136096384,  1138739840,  1140610816,  1141750656,
+    1142198784,  1141995648,  1141195904,  1139841280,  1137969920,
+    1135652480,  1132926592,  1129833984,  1126449408,  1122810368,
+    1118955264,  1114953088,  1110842624,  1106675584,  1102509184,
+    1098390144,  1094365568,  1090785152,  1086852352,  1083239680,
+    1079946496,  1076965888,  1074294400,  1071926400,  1069853376,
+    1068070464,  1066565184,  1065331136,  1064355840,  1063628352,
+    1063136576,  1062868800,  1062809728,  1062947264,  1063265536,
+    1063751232,  1064387968,  1065162048,  1066056704,  1067057856,
+    1068148032,  1069313216,  1070536000,  1071801408,  1073091648,
+    1074392320,  1075685760,  1076957184,  1078188800,  1079364864,
+    1080467712,  1081482368,  1082390656,  1083177856,  1083826176,
+    1084321408,  1084646016,  1084786304,  1084726016,  1084452864,
+    1083951488,  1083210624,  1082218880,  1080966784,  1079443328,
+    1077644416,  1075560320,  1073189568,  1070527424,  1067572864,
+    1064327232,  1060789376,  1056964736,  1052149888,  1047188032,
+    1041723392,  1035709888,  1029101568,  1021862912,  1013956160,
+    1005334400,   995982016,   985859712,   974932352,   963200192,
+     950638784,   937224064,   922966784,   907851520,   891871360,
+     875042304,   857371456,   838874176,   819578304,   799498304,
+     778676800,   757152960,   734966144,   712154112,   688780864,
+     664898880,   640550464,   615812416,   590744704,   565398656,
+     539857152,   514172960,   488421408,   462673344,   437006432,
+     411494400,   386203552,   361215456,   336614208,   312470208,
+     288857568,   265841664,   243512224,   221918560,   201122944,
+     181182816,   162148304,   144065920,   126974976,   110907584,
+      95897744,    81972648,    69157272,    57471356,    46931584,
+      37545220,    29311502,    22215268,    16226937,    11298851,
+       7361008,     4320212,
+};
+
+#endif /* LC3_CONFIG_7M5_16K */
+
+#if LC3_CONFIG_7M5_24K
+
+static const int32_t mdct_win_7m5_180_q30[180+138] LC3_HOT_TABLE = {
+       2116183,     3168192,     4428624,     5934450,     7704539,
+       9757712,    12113859,    14784928,    17781194,    21115230,
+      24798450,    28842090,    33246542,    38014352,    43155360,
+      48676088,    54577148,    60861344,    67531416,    74592448,
+      82045288,    89889376,    98127576,   106761504,   115786656,
+     125203208,   135008544,   145198688,   155771536,   166724000,
+     178050224,   189742176,   201786992,   214182704,   226927760,
+     240007664,   253406400,   267113264,   281120448,   295417696,
+     309990432,   324821984,   339902432,   355219424,   370758304,
+     386508384,   402454048,   418578720,   434866528,   451302304,
+     467871744,   484555872,   501335328,   518197504,   535126592,
+     552102336,   569106240,   586122752,   603131584,   620116160,
+     637056064,   653937088,   670738816,   687439104,   704021376,
+     720476416,   736785088,   752927488,   768883392,   784643392,
+     800196096,   815523136,   830605824,   845431232,   859984640,
+     874252800,   888224832,   901891968,   915242624,   928264512,
+     940945792,   953283328,   965269632,   976893888,   988147776,
+     999017472,  1009499456,  1019590656,  1029288832,  1038587776,
+    1047483648,  1055968960,  1064048064,  1071722432,  1078984704,
+    1085829760,  1092257792,  1098280960,  1103900416,  1109107712,
+    1113905024,  1118303872,  1122309760,  1125923456,  1129150592,
+    1131997696,  1134474624,  1136592256,  1138353280,  1139770240,
+    1140850048,  1141608448,  1142059520,  1142208768,  1142072320,
+    1141666432,  1141008512,  1140104448,  1138966272,  1137613312,
+    1136067584,  1134339456,  1132434944,  1130371456,  1128175104,
+    1125860096,  1123433472,  1120905216,  1118297216,  1115628544,
+    1112908928,  1110150144,  1107371264,  1104589056,  1101818368,
+    1099071232,  1096360064,  1093673344,  1091520512,  1088781312,
+    1086228992,  1083819904,  1081552768,  1079428480,  1077441152,
+    1075591296,  1073879168,  1072300352,  1070852992,  1069536576,
+    1068347968,  1067283456,  1066341120,  1065518336,  1064811904,
+    1064217792,  1063732736,  1063353728,  1063076928,  1062898432,
+    1062813952,  1062819584,  1062911232,  1063084672,  1063335424,
+    1063659200,  1064051648,  1064507968,  1065024064,  1065595200,
+    1066216832,  1066884224,  1067592640,  1068337664,  1069114368,
+    1069918400,  1070744576,  1071588224,  1072444352,  1073308096,
+    1074175744,  1075040896,  1075899776,  1076747520,  1077578880,
+    1078389248,  1079173376,  1079926400,  1080643456,  1081319936,
+    1081950720,  1082530944,  1083055744,  1083520256,  1083920000,
+    1084250112,  1084505856,  1084682752,  1084776320,  1084782080,
+    1084695808,  1084513664,  1084231424,  1083845120,  1083351040,
+    1082746624,  1082028800,  1081193984,  1080239232,  1079162880,
+    1077963648,  1076638464,  1075185280,  1073604480,  1071895488,
+    1070055232,  1068085056,  1065987264,  1063757504,  1061398272,
+    1058910144,  1056252736,  1052894720,  1049726720,  1046313152,
+    1042670848,  1038788608,  1034651072,  1030246016,  1025562752,
+    1020593024,  1015322560,  1009735936,  1003827008,   997592640,
+     991019968,   984094656,   976809216,   969167232,   961165440,
+     952791424,   944036672,   934906688,   925401600,   915517120,
+     905247936,   894593280,   883562048,   872154944,   860373696,
+     848225664,   835712768,   822848832,   809633920,   796080768,
+     782196736,   768000000,   753500224,   738708224,   723634240,
+     708296576,   692713280,   676902656,   660870528,   644637952,
+     628223616,   611656512,   594944064,   578100992,   561153280,
+     544125952,   527028736,   509883520,   492714976,   475545024,
+     458387392,   441276736,   424225760,   407260960,   390399008,
+     373666816,   357087008,   340684832,   324481248,   308496128,
+     292749248,   277269600,   262071232,   247185008,   232616944,
+     218397456,   204532960,   191042416,   177947664,   165255728,
+     152987328,   141147632,   129752872,   118811888,   108331672,
+      98324560,    88798016,    79759208,    71215112,    63171936,
+      55634932,    48608116,    42093992,    36093204,    30604144,
+      25622606,    21141356,    17149860,    13633968,    10575688,
+       7953469,     5751663,     4114864,
+};
+
+#endif /* LC3_CONFIG_7M5_24K */
+
+#if LC3_CONFIG_7M5_32K
+
+static const int32_t mdct_win_7m5_240_q30[240+184] LC3_HOT_TABLE = {
+       1984630,     2753953,     3615956,     4603525,     5731958,
+       7008090,     8440820,    10035494,    11802234,    13745095,
+      15870539,    18179206,    20679442,    23375030,    26272958,
+      29372910,    32676028,    36183000,    39898484,    43824576,
+      47964912,    52319464,    56889056,    61673848,    66675992,
+      71898800,    77341448,    83004448,    88887096,    94992016,
+     101319088,   107868392,   114636784,   121626688,   128834440,
+     136261616,   143903792,   151762192,   159834208,   168119712,
+     176614016,   185316112,   194217440,   203317648,   212614032,
+     222107936,   231794352,   241665648,   251714512,   261937504,
+     272330976,   282892384,   293615232,   304494048,   315522752,
+     326693856,   338004160,   349448320,   361021440,   372715936,
+     384528608,   396451968,   408481248,   420606176,   432822144,
+     445121760,   457501760,   469951360,   482464640,   495032416,
+     507650144,   520310368,   533007264,   545731904,   558476800,
+     571232896,   583995392,   596755200,   609504960,   622236352,
+     634941184,   647614912,   660248320,   672832320,   685357440,
+     697817728,   710207616,   722523584,   734754816,   746895296,
+     758933376,   770864384,   782684096,   794389376,   805971008,
+     817422528,   828734272,   839903424,   850920320,   861784576,
+     872485248,   883020736,   893385984,   903578688,   913591424,
+     923420544,   933060032,   942507328,   951760384,   960815744,
+     969672192,   978321216,   986761856,   994985984,  1002994496,
+    1010782272,  1018350656,  1025697920,  1032823680,  1039721792,
+    1046393792,  1052834304,  1059046528,  1065029504,  1070785088,
+    1076310144,  1081601024,  1086655744,  1091476352,  1096069504,
+    1100435968,  1104573952,  1108479232,  1112153600,  1115600896,
+    1118825984,  1121830016,  1124613760,  1127179136,  1129527040,
+    1131662592,  1133586432,  1135312128,  1136832000,  1138152064,
+    1139279488,  1140213376,  1140962048,  1141530240,  1141926912,
+    1142149760,  1142207104,  1142104448,  1141849344,  1141448320,
+    1140908928,  1140230400,  1139419392,  1138482816,  1137430528,
+    1136270848,  1135008384,  1133645312,  1132185344,  1130637184,
+    1129012736,  1127320832,  1125562880,  1123742720,  1121863680,
+    1119935488,  1117966720,  1115965056,  1113933824,  1111878528,
+    1109803520,  1107719040,  1105631488,  1103548288,  1101473536,
+    1099412736,  1097372800,  1095366016,  1093351680,  1091865472,
+    1089764096,  1087804160,  1085920256,  1084113280,  1082385792,
+    1080739968,  1079172736,  1077682048,  1076268672,  1074933504,
+    1073674752,  1072490432,  1071380224,  1070344256,  1069381248,
+    1068489600,  1067668096,  1066915968,  1066231872,  1065614656,
+    1065063296,  1064576256,  1064151360,  1063787392,  1063483520,
+    1063238272,  1063049472,  1062915392,  1062834752,  1062805824,
+    1062826496,  1062895104,  1063010176,  1063169984,  1063372096,
+    1063614784,  1063896640,  1064215616,  1064569472,  1064956352,
+    1065374784,  1065822720,  1066297984,  1066798336,  1067322368,
+    1067868096,  1068433216,  1069015616,  1069613888,  1070225984,
+    1070849280,  1071481856,  1072122048,  1072767808,  1073416576,
+    1074067200,  1074716672,  1075364096,  1076006656,  1076642176,
+    1077269248,  1077885696,  1078488960,  1079076864,  1079647872,
+    1080199936,  1080730496,  1081237632,  1081719808,  1082174592,
+    1082599808,  1082993280,  1083353344,  1083678080,  1083965312,
+    1084212736,  1084418816,  1084581760,  1084699264,  1084769280,
+    1084790400,  1084760832,  1084678528,  1084541696,  1084349184,
+    1084099072,  1083789440,  1083418624,  1082986240,  1082491008,
+    1081931008,  1081304704,  1080611328,  1079850112,  1079019904,
+    1078120192,  1077150208,  1076108672,  1074994688,  1073808896,
+    1072551488,  1071220928,  1069816064,  1068338176,  1066788992,
+    1065166848,  1063469632,  1061699968,  1059861248,  1057955072,
+    1055918976,  1053286400,  1050959936,  1048474816,  1045870528,
+    1043138944,  1040273280,  1037267840,  1034115520,  1030811712,
+    1027351616,  1023733632,  1019951104,  1015998272,  1011868352,
+    1007558208,  1003065792,   998389952,   993525056,   988465408,
+     983203712,   977739200,   972074624,   966209536,   960139392,
+     953858688,   947364160,   940656768,   933739200,   926609984,
+     919268160,   911712256,   903937088,   895945280,   887742464,
+     879329344,   870702528,   861866048,   852823488,   843576320,
+     834124096,   824476096,   814632000,   804587648,   794364032,
+     783949568,   773360192,   762597376,   751666880,   740572480,
+     729318912,   717912576,   706362112,   694674176,   682856448,
+     670917184,   658851776,   646677248,   634397888,   622028736,
+     609575168,   597040640,   584430848,   571756544,   559028736,
+     546258944,   533446912,   520603584,   507738272,   494861760,
+     481982400,   469108192,   456245824,   443413056,   430609024,
+     417855072,   405146624,   392499616,   379924608,   367430272,
+     355027168,   342725024,   330533504,   318459136,   306514336,
+     294701760,   283048640,   271531168,   260192864,   249028368,
+     238038720,   227244640,   216645584,   206246736,   196053616,
+     186085904,   176339760,   166819376,   157536272,   148497840,
+     139699264,   131152528,   122861256,   114827104,   107054840,
+      99549208,    92313600,    85351016,    78664104,    72255752,
+      66128976,    60286096,    54728700,    49458380,    44476548,
+      39783660,    35379220,    31262350,    27431570,    23884068,
+      20615914,    17622488,    14897911,    12434612,    10224316,
+       8258550,     6519845,     4966928,     3872828,
+};
+
+#endif /* LC3_CONFIG_7M5_32K */
+
+#if LC3_CONFIG_7M5_48K
+
+static const int32_t mdct_win_7m5_360_q30[360+276] LC3_HOT_TABLE = {
+       1848475,     2371089,     2887311,     3464035,     4091111,
+       4782145,     5533735,     6351747,     7235615,     8191167,
+       9216586,    10317998,    11495561,    12751728,    14086433,
+      15503770,    17001124,    18582506,    20249130,    22002972,
+      23843670,    25775942,    27797414,    29909328,    32111232,
+      34404396,    36787472,    39264696,    41834776,    44499708,
+      47259760,    50116060,    53065892,    56112512,    59254372,
+      62492328,    65826800,    69260472,    72790456,    76419048,
+      80145280,    83969624,    87891088,    91912320,    96030920,
+     100249112,   104565992,   108981272,   113493176,   118104728,
+     122812752,   127617984,   132520440,   137520560,   142615008,
+     147806416,   153092656,   158474112,   163950112,   169521120,
+     175183696,   180939840,   186785952,   192720272,   198742208,
+     204853664,   211050928,   217336528,   223709200,   230167104,
+     236706784,   243328464,   250027520,   256804624,   263658000,
+     270587168,   277590368,   284668736,   291817152,   299035520,
+     306322016,   313674848,   321090080,   328569568,   336109664,
+     343709984,   351368416,   359084192,   366853152,   374676800,
+     382551936,   390476992,   398449632,   406469600,   414531648,
+     422636128,   430780096,   438962048,   447179616,   455433408,
+     463718016,   472032736,   480374944,   488742560,   497131872,
+     505544096,   513975072,   522424192,   530888800,   539367168,
+     547854720,   556351744,   564853632,   573359680,   581868032,
+     590376832,   598880832,   607380992,   615873472,   624355840,
+     632825472,   641283008,   649723328,   658145920,   666546944,
+     674924160,   683274048,   691596736,   699887424,   708147584,
+     716375168,   724568256,   732722176,   740837696,   748908864,
+     756934464,   764912192,   772842240,   780721792,   788552128,
+     796328320,   804049728,   811713024,   819317888,   826858816,
+     834337088,   841750336,   849094912,   856371520,   863579840,
+     870713216,   877774144,   884760128,   891670400,   898503872,
+     905260224,   911935232,   918529536,   925040448,   931467008,
+     937806976,   944063360,   950231936,   956312832,   962305856,
+     968210624,   974022080,   979742784,   985369920,   990901312,
+     996335680,  1001675072,  1006915712,  1012058944,  1017104576,
+    1022052096,  1026900992,  1031651776,  1036301120,  1040849536,
+    1045297152,  1049643328,  1053885376,  1058027136,  1062066176,
+    1066004672,  1069841536,  1073577472,  1077207936,  1080735488,
+    1084157952,  1087475328,  1090688640,  1093801728,  1096812800,
+    1099723904,  1102533760,  1105241088,  1107844352,  1110345472,
+    1112743680,  1115041792,  1117241216,  1119341824,  1121344384,
+    1123250304,  1125056128,  1126766720,  1128379904,  1129897728,
+    1131321472,  1132650368,  1133887744,  1135038976,  1136096384,
+    1137065984,  1137945600,  1138739840,  1139448448,  1140070784,
+    1140610816,  1141068928,  1141447296,  1141750656,  1141975936,
+    1142124160,  1142198784,  1142200832,  1142132224,  1141995648,
+    1141792384,  1141524864,  1141195904,  1140805376,  1140352896,
+    1139841280,  1139271808,  1138647296,  1137969920,  1137244672,
+    1136471296,  1135652480,  1134788096,  1133879552,  1132926592,
+    1131933312,  1130900864,  1129833984,  1128735360,  1127607552,
+    1126449408,  1125263872,  1124050176,  1122810368,  1121545472,
+    1120260096,  1118955264,  1117635328,  1116300672,  1114953088,
+    1113592704,  1112222720,  1110842624,  1109456640,  1108066688,
+    1106675584,  1105283712,  1103895168,  1102509184,  1101129088,
+    1099754880,  1098390144,  1097034496,  1095694208,  1094365568,
+    1093069056,  1092167424,  1090785152,  1089437568,  1088127104,
+    1086852352,  1085613696,  1084408832,  1083239680,  1082105856,
+    1081008768,  1079946496,  1078919168,  1077924992,  1076965888,
+    1076040576,  1075150720,  1074294400,  1073472320,  1072682560,
+    1071926400,  1071202368,  1070511872,  1069853376,  1069227776,
+    1068633216,  1068070464,  1067537856,  1067036672,  1066565184,
+    1066124480,  1065712832,  1065331136,  1064977600,  1064653120,
+    1064355840,  1064086592,  1063843776,  1063628352,  1063438528,
+    1063275264,  1063136576,  1063023424,  1062933888,  1062868800,
+    1062826304,  1062807232,  1062809728,  1062834752,  1062880320,
+    1062947264,  1063033728,  1063140416,  1063265536,  1063409856,
+    1063571456,  1063751232,  1063947200,  1064160064,  1064387968,
+    1064631744,  1064889536,  1065162048,  1065447360,  1065746176,
+    1066056704,  1066379776,  1066713216,  1067057856,  1067411776,
+    1067775808,  1068148032,  1068529216,  1068917312,  1069313216,
+    1069714944,  1070123200,  1070536000,  1070954176,  1071375744,
+    1071801408,  1072229248,  1072659968,  1073091648,  1073525184,
+    1073958528,  1074392320,  1074824832,  1075256576,  1075685760,
+    1076113152,  1076536704,  1076957184,  1077372672,  1077783808,
+    1078188800,  1078588160,  1078979840,  1079364864,  1079741184,
+    1080109440,  1080467712,  1080816768,  1081154688,  1081482368,
+    1081797504,  1082100864,  1082390656,  1082667648,  1082929792,
+    1083177856,  1083409792,  1083626624,  1083826176,  1084009472,
+    1084174208,  1084321408,  1084448896,  1084557824,  1084646016,
+    1084714368,  1084760832,  1084786304,  1084788992,  1084769536,
+    1084726016,  1084659712,  1084568320,  1084452864,  1084311424,
+    1084144896,  1083951488,  1083731968,  1083484672,  1083210624,
+    1082908032,  1082578176,  1082218880,  1081831296,  1081413632,
+    1080966784,  1080489088,  1079981824,  1079443328,  1078874880,
+    1078274944,  1077644416,  1076981504,  1076287360,  1075560320,
+    1074802176,  1074011392,  1073189568,  1072334784,  1071447936,
+    1070527424,  1069574848,  1068589376,  1067572864,  1066523712,
+    1065442496,  1064327232,  1063179712,  1061999808,  1060789376,
+    1059546688,  1058272192,  1056964736,  1055627008,  1053714880,
+    1052149888,  1050549504,  1048895936,  1047188032,  1045424384,
+    1043603328,  1041723392,  1039782208,  1037778944,  1035709888,
+    1033575616,  1031373056,  1029101568,  1026759616,  1024347968,
+    1021862912,  1019304384,  1016669120,  1013956160,  1011162432,
+    1008289280,  1005334400,  1002299392,   999182080,   995982016,
+     992695360,   989322624,   985859712,   982307008,   978663744,
+     974932352,   971110976,   967201216,   963200192,   959107456,
+     954920128,   950638784,   946260800,   941789312,   937224064,
+     932565696,   927812544,   922966784,   918023488,   912986816,
+     907851520,   902620096,   897291584,   891871360,   886354560,
+     880746304,   875042304,   869244160,   863352832,   857371456,
+     851296256,   845132160,   838874176,   832529984,   826097920,
+     819578304,   812971840,   806274560,   799498304,   792641728,
+     785697792,   778676800,   771578240,   764402880,   757152960,
+     749828928,   742432448,   734966144,   727428032,   719824064,
+     712154112,   704423808,   696631488,   688780864,   680875072,
+     672916160,   664898880,   656830016,   648713600,   640550464,
+     632342016,   624096128,   615812416,   607491584,   599135104,
+     590744704,   582322624,   573872896,   565398656,   556902976,
+     548390912,   539857152,   531308384,   522745984,   514172960,
+     505592736,   497008416,   488421408,   479836448,   471253824,
+     462673344,   454105088,   445550112,   437006432,   428479520,
+     419977600,   411494400,   403033984,   394602336,   386203552,
+     377836128,   369506944,   361215456,   352970048,   344768320,
+     336614208,   328512992,   320462880,   312470208,   304535840,
+     296659200,   288857568,   281118976,   273438272,   265841664,
+     258319408,   250876560,   243512224,   236225344,   229030560,
+     221918560,   214899120,   207966208,   201122944,   194376672,
+     187732464,   181182816,   174737824,   168389856,   162148304,
+     156012784,   149988272,   144065920,   138257728,   132559400,
+     126974976,   121504280,   116148200,   110907584,   105785368,
+     100781408,    95897744,    91134064,    86492456,    81972648,
+      77576696,    73304256,    69157272,    65135328,    61240188,
+      57471356,    53830404,    50316700,    46931584,    43674272,
+      40545808,    37545220,    34673192,    31928536,    29311502,
+      26820694,    24455816,    22215268,    20098102,    18102580,
+      16226937,    14469433,    12827211,    11298851,     9879831,
+       8569795,     7361008,     6256236,     5238127,     4320212,
+       3386782,
+};
+
+#endif /* LC3_CONFIG_7M5_48K */
+
+#if LC3_CONFIG_10M_8K
+
+static const int32_t mdct_win_10m_80_q30[80+50] LC3_HOT_TABLE = {
+       -760053,    -2252923,    -4858895,    -8841165,   -14363585,
+     -21471846,   -30074536,   -39959324,   -50806976,   -62219632,
+     -73740368,   -84875504,   -95130360,  -104027368,  -111128120,
+    -116046416,  -118459736,  -118091184,  -114694112,  -108038872,
+     -97887160,   -83973240,   -65999560,   -43630028,   -16496213,
+      15785670,    53576888,    97177600,   146770960,   202366656,
+     263760048,   330475072,   401755776,   476538944,   553485504,
+     631001728,   707340288,   780672256,   849195904,   911246400,
+     965435648,  1010750592,  1046644352,  1073109888,  1090664448,
+    1100302080,  1103413888,  1101649920,  1096749056,  1090320256,
+    1083799552,  1077508736,  1072549760,  1068709632,  1065790144,
+    1063624192,  1062077952,  1061049216,  1060454208,  1060218752,
+    1060269056,  1060529536,  1060925696,  1061385920,  1061848000,
+    1062260864,  1062590592,  1062823936,  1062971456,  1063069184,
+    1063173504,  1063353920,  1063681280,  1064217600,  1065008576,
+    1066077440,  1067423488,  1069020992,  1070820480,  1072752384,
+    1074732160,  1076671104,  1078483456,  1080097536,  1081461376,
+    1082546688,  1083351296,  1083897472,  1084231168,  1084415232,
+    1084521600,  1084621312,  1084771840,  1085010048,  1085346944,
+    1085768832,  1086241536,  1086712704,  1087118720,  1087385856,
+    1087437440,  1087195904,  1086586240,  1085533824,  1083955712,
+    1081752832,  1078797696,  1074935168,  1069988160,  1063777472,
+    1054818816,  1042476800,  1025072640,  1000894208,   968300800,
+     925993216,   873254592,   810090112,   737293504,   656430784,
+     569746944,   480103232,   390746976,   305119520,   226582016,
+     158085712,   101819344,    58867216,    29006722,    10733922,
+};
+
+#endif /* LC3_CONFIG_10M_8K */
+
+#if LC3_CONFIG_10M_16K
+
+static const int32_t mdct_win_10m_160_q30[160+100] LC3_HOT_TABLE = {
+       -496058,    -1046594,    -1787214,    -2788622,    -4086968,
+      -5717255,    -7705048,   -10074362,   -12834117,   -15993687,
+     -19549256,   -23488864,   -27793506,   -32436266,   -37383372,
+     -42596068,   -48025228,   -53625092,   -59338568,   -65108668,
+     -70877288,   -76578904,   -82153904,   -87541784,   -92676136,
+     -97500176,  -101955840,  -105986224,  -109543432,  -112575264,
+    -115038800,  -116897216,  -118108344,  -118637568,  -118457976,
+    -117534112,  -115838952,  -113345528,  -110020976,  -105838888,
+    -100767288,   -94771784,   -87819120,   -79873352,   -70890472,
+     -60834516,   -49654728,   -37308080,   -23746676,    -8923252,
+       7213073,    24702956,    43595060,    63922416,    85720616,
+     109009832,   133806632,   160111280,   187912064,   217185744,
+     247889984,   279963712,   313333408,   347902624,   383559392,
+     420170944,   457582784,   495631232,   534129824,   572876352,
+     611662016,   650267072,   688465088,   726027008,   762721856,
+     798321024,   832609664,   865375488,   896422976,   925577088,
+     952688128,   977627264,  1000293888,  1020615296,  1038562496,
+    1054135040,  1067359168,  1078302592,  1087064192,  1093768192,
+    1098565504,  1101629568,  1103159680,  1103361920,  1102452224,
+    1100651648,  1098176384,  1095226496,  1091991680,  1088683904,
+    1085601152,  1082088960,  1078948096,  1076152448,  1073676672,
+    1071492928,  1069576064,  1067900416,  1066443776,  1065183808,
+    1064102912,  1063183616,  1062412608,  1061775680,  1061262656,
+    1060862464,  1060566528,  1060364352,  1060248064,  1060207296,
+    1060233856,  1060317184,  1060449024,  1060618752,  1060818048,
+    1061037120,  1061268736,  1061503552,  1061735552,  1061957312,
+    1062164608,  1062351936,  1062517312,  1062657792,  1062774528,
+    1062867520,  1062941120,  1062998592,  1063046720,  1063091904,
+    1063143296,  1063208640,  1063297984,  1063419136,  1063582080,
+    1063793472,  1064061248,  1064390080,  1064785408,  1065249216,
+    1065784000,  1066388480,  1067062144,  1067800640,  1068600384,
+    1069454208,  1070355392,  1071294080,  1072261504,  1073246016,
+    1074237824,  1075224192,  1076195200,  1077138944,  1078046592,
+    1078908032,  1079716096,  1080463360,  1081145856,  1081759104,
+    1082302208,  1082773632,  1083175680,  1083510528,  1083783168,
+    1083998592,  1084164736,  1084288256,  1084379392,  1084445952,
+    1084498432,  1084544512,  1084593664,  1084652288,  1084727424,
+    1084822272,  1084941440,  1085084928,  1085253760,  1085445248,
+    1085657088,  1085883904,  1086121216,  1086361472,  1086598656,
+    1086823040,  1087027200,  1087201280,  1087336448,  1087421952,
+    1087449088,  1087407232,  1087288064,  1087080832,  1086777600,
+    1086367744,  1085842816,  1085191808,  1084404864,  1083468032,
+    1082368640,  1081089792,  1079615232,  1077923840,  1075995392,
+    1073806976,  1071336640,  1068560640,  1065459072,  1062012032,
+    1057352512,  1052118144,  1045972544,  1038666112,  1029991104,
+    1019730880,  1007667392,   993594304,   977318400,   958673024,
+     937531008,   913799424,   887430400,   858422400,   826827520,
+     792746688,   756323776,   717755200,   677290048,   635204160,
+     591814592,   547491904,   502620384,   457604384,   412872224,
+     368854880,   325988512,   284695616,   245380496,   208415648,
+     174132512,   142809296,   114658496,    89819120,    68345688,
+      50213948,    35305412,    23440402,    14349286,     7256482,
+};
+
+#endif /* LC3_CONFIG_10M_16K */
+
+#if LC3_CONFIG_10M_24K
+
+static const int32_t mdct_win_10m_240_q30[240+150] LC3_HOT_TABLE = {
+       -387996,     -760053,    -1153675,    -1646560,    -2252923,
+      -2983307,    -3848430,    -4858895,    -6022970,    -7347867,
+      -8841165,   -10506902,   -12346746,   -14363585,   -16559050,
+     -18929852,   -21471846,   -24181530,   -27051920,   -30074536,
+     -33240524,   -36539396,   -39959324,   -43487116,   -47107408,
+     -50806976,   -54571052,   -58381132,   -62219632,   -66071912,
+     -69918936,   -73740368,   -77518232,   -81236040,   -84875504,
+     -88416656,   -91840624,   -95130360,   -98269832,  -101241480,
+    -104027368,  -106613152,  -108985704,  -111128120,  -113026040,
+    -114669184,  -116046416,  -117144944,  -117953168,  -118459736,
+    -118657560,  -118538672,  -118091184,  -117305520,  -116176096,
+    -114694112,  -112849816,  -110634072,  -108038872,  -105056192,
+    -101675880,   -97887160,   -93680160,   -89045880,   -83973240,
+     -78449104,   -72461128,   -65999560,   -59050404,   -51598068,
+     -43630028,   -35133324,   -26093242,   -16496213,    -6325880,
+       4430899,    15785670,    27753414,    40347488,    53576888,
+      67452824,    81984456,    97177600,   113037864,   129568800,
+     146770960,   164641552,   183175488,   202366656,   222205504,
+     242675632,   263760048,   285437728,   307685408,   330475072,
+     353773184,   377546048,   401755776,   426354912,   451298304,
+     476538944,   502021792,   527690272,   553485504,   579343616,
+     605203840,   631001728,   656667776,   682136448,   707340288,
+     732209344,   756675840,   780672256,   804132672,   826994880,
+     849195904,   870674560,   891375296,   911246400,   930241408,
+     948317696,   965435648,   981565440,   996677504,  1010750592,
+    1023771968,  1035736576,  1046644352,  1056501312,  1065316096,
+    1073109888,  1079911680,  1085750528,  1090664448,  1094695936,
+    1097891328,  1100302080,  1101985664,  1103002368,  1103413888,
+    1103281536,  1102671488,  1101649920,  1100280576,  1098626816,
+    1096749056,  1094702976,  1092543232,  1090320256,  1088195328,
+    1086256128,  1083799552,  1081540608,  1079446784,  1077508736,
+    1075718400,  1074068224,  1072549760,  1071155776,  1069878016,
+    1068709632,  1067643072,  1066672192,  1065790144,  1064991936,
+    1064271232,  1063624192,  1063045312,  1062531328,  1062077952,
+    1061682048,  1061339904,  1061049216,  1060806272,  1060609024,
+    1060454208,  1060339392,  1060261888,  1060218752,  1060207424,
+    1060225088,  1060269056,  1060336128,  1060424064,  1060529536,
+    1060650304,  1060783040,  1060925696,  1061075136,  1061229632,
+    1061385920,  1061542656,  1061697216,  1061848000,  1061993152,
+    1062131200,  1062260864,  1062381248,  1062491264,  1062590592,
+    1062679104,  1062756672,  1062823936,  1062881216,  1062930048,
+    1062971456,  1063007168,  1063038912,  1063069184,  1063099968,
+    1063133952,  1063173504,  1063221696,  1063280960,  1063353920,
+    1063443328,  1063551616,  1063681280,  1063834112,  1064012352,
+    1064217600,  1064451392,  1064714752,  1065008576,  1065333504,
+    1065689920,  1066077440,  1066496128,  1066945088,  1067423488,
+    1067929984,  1068463040,  1069020992,  1069601472,  1070202176,
+    1070820480,  1071453760,  1072098688,  1072752384,  1073411008,
+    1074072704,  1074732160,  1075387520,  1076034816,  1076671104,
+    1077293184,  1077898240,  1078483456,  1079046656,  1079585280,
+    1080097536,  1080581888,  1081036800,  1081461376,  1081854592,
+    1082216576,  1082546688,  1082845440,  1083113344,  1083351296,
+    1083560192,  1083741824,  1083897472,  1084029696,  1084140032,
+    1084231168,  1084305664,  1084366080,  1084415232,  1084455552,
+    1084490240,  1084521600,  1084552448,  1084584832,  1084621312,
+    1084663552,  1084713472,  1084771840,  1084840576,  1084919680,
+    1085010048,  1085111552,  1085223936,  1085346944,  1085479424,
+    1085620480,  1085768832,  1085923072,  1086081152,  1086241536,
+    1086401536,  1086559744,  1086712704,  1086858880,  1086994944,
+    1087118720,  1087226880,  1087316992,  1087385856,  1087430912,
+    1087448960,  1087437440,  1087393152,  1087313664,  1087195904,
+    1087037184,  1086835072,  1086586240,  1086288640,  1085938560,
+    1085533824,  1085070592,  1084545920,  1083955712,  1083296768,
+    1082563584,  1081752832,  1080858368,  1079875456,  1078797696,
+    1077619584,  1076334208,  1074935168,  1073415552,  1071768896,
+    1069988160,  1068067008,  1065999296,  1063777472,  1061371648,
+    1058209920,  1054818816,  1051166144,  1047072640,  1042476800,
+    1037321088,  1031541248,  1025072640,  1017851328,  1009812224,
+    1000894208,   991039616,   980191552,   968300800,   955325632,
+     941232320,   925993216,   909588288,   892008832,   873254592,
+     853333952,   832268992,   810090112,   786834112,   762548992,
+     737293504,   711135168,   684154368,   656430784,   628053760,
+     599120832,   569746944,   540041024,   510120672,   480103232,
+     450117920,   420289696,   390746976,   361618816,   333034752,
+     305119520,   277995392,   251779632,   226582016,   202507456,
+     179647824,   158085712,   137892400,   119123336,   101819344,
+      86005800,    71691224,    58867216,    47508660,    37574104,
+      29006722,    21736510,    15685186,    10733922,     5696453,
+};
+
+#endif /* LC3_CONFIG_10M_24K */
+
+#if LC3_CONFIG_10M_32K
+
+static const int32_t mdct_win_10m_320_q30[320+200] LC3_HOT_TABLE = {
+       -324394,     -630044,     -898347,    -1209716,    -1578930,
+      -2011627,    -2511796,    -3083795,    -3732602,    -4462432,
+      -5276973,    -6179570,    -7173265,    -8261173,    -9445450,
+     -10727221,   -12107235,   -13586422,   -15165948,   -16845824,
+     -18624182,   -20498776,   -22468550,   -24531616,   -26684714,
+     -28923884,   -31245376,   -33645748,   -36120252,   -38663520,
+     -41270360,   -43934788,   -46650376,   -49411308,   -52211752,
+     -55045096,   -57903084,   -60777912,   -63663408,   -66553400,
+     -69439160,   -72311600,   -75162992,   -77986480,   -80775288,
+     -83521288,   -86215888,   -88851328,   -91419728,   -93913528,
+     -96326120,   -98650720,  -100879944,  -103005536,  -105021008,
+    -106921616,  -108701456,  -110352856,  -111869000,  -113245432,
+    -114478152,  -115562040,  -116491568,  -117261992,  -117868520,
+    -118305824,  -118570288,  -118660104,  -118571320,  -118298344,
+    -117836440,  -117183152,  -116336416,  -115291952,  -114045360,
+    -112593232,  -110931744,  -109057072,  -106966216,  -104655504,
+    -102120616,   -99356592,   -96358936,   -93124312,   -89649000,
+     -85927688,   -81955272,   -77726088,   -73235384,   -68479080,
+     -63451548,   -58146516,   -52557652,   -46679284,   -40506496,
+     -34033188,   -27253498,   -20161534,   -12750269,    -5013407,
+       3053826,    11456569,    20200906,    29293352,    38738568,
+      48540676,    58704028,    69233432,    80131872,    91402168,
+     103046832,   115067624,   127465592,   140241536,   153394368,
+     166922272,   180822592,   195093296,   209731184,   224730208,
+     240082832,   255782512,   271820928,   288188192,   304874112,
+     321867456,   339154144,   356719648,   374549568,   392628768,
+     410937408,   429455040,   448163008,   467042208,   486069664,
+     505221504,   524473408,   543801408,   563178304,   582577344,
+     601973184,   621339264,   640645568,   659863616,   678965824,
+     697924288,   716709120,   735291200,   753641728,   771732864,
+     789536128,   807024576,   824171904,   840951872,   857338176,
+     873305920,   888831936,   903895040,   918474624,   932552192,
+     946109824,   959130304,   971601984,   983510720,   994844928,
+    1005595712,  1015757312,  1025325568,  1034298816,  1042677312,
+    1050463552,  1057660032,  1064270592,  1070304768,  1075775488,
+    1080693632,  1085072000,  1088927232,  1092277376,  1095140224,
+    1097535744,  1099486208,  1101015680,  1102147968,  1102909440,
+    1103326336,  1103424896,  1103230208,  1102771456,  1102076928,
+    1101174016,  1100088320,  1098846720,  1097475456,  1095998720,
+    1094438528,  1092817024,  1091155072,  1089488640,  1087967872,
+    1086570880,  1084682240,  1082930816,  1081270144,  1079699712,
+    1078217600,  1076820480,  1075504640,  1074267008,  1073104128,
+    1072012992,  1070989888,  1070031488,  1069135296,  1068298240,
+    1067516672,  1066788416,  1066110784,  1065481344,  1064897792,
+    1064357056,  1063858496,  1063399296,  1062977728,  1062592128,
+    1062241024,  1061923008,  1061636480,  1061379712,  1061152320,
+    1060952704,  1060779328,  1060631232,  1060507264,  1060406784,
+    1060327808,  1060269504,  1060230912,  1060211008,  1060208192,
+    1060221248,  1060249536,  1060291712,  1060346176,  1060411968,
+    1060487936,  1060573312,  1060666368,  1060765760,  1060871168,
+    1060981120,  1061094336,  1061210048,  1061327040,  1061444992,
+    1061562176,  1061677888,  1061792000,  1061903232,  1062010880,
+    1062114304,  1062213184,  1062307264,  1062395648,  1062477952,
+    1062554624,  1062625088,  1062689536,  1062747456,  1062799808,
+    1062846592,  1062887872,  1062924352,  1062956544,  1062985536,
+    1063011392,  1063035008,  1063057792,  1063080576,  1063104064,
+    1063129408,  1063157696,  1063190592,  1063228544,  1063272704,
+    1063324800,  1063385408,  1063455936,  1063536896,  1063629888,
+    1063735872,  1063855040,  1063988544,  1064137280,  1064301952,
+    1064482816,  1064680064,  1064894656,  1065126912,  1065376448,
+    1065643584,  1065928320,  1066230976,  1066550656,  1066887168,
+    1067240704,  1067610240,  1067995328,  1068394944,  1068808832,
+    1069236288,  1069675584,  1070125952,  1070586688,  1071056448,
+    1071533952,  1072017472,  1072506304,  1072999168,  1073493696,
+    1073990016,  1074484992,  1074978816,  1075468928,  1075954304,
+    1076433920,  1076906240,  1077369856,  1077823488,  1078266368,
+    1078697600,  1079115520,  1079519232,  1079908608,  1080282496,
+    1080640512,  1080981504,  1081305600,  1081612544,  1081901568,
+    1082172928,  1082426496,  1082662528,  1082880768,  1083081344,
+    1083265408,  1083433088,  1083584512,  1083720448,  1083841920,
+    1083949952,  1084044672,  1084127232,  1084199040,  1084260992,
+    1084313984,  1084359040,  1084397696,  1084431360,  1084460160,
+    1084486016,  1084509952,  1084533248,  1084556544,  1084580608,
+    1084606976,  1084636544,  1084669440,  1084706560,  1084748800,
+    1084796544,  1084849920,  1084909056,  1084974848,  1085046784,
+    1085125120,  1085209216,  1085299456,  1085395584,  1085496704,
+    1085602304,  1085712384,  1085826176,  1085942784,  1086061184,
+    1086181120,  1086301824,  1086421504,  1086540032,  1086656000,
+    1086768640,  1086876672,  1086978432,  1087073792,  1087161344,
+    1087239168,  1087306752,  1087362560,  1087405824,  1087434752,
+    1087448192,  1087445248,  1087424896,  1087385344,  1087325568,
+    1087244544,  1087141504,  1087014528,  1086862720,  1086685056,
+    1086480640,  1086247936,  1085985152,  1085692160,  1085367168,
+    1085008512,  1084614912,  1084184960,  1083716992,  1083209344,
+    1082659328,  1082066304,  1081427456,  1080740480,  1080003200,
+    1079213184,  1078368128,  1077464960,  1076500864,  1075473408,
+    1074379904,  1073216960,  1071981888,  1070671936,  1069284608,
+    1067816768,  1066265920,  1064630784,  1062911744,  1061064192,
+    1058647424,  1056096768,  1053493504,  1050679424,  1047610816,
+    1044262592,  1040612224,  1036633984,  1032300096,  1027583040,
+    1022456448,  1016892416,  1010863936,  1004344960,   997311808,
+     989739008,   981603648,   972884672,   963564288,   953625792,
+     943056064,   931843584,   919978816,   907455168,   894270464,
+     880424768,   865920256,   850762880,   834963584,   818535552,
+     801493120,   783853632,   765638848,   746873920,   727586048,
+     707805824,   687569088,   666908800,   645860992,   624465408,
+     602763712,   580807232,   558639616,   536310496,   513868576,
+     491362784,   468848320,   446378240,   424005248,   401783808,
+     379768416,   358013440,   336573664,   315501632,   294848704,
+     274666464,   255003184,   235904944,   217417200,   199581760,
+     182436016,   166014688,   150349440,   135467280,   121390208,
+     108134928,    95713608,    84134248,    73399072,    63503364,
+      54437560,    46189344,    38740828,    32065328,    26131898,
+      20913004,    16382188,    12496073,     9054959,     4777796,
+};
+
+#endif /* LC3_CONFIG_10M_32K */
+
+#if LC3_CONFIG_10M_48K
+
+static const int32_t mdct_win_10m_480_q30[480+300] LC3_HOT_TABLE = {
+       -252655,     -496058,     -672477,     -851389,    -1046594,
+      -1267291,    -1513127,    -1787214,    -2090137,    -2423523,
+      -2788622,    -3186445,    -3618998,    -4086968,    -4592258,
+      -5135138,    -5717255,    -6338732,    -7001248,    -7705048,
+      -8451876,    -9241251,   -10074362,   -10950311,   -11870437,
+     -12834117,   -13842743,   -14895628,   -15993687,   -17135380,
+     -18321134,   -19549256,   -20820562,   -22133636,   -23488864,
+     -24884250,   -26319854,   -27793506,   -29305246,   -30852800,
+     -32436266,   -34053080,   -35702976,   -37383372,   -39093784,
+     -40831636,   -42596068,   -44383928,   -46194556,   -48025228,
+     -49875548,   -51742452,   -53625092,   -55519868,   -57425452,
+     -59338568,   -61258292,   -63181888,   -65108668,   -67034820,
+     -68958960,   -70877288,   -72788552,   -74689448,   -76578904,
+     -78453816,   -80313296,   -82153904,   -83974248,   -85770608,
+     -87541784,   -89284184,   -90996712,   -92676136,   -94321504,
+     -95929856,   -97500176,   -99029016,  -100515472,  -101955840,
+    -103349320,  -104692880,  -105986224,  -107226768,  -108413592,
+    -109543432,  -110615144,  -111625808,  -112575264,  -113460888,
+    -114282944,  -115038800,  -115727888,  -116347512,  -116897216,
+    -117374544,  -117779120,  -118108344,  -118362024,  -118538176,
+    -118637568,  -118657752,  -118598800,  -118457976,  -118234632,
+    -117926584,  -117534112,  -117055464,  -116491200,  -115838952,
+    -115098376,  -114267216,  -113345528,  -112330880,  -111223440,
+    -110020976,  -108723768,  -107329776,  -105838888,  -104248640,
+    -102558944,  -100767288,   -98873368,   -96874824,   -94771784,
+     -92561848,   -90245232,   -87819120,   -85283288,   -82634968,
+     -79873352,   -76995848,   -74002232,   -70890472,   -67660224,
+     -64308460,   -60834516,   -57234800,   -53509144,   -49654728,
+     -45671132,   -41555912,   -37308080,   -32924592,   -28405036,
+     -23746676,   -18948758,   -14007836,    -8923252,    -3691813,
+       1686113,     7213073,    12890024,    18719596,    24702956,
+      30843034,    37139616,    43595060,    50209272,    56984916,
+      63922416,    71024240,    78289664,    85720616,    93316832,
+     101080056,   109009832,   117107816,   125372944,   133806632,
+     142407472,   151176208,   160111280,   169213280,   178480032,
+     187912064,   197507504,   207266336,   217185744,   227264704,
+     237499728,   247889984,   258432256,   269124864,   279963712,
+     290947424,   302071392,   313333408,   324728544,   336253376,
+     347902624,   359673408,   371560096,   383559392,   395664800,
+     407871040,   420170944,   432560416,   445032512,   457582784,
+     470203776,   482889216,   495631232,   508423936,   521258720,
+     534129824,   547028224,   559946688,   572876352,   585810944,
+     598741760,   611662016,   624561856,   637433344,   650267072,
+     663056192,   675791296,   688465088,   701067904,   713591744,
+     726027008,   738366528,   750600448,   762721856,   774720768,
+     786590144,   798321024,   809906944,   821338816,   832609664,
+     843710912,   854635648,   865375488,   875924992,   886275776,
+     896422976,   906358976,   916079040,   925577088,   934848640,
+     943886848,   952688128,   961247296,   969562176,   977627264,
+     985440064,   992996160,  1000293888,  1007330368,  1014104960,
+    1020615296,  1026862592,  1032844544,  1038562496,  1044016000,
+    1049206976,  1054135040,  1058802432,  1063209088,  1067359168,
+    1071255296,  1074902528,  1078302592,  1081460480,  1084379008,
+    1087064192,  1089520128,  1091753472,  1093768192,  1095571456,
+    1097168000,  1098565504,  1099769600,  1100789120,  1101629568,
+    1102300032,  1102807168,  1103159680,  1103364096,  1103429632,
+    1103361920,  1103171456,  1102864896,  1102452224,  1101940096,
+    1101338112,  1100651648,  1099891712,  1099063168,  1098176384,
+    1097235968,  1096251648,  1095226496,  1094172160,  1093090048,
+    1091991680,  1090876032,  1089765760,  1088683904,  1087751552,
+    1086858752,  1085601152,  1084387584,  1083217536,  1082088960,
+    1081002112,  1079955200,  1078948096,  1077978880,  1077047680,
+    1076152448,  1075293056,  1074467840,  1073676672,  1072917312,
+    1072190080,  1071492928,  1070825856,  1070186752,  1069576064,
+    1068991744,  1068433856,  1067900416,  1067391744,  1066906176,
+    1066443776,  1066002496,  1065583040,  1065183808,  1064804864,
+    1064444160,  1064102912,  1063779264,  1063473280,  1063183616,
+    1062911104,  1062653888,  1062412608,  1062185664,  1061973824,
+    1061775680,  1061591744,  1061420352,  1061262656,  1061117120,
+    1060984256,  1060862464,  1060752960,  1060654144,  1060566528,
+    1060488832,  1060422016,  1060364352,  1060316736,  1060277760,
+    1060248064,  1060226240,  1060213184,  1060207296,  1060209344,
+    1060217920,  1060233856,  1060255616,  1060283904,  1060317184,
+    1060356416,  1060400192,  1060449024,  1060501504,  1060558592,
+    1060618752,  1060682624,  1060748672,  1060818048,  1060889152,
+    1060962624,  1061037120,  1061113600,  1061190592,  1061268736,
+    1061346560,  1061425408,  1061503552,  1061581632,  1061658624,
+    1061735552,  1061810688,  1061884992,  1061957312,  1062028480,
+    1062097280,  1062164608,  1062229120,  1062291968,  1062351936,
+    1062409856,  1062464512,  1062517312,  1062566720,  1062613824,
+    1062657792,  1062699712,  1062738176,  1062774528,  1062807936,
+    1062839296,  1062867520,  1062894336,  1062918528,  1062941120,
+    1062961536,  1062981056,  1062998592,  1063015488,  1063031040,
+    1063046720,  1063061568,  1063076864,  1063091904,  1063108224,
+    1063124928,  1063143296,  1063162752,  1063184832,  1063208640,
+    1063235456,  1063264704,  1063297984,  1063334208,  1063374720,
+    1063419136,  1063468736,  1063522560,  1063582080,  1063646592,
+    1063717440,  1063793472,  1063876352,  1063965184,  1064061248,
+    1064163520,  1064273472,  1064390080,  1064514624,  1064645952,
+    1064785408,  1064932096,  1065087040,  1065249216,  1065419776,
+    1065597760,  1065784000,  1065977472,  1066179392,  1066388480,
+    1066605632,  1066829824,  1067062144,  1067301120,  1067547648,
+    1067800640,  1068061056,  1068327232,  1068600384,  1068879104,
+    1069164224,  1069454208,  1069749952,  1070050112,  1070355392,
+    1070664320,  1070977664,  1071294080,  1071614208,  1071936448,
+    1072261504,  1072588160,  1072916928,  1073246016,  1073576576,
+    1073907072,  1074237824,  1074567424,  1074896768,  1075224192,
+    1075550208,  1075873664,  1076195200,  1076513152,  1076828160,
+    1077138944,  1077446272,  1077748608,  1078046592,  1078338944,
+    1078626688,  1078908032,  1079183872,  1079452800,  1079716096,
+    1079971968,  1080221312,  1080463360,  1080698624,  1080925696,
+    1081145856,  1081357952,  1081562752,  1081759104,  1081948160,
+    1082128896,  1082302208,  1082466944,  1082624512,  1082773632,
+    1082915456,  1083049088,  1083175680,  1083294464,  1083406336,
+    1083510528,  1083608320,  1083698816,  1083783168,  1083860736,
+    1083932928,  1083998592,  1084059264,  1084114176,  1084164736,
+    1084210048,  1084251392,  1084288256,  1084322176,  1084352000,
+    1084379392,  1084403584,  1084426112,  1084445952,  1084464768,
+    1084481792,  1084498432,  1084513792,  1084529408,  1084544512,
+    1084560512,  1084576384,  1084593664,  1084611584,  1084631424,
+    1084652288,  1084675328,  1084700032,  1084727424,  1084756224,
+    1084788224,  1084822272,  1084859392,  1084898688,  1084941440,
+    1084986368,  1085034496,  1085084928,  1085138816,  1085194624,
+    1085253760,  1085315072,  1085379328,  1085445248,  1085513984,
+    1085584384,  1085657088,  1085731072,  1085807104,  1085883904,
+    1085962624,  1086041344,  1086121216,  1086201216,  1086281856,
+    1086361472,  1086441472,  1086520320,  1086598656,  1086674944,
+    1086750208,  1086823040,  1086894080,  1086961792,  1087027200,
+    1087088896,  1087147520,  1087201280,  1087251328,  1087296128,
+    1087336448,  1087370624,  1087399552,  1087421952,  1087438208,
+    1087447040,  1087449088,  1087443072,  1087429632,  1087407232,
+    1087376896,  1087336960,  1087288064,  1087228928,  1087160448,
+    1087080832,  1086990976,  1086889728,  1086777600,  1086652800,
+    1086516736,  1086367744,  1086206336,  1086030976,  1085842816,
+    1085640192,  1085423744,  1085191808,  1084945408,  1084682880,
+    1084404864,  1084109568,  1083797632,  1083468032,  1083120640,
+    1082753792,  1082368640,  1081963136,  1081537280,  1081089792,
+    1080621312,  1080129664,  1079615232,  1079076224,  1078513024,
+    1077923840,  1077308672,  1076665728,  1075995392,  1075295872,
+    1074567040,  1073806976,  1073016256,  1072192768,  1071336640,
+    1070446080,  1069521408,  1068560640,  1067564224,  1066530240,
+    1065459072,  1064349056,  1063200640,  1062012032,  1060783168,
+    1059090944,  1057352512,  1055676224,  1053940224,  1052118144,
+    1050185792,  1048141056,  1045972544,  1043675968,  1041242624,
+    1038666112,  1035937024,  1033048256,  1029991104,  1026757824,
+    1023340480,  1019730880,  1015920640,  1011902016,  1007667392,
+    1003209088,   998520832,   993594304,   988422784,   982999488,
+     977318400,   971373504,   965160256,   958673024,   951908352,
+     944861952,   937531008,   929911616,   922001984,   913799424,
+     905303616,   896513792,   887430400,   878052928,   868383296,
+     858422400,   848173888,   837640768,   826827520,   815737344,
+     804375552,   792746688,   780857152,   768713472,   756323776,
+     743694720,   730835776,   717755200,   704463744,   690972096,
+     677290048,   663426624,   649394176,   635204160,   620868608,
+     606399552,   591814592,   577126016,   562346880,   547491904,
+     532576800,   517614752,   502620384,   487609472,   472599072,
+     457604384,   442641248,   427725024,   412872224,   398098784,
+     383421056,   368854880,   354416800,   340122784,   325988512,
+     312028960,   298259552,   284695616,   271351936,   258242416,
+     245380496,   232780080,   220454224,   208415648,   196675232,
+     185244304,   174132512,   163350560,   152906512,   142809296,
+     133064600,   123679840,   114658496,   106006640,    97725312,
+      89819120,    82286296,    75130072,    68345688,    61935320,
+      55890884,    50213948,    44892616,    39928596,    35305412,
+      31026290,    27068822,    23440402,    20110070,    17095342,
+      14349286,    11903060,     9602982,     7256482,     3762862,
+};
+
+#endif /* LC3_CONFIG_10M_48K */
+
+const int32_t *lc3_mdct_win_q30[LC3_NUM_DT][LC3_NUM_SRATE] = {
+
+#if LC3_CONFIG_DT_7M5
+    [LC3_DT_7M5] = {
+#if LC3_CONFIG_7M5_8K
+        [LC3_SRATE_8K ] = mdct_win_7m5_60_q30,
+#endif
+#if LC3_CONFIG_7M5_16K
+        [LC3_SRATE_16K] = mdct_win_7m5_120_q30,
+#endif
+#if LC3_CONFIG_7M5_24K
+        [LC3_SRATE_24K] = mdct_win_7m5_180_q30,
+#endif
+#if LC3_CONFIG_7M5_32K
+        [LC3_SRATE_32K] = mdct_win_7m5_240_q30,
+#endif
+#if LC3_CONFIG_7M5_48K
+        [LC3_SRATE_48K] = mdct_win_7m5_360_q30,
+#endif
+    },
+#endif
+
+#if LC3_CONFIG_DT_10M
+    [LC3_DT_10M] = {
+#if LC3_CONFIG_10M_8K
+        [LC3_SRATE_8K ] = mdct_win_10m_80_q30,
+#endif
+#if LC3_CONFIG_10M_16K
+        [LC3_SRATE_16K] = mdct_win_10m_160_q30,
+#endif
+#if LC3_CONFIG_10M_24K
+        [LC3_SRATE_24K] = mdct_win_10m_240_q30,
+#endif
+#if LC3_CONFIG_10M_32K
+        [LC3_SRATE_32K] = mdct_win_10m_320_q30,
+#endif
+#if LC3_CONFIG_10M_48K
+        [LC3_SRATE_48K] = mdct_win_10m_480_q30,
+#endif
+    },
+#endif
+};
+
+
+/**
+ * SNS Quantization codebooks, Q20
+ */
+
+const int32_t lc3_sns_lfcb_q20[32][8] = {
+
+    {    2372753,      852819,     -555948,    -1422549,
+        -1677220,    -1510985,    -1199379,     -791889 },
+
+    {    3088229,     2528571,     1007110,     -464757,
+        -1288843,    -1631480,    -1569599,    -1171154 },
+
+    {   -2292300,    -2067290,    -1874001,    -2011860,
+        -1881136,    -1423320,     -739712,      -50140 },
+
+    {     727385,     1002030,      603173,     -120170,
+         -677433,     -998613,    -1126226,     -794913 },
+
+    {   -1360550,     -776333,     -362149,     -328504,
+         -422552,     -390092,      -82147,      101758 },
+
+    {     959082,     1827595,     2001801,     1619090,
+         1146565,      678932,       37937,     -311524 },
+
+    {   -2636422,    -3032223,    -2101878,     -787389,
+          462634,     1260294,     1391910,     1279777 },
+
+    {    -966985,      663219,     1140184,      638193,
+          137547,     -310535,     -217069,      141479 },
+
+    {     828713,      658927,      412214,      503325,
+          469568,      219922,        6886,      -90308 },
+
+    {    1518082,     2856321,     2423084,      980472,
+         -288090,     -945897,     -986376,     -664480 },
+
+    {     831893,       15092,     -595418,     -686566,
+         -502749,     -182342,       71320,      309462 },
+
+    {    2856587,     3103235,     1939379,      590647,
+          146714,      377111,      722953,      670869 },
+
+    {    -556616,     -223022,        6046,      445510,
+          496112,      900616,     1248971,     1044581 },
+
+    {    1769246,     2554483,     2443386,     1866295,
+         1514262,     1593785,     1543498,     1025174 },
+
+    {   -3095221,    -1671362,     -115258,      407486,
+          537849,      658624,      862582,      918439 },
+
+    {     106827,      618510,      649119,     1328874,
+         2537146,     2361123,      552114,     -415856 },
+
+    {    2812853,     1391859,      136509,     -354978,
+         -386106,     -201001,     -162301,     -245584 },
+
+    {    5061455,     3271010,     1462907,      262454,
+         -412734,     -674715,     -673784,     -758323 },
+
+    {      92109,     -597255,    -1200683,    -1750792,
+        -1934984,    -1640686,    -1171750,     -559920 },
+
+    {    1458593,     2077716,     1166706,     -230799,
+         -812610,     -622921,      143590,      857990 },
+
+    {     403268,     -168390,     -565567,     -555021,
+          199684,     2685014,     2955898,      688569 },
+
+    {    2026136,     3156530,     3214346,     2622595,
+         2024691,      599947,     -851173,    -1233564 },
+
+    {     183585,     -786980,    -1089931,    -1190947,
+        -1092594,      -15945,     2171060,     3596080 },
+
+    {   -1245887,      384610,     1373192,     1765075,
+         1311778,      988153,      866386,      461324 },
+
+    {    2656276,     2215375,     1324230,      798505,
+          547480,      124445,     -474320,     -734373 },
+
+    {    4193149,     4277160,     2959980,     1809918,
+          678580,     -347234,     -926986,    -1181717 },
+
+    {     532575,     1665542,     1812978,     1055835,
+          395440,      499511,     1140376,     1140392 },
+
+    {    3322485,     3416821,     2539972,     1881629,
+         1595701,     1228897,      513167,      -65305 },
+
+    {    1986158,     1311860,      619133,      637910,
+          920829,     1173488,     1068055,      650593 },
+
+    {     994973,     2235978,     2855748,     2904410,
+         2666392,     2118609,      870366,      -28896 },
+
+    {   -1971604,    -1325726,      326553,     1925922,
+         2365946,     2147683,     2301906,     2125040 },
+
+    {     258344,     1002042,     1594326,     2072483,
+         2034697,     2342266,     2084946,     1334131 },
+
+};
+
+const int32_t lc3_sns_hfcb_q20[32][8] = {
+
+    {     243299,    -1057911,    -2246296,    -2490723,
+        -2338764,    -2281658,    -2401930,    -2655901 },
+
+    {   -1357947,    -1886702,    -1978696,    -1897835,
+        -1849059,    -1923282,    -1892480,    -1821162 },
+
+    {     146052,     -270727,     -682418,    -1120044,
+        -1697946,    -2293892,    -2765699,    -3123684 },
+
+    {    -331888,     -500955,     -577935,     -508337,
+         -249968,     -149972,       71637,       92596 },
+
+    {     922242,      312832,     -959852,    -2313641,
+        -2874589,    -3000386,    -3028724,    -3095214 },
+
+    {    -311115,    -1022367,    -1424569,    -1031506,
+         -684675,    -1038077,    -1693107,    -2524052 },
+
+    {     357545,      281962,       59070,       52336,
+         -100048,     -797092,    -2440646,    -3954762 },
+
+    {   -1480901,    -1557367,    -1243649,     -655362,
+          161378,      604385,      833715,      625543 },
+
+    {    -239956,     -349930,     -848635,    -1715343,
+        -1976423,    -1724873,    -1473415,    -1537909 },
+
+    {   -1123535,    -1486535,    -1624158,    -1523540,
+        -1081952,     -724191,     -449675,     -519003 },
+
+    {    -619696,      -74631,      362513,      315149,
+        -1172992,    -2559460,    -2336801,    -1987148 },
+
+    {    -889648,     -611558,       94416,      886073,
+         1117493,      773412,      269055,     -515861 },
+
+    {    1196102,     1010845,      399991,     -506304,
+        -1904557,    -2938944,    -3390945,    -3627116 },
+
+    {    -394562,       44635,      541640,      263944,
+         -226681,     -560017,     -671913,     -911994 },
+
+    {     697307,     1151240,     1450628,     1408525,
+          862956,      226363,     -424595,    -1122245 },
+
+    {    -866403,     -703785,     -239595,      544191,
+         1433633,     2286137,     2659148,     2308137 },
+
+    {    1478580,      791090,    -1368922,    -1962239,
+        -1300325,    -1328681,    -2135643,    -3037569 },
+
+    {     378942,      -23068,     -607512,     -922147,
+         -892008,     -817257,     -767749,     -931501 },
+
+    {     458720,      320278,       -7747,     -519727,
+         -845835,    -1283791,    -1784234,    -2353968 },
+
+    {     679582,      715443,      265549,       77159,
+          329480,      246132,      151624,      -71525 },
+
+    {    1173565,     1294630,      617790,    -1438567,
+        -2486129,    -2105329,    -1747856,    -2019891 },
+
+    {     148738,     -116035,     -296563,       -6919,
+          299819,       48281,     -631868,    -2375745 },
+
+    {     528532,      867154,     1174208,     1236418,
+         1132330,      731420,     -956877,    -3750597 },
+
+    {    -525416,     -341498,       29444,      274784,
+          378107,      666500,     1005597,     1370962 },
+
+    {    3931856,     1597428,     -479950,     -837509,
+         -405609,     -394161,     -689792,    -1343897 },
+
+    {   -1208578,    -1161832,     -589945,     -231276,
+         -366837,     -790032,    -1036619,    -1350466 },
+
+    {    1078222,     1151027,      805983,      216093,
+         -359458,     -791611,    -1092576,    -1576384 },
+
+    {     135090,      722930,     1178043,     1372948,
+         1420946,     1492243,     1213270,      426057 },
+
+    {    1405438,     1457487,     1095426,      666709,
+         -288079,    -1624489,    -2561039,    -3171498 },
+
+    {    2242308,     4453421,     3038082,      978039,
+         -307046,     -849771,     -827188,     -980789 },
+
+    {     592268,     1669176,     2514189,     3184498,
+         2793662,     1460713,      423451,     -688150 },
+
+    {    -442982,      341993,     1459317,     2339862,
+         2738665,     2794878,     2517668,     1844659 },
+
+};
+
+
+/**
+ * SNS DCT-16 matrix, Q31
+ *
+ *   M[n][k] = 2f cos( Pi k (2n + 1) / 2N )
+ *
+ *   k = [0..N-1], n = [0..N-1], N = 16
+ *   f = sqrt(1/4N) for k=0, sqrt(1/2N) otherwise
+ */
+
+const int32_t lc3_sns_dct16_q31[16][16] = {
+
+    {  536870912,   755594128,   744661347,   726557070,
+       701455651,   669598830,   631293407,   586908283,
+       536870912,   481663180,   421816769,   357908031,
+       290552444,   220398677,   148122351,    74419526 },
+
+    {  536870912,   726557070,   631293407,   481663180,
+       290552444,    74419526,  -148122351,  -357908031,
+      -536870912,  -669598830,  -744661347,  -755594128,
+      -701455651,  -586908283,  -421816769,  -220398677 },
+
+    {  536870912,   669598830,   421816769,    74419526,
+      -290552444,  -586908283,  -744661347,  -726557070,
+      -536870912,  -220398677,   148122351,   481663180,
+       701455651,   755594128,   631293407,   357908031 },
+
+    {  536870912,   586908283,   148122351,  -357908031,
+      -701455651,  -726557070,  -421816769,    74419526,
+       536870912,   755594128,   631293407,   220398677,
+      -290552444,  -669598830,  -744661347,  -481663180 },
+
+    {  536870912,   481663180,  -148122351,  -669598830,
+      -701455651,  -220398677,   421816769,   755594128,
+       536870912,   -74419526,  -631293407,  -726557070,
+      -290552444,   357908031,   744661347,   586908283 },
+
+    {  536870912,   357908031,  -421816769,  -755594128,
+      -290552444,   481663180,   744661347,   220398677,
+      -536870912,  -726557070,  -148122351,   586908283,
+       701455651,    74419526,  -631293407,  -669598830 },
+
+    {  536870912,   220398677,  -631293407,  -586908283,
+       290552444,   755594128,   148122351,  -669598830,
+      -536870912,   357908031,   744661347,    74419526,
+      -701455651,  -481663180,   421816769,   726557070 },
+
+    {  536870912,    74419526,  -744661347,  -220398677,
+       701455651,   357908031,  -631293407,  -481663180,
+       536870912,   586908283,  -421816769,  -669598830,
+       290552444,   726557070,  -148122351,  -755594128 },
+
+    {  536870912,   -74419526,  -744661347,   220398677,
+       701455651,  -357908031,  -631293407,   481663180,
+       536870912,  -586908283,  -421816769,   669598830,
+       290552444,  -726557070,  -148122351,   755594128 },
+
+    {  536870912,  -220398677,  -631293407,   586908283,
+       290552444,  -755594128,   148122351,   669598830,
+      -536870912,  -357908031,   744661347,   -74419526,
+      -701455651,   481663180,   421816769,  -726557070 },
+
+    {  536870912,  -357908031,  -421816769,   755594128,
+      -290552444,  -481663180,   744661347,  -220398677,
+      -536870912,   726557070,  -148122351,  -586908283,
+       701455651,   -74419526,  -631293407,   669598830 },
+
+    {  536870912,  -481663180,  -148122351,   669598830,
+      -701455651,   220398677,   421816769,  -755594128,
+       536870912,    74419526,  -631293407,   726557070,
+      -290552444,  -357908031,   744661347,  -586908283 },
+
+    {  536870912,  -586908283,   148122351,   357908031,
+      -701455651,   726557070,  -421816769,   -74419526,
+       536870912,  -755594128,   631293407,  -220398677,
+      -290552444,   669598830,  -744661347,   481663180 },
+
+    {  536870912,  -669598830,   421816769,   -74419526,
+      -290552444,   586908283,  -744661347,   726557070,
+      -536870912,   220398677,   148122351,  -481663180,
+       701455651,  -755594128,   631293407,  -357908031 },
+
+    {  536870912,  -726557070,   631293407,  -481663180,
+       290552444,   -74419526,  -148122351,   357908031,
+      -536870912,   669598830,  -744661347,   755594128,
+      -701455651,   586908283,  -421816769,   220398677 },
+
+    {  536870912,  -755594128,   744661347,  -726557070,
+       701455651,  -669598830,   631293407,  -586908283,
+       536870912,  -481663180,   421816769,  -357908031,
+       290552444,  -220398677,   148122351,   -74419526 },
+
+};
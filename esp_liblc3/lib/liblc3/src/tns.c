@@ -19,6 +19,8 @@
 #include "tns.h"
 #include "tables.h"
 
+#include "tns_fixed.h"
+
 
 /* ----------------------------------------------------------------------------
  *  Filter Coefficients
@@ -49,6 +51,21 @@ LC3_HOT static inline float dot(const float *a, const float *b, int n)
     return v;
 }
 
+/**
+ * Autocorrelation of a vector
+ * x, n            The vector of size `n`, lower or equal to 76
+ * r               Output the autocorrelation, of lags 0 to 8
+ *
+ * The autocorrelation can be output scaled by any positive factor
+ */
+#ifndef autocorrelate
+LC3_HOT static void autocorrelate(const float *x, int n, float *r)
+{
+    for (int k = 0; k < 9; k++)
+        r[k] = dot(x, x + k, n - k);
+}
+#endif /* autocorrelate */
+
 /**
  * LPC Coefficients
  * dt, bw          Duration and bandwidth of the frame
@@ -90,21 +107,19 @@ LC3_HOT static void compute_lpc_coeffs(
     float r[2][9];
 
     for (int f = 0; f < nfilters; f++) {
-        float c[9][3];
+        float c[3][9];
 
         for (int s = 0; s < 3; s++) {
             xs = xe, xe = x + *(++sub);
-
-            for (int k = 0; k < 9; k++)
-                c[k][s] = dot(xs, xs + k, (xe - xs) - k);
+            autocorrelate(xs, xe - xs, c[s]);
         }
 
-        float e0 = c[0][0], e1 = c[0][1], e2 = c[0][2];
+        float e0 = c[0][0], e1 = c[1][0], e2 = c[2][0];
 
         r[f][0] = 3;
         for (int k = 1; k < 9; k++)
             r[f][k] = e0 == 0 || e1 == 0 || e2 == 0 ? 0 :
-                (c[k][0]/e0 + c[k][1]/e1 + c[k][2]/e2) * lag_window[k];
+                (c[0][k]/e0 + c[1][k]/e1 + c[2][k]/e2) * lag_window[k];
     }
 
     /* --- Levinson-Durbin recursion --- */
@@ -252,6 +267,7 @@ static void unquantize_rc(const int *rc_q, int rc_order, float rc[8])
  * rc_order, rc    Order of coefficients, and coefficients
  * x               Spectral coefficients, filtered as output
  */
+#ifndef forward_filtering
 LC3_HOT static void forward_filtering(
     enum lc3_dt dt, enum lc3_bandwidth bw,
     const int rc_order[2], float (* const rc)[8], float *x)
@@ -286,6 +302,7 @@ LC3_HOT static void forward_filtering(
         }
     }
 }
+#endif /* forward_filtering */
 
 /**
  * Inverse filtering
@@ -293,6 +310,7 @@ LC3_HOT static void forward_filtering(
  * rc_order, rc    Order of coefficients, and unquantized coefficients
  * x               Spectral coefficients, filtered as output
  */
+#ifndef inverse_filtering
 LC3_HOT static void inverse_filtering(
     enum lc3_dt dt, enum lc3_bandwidth bw,
     const int rc_order[2], float (* const rc)[8], float *x)
@@ -327,6 +345,7 @@ LC3_HOT static void inverse_filtering(
             s[k] = 0;
     }
 }
+#endif /* inverse_filtering */
 
 
 /* ----------------------------------------------------------------------------
@@ -372,6 +391,19 @@ void lc3_tns_analyze(enum lc3_dt dt, enum lc3_bandwidth bw,
     forward_filtering(dt, bw, data->rc_order, rc, x);
 }
 
+/**
+ * TNS analysis skipped
+ */
+void lc3_tns_analyze_skip(enum lc3_dt dt, enum lc3_bandwidth bw,
+    int nbytes, struct lc3_tns_data *data)
+{
+    data->nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
+    data->lpc_weighting = resolve_lpc_weighting(dt, nbytes);
+
+    for (int f = 0; f < data->nfilters; f++)
+        data->rc_order[f] = 0;
+}
+
 /**
  * TNS synthesis
  */
@@ -57,6 +57,15 @@ typedef struct lc3_tns_data {
 void lc3_tns_analyze(enum lc3_dt dt, enum lc3_bandwidth bw,
     bool nn_flag, int nbytes, lc3_tns_data_t *data, float *x);
 
+/**
+ * TNS analysis skipped, on reduced encoder complexity
+ * dt, bw          Duration and bandwidth of the frame
+ * nbytes          Size in bytes of the frame
+ * data            Return bitstream data, with filtering disabled
+ */
+void lc3_tns_analyze_skip(enum lc3_dt dt, enum lc3_bandwidth bw,
+    int nbytes, lc3_tns_data_t *data);
+
 /**
  * Return number of bits coding the data
  * data            Bitstream data
@@ -0,0 +1,208 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Fixed point kernels, for targets without floating point unit
+ *
+ * The spectral coefficients are converted as block floating point, and
+ * the reflection coefficients of the lattice filters in Q31 :
+ *
+ * - The autocorrelation of a subdivision is scaled on its largest
+ *   magnitude. Only the ratios of the lags are used.
+ * - A stage of the forward filter can at most double the magnitudes.
+ *   With 8 stages, the input is brought below 2^21.
+ * - The gain of the inverse filter is not bounded. The magnitudes
+ *   are checked on each coefficient, and brought back by lowering the
+ *   exponent, the output being converted coefficient by coefficient.
+ */
+
+#if LC3_FIXED_POINT
+
+
+/**
+ * Multiply by a reflection coefficient
+ * rc, x           Coefficient in Q31, and value lower than 2^30
+ * return          `rc * x`
+ */
+static inline int32_t fixed_mul_rc(int32_t rc, int32_t x)
+{
+    return lc3_mulh(rc, 2 * x);
+}
+
+/**
+ * Reflection coefficients of the filters in Q31
+ * nfilters        Number of filters
+ * rc_order, rc    Order of coefficients, and unquantized coefficients
+ * rc_q31          Output the coefficients, null above the order
+ */
+static void fixed_rc_q31(int nfilters,
+    const int rc_order[2], float (* const rc)[8], int32_t (*rc_q31)[8])
+{
+    for (int f = 0; f < nfilters; f++)
+        for (int k = 0; k < 8; k++)
+            rc_q31[f][k] = k < rc_order[f] ?
+                2 * lc3_fixed_from_float(rc[f][k], 30) : 0;
+}
+
+
+/**
+ * Autocorrelation of a vector
+ */
+#ifndef autocorrelate
+
+LC3_HOT static void fixed_autocorrelate(const float *x, int n, float *r)
+{
+    int32_t xf[76];
+    int e = lc3_fixed_exp(x, n, 27);
+
+    for (int i = 0; i < n; i++)
+        xf[i] = lc3_fixed_from_float(x[i], e);
+
+    /* The products are lower than 2^22,
+     * and the sum of the 76 lower than 2^29 */
+
+    for (int k = 0; k < 9; k++) {
+        int32_t v = 0;
+
+        for (int i = 0; i < n - k; i++)
+            v += lc3_mulh(xf[i], xf[i+k]);
+
+        r[k] = lc3_fixed_to_float(v, 0);
+    }
+}
+
+#define autocorrelate fixed_autocorrelate
+
+#endif /* autocorrelate */
+
+/**
+ * Forward filtering
+ */
+#ifndef forward_filtering
+
+LC3_HOT static void fixed_forward_filtering(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const int rc_order[2], float (* const rc)[8], float *x)
+{
+    int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
+    int nf = LC3_NE(dt, bw) >> (nfilters - 1);
+    int i0, ie = 3*(3 + dt);
+
+    int32_t rc_q31[2][8], s[8] = { 0 };
+
+    if (!rc_order[0] && !rc_order[nfilters-1])
+        return;
+
+    fixed_rc_q31(nfilters, rc_order, rc, rc_q31);
+
+    int e = lc3_fixed_exp(x + ie, nf * nfilters - ie, 21);
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        if (!rc_order[f])
+            continue;
+
+        for (int i = i0; i < ie; i++) {
+            int32_t xi = lc3_fixed_from_float(x[i], e);
+            int32_t s0, s1 = xi;
+
+            for (int k = 0; k < rc_order[f]; k++) {
+                s0 = s[k];
+                s[k] = s1;
+
+                s1  = fixed_mul_rc(rc_q31[f][k], xi) + s0;
+                xi += fixed_mul_rc(rc_q31[f][k], s0);
+            }
+
+            x[i] = lc3_fixed_to_float(xi, e);
+        }
+    }
+}
+
+#define forward_filtering fixed_forward_filtering
+
+#endif /* forward_filtering */
+
+/**
+ * Inverse filtering
+ */
+#ifndef inverse_filtering
+
+LC3_HOT static void fixed_inverse_filtering(
+    enum lc3_dt dt, enum lc3_bandwidth bw,
+    const int rc_order[2], float (* const rc)[8], float *x)
+{
+    int nfilters = 1 + (bw >= LC3_BANDWIDTH_SWB);
+    int nf = LC3_NE(dt, bw) >> (nfilters - 1);
+    int i0, ie = 3*(3 + dt);
+
+    int32_t rc_q31[2][8], s[8] = { 0 };
+
+    if (!rc_order[0] && !rc_order[nfilters-1])
+        return;
+
+    fixed_rc_q31(nfilters, rc_order, rc, rc_q31);
+
+    /* The input is kept lower than 2^22, and the states lower than 2^26.
+     * The output and states of a coefficient are then lower than 2^30 */
+
+    int e = lc3_fixed_exp(x + ie, nf * nfilters - ie, 22);
+
+    for (int f = 0; f < nfilters; f++) {
+
+        i0 = ie;
+        ie = nf * (1 + f);
+
+        if (!rc_order[f])
+            continue;
+
+        for (int i = i0; i < ie; i++) {
+            int32_t xi = lc3_fixed_from_float(x[i], e);
+            uint32_t m = 0;
+
+            xi -= fixed_mul_rc(rc_q31[f][7], s[7]);
+            for (int k = 6; k >= 0; k--) {
+                xi -= fixed_mul_rc(rc_q31[f][k], s[k]);
+                s[k+1] = s[k] + fixed_mul_rc(rc_q31[f][k], xi);
+                m |= s[k+1] ^ (s[k+1] >> 31);
+            }
+            s[0] = xi;
+            m |= xi ^ (xi >> 31);
+
+            x[i] = lc3_fixed_to_float(xi, e);
+
+            if (m >= 1 << 26) {
+                for (int k = 0; k < 8; k++)
+                    s[k] >>= 4;
+                e -= 4;
+            }
+        }
+
+        for (int k = 7; k >= rc_order[f]; k--)
+            s[k] = 0;
+    }
+}
+
+#define inverse_filtering fixed_inverse_filtering
+
+#endif /* inverse_filtering */
+
+#endif /* LC3_FIXED_POINT */
@@ -0,0 +1,309 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Generate `src/tables_fixed.c`, the fixed point MDCT and SNS tables,
+ * from the float ones of `src/tables.c` :
+ *
+ *   cc -Isrc -Iinclude tables/mktables_fixed.c src/tables.c -lm \
+ *      -o mktables_fixed && ./mktables_fixed > src/tables_fixed.c
+ */
+
+#include "tables.h"
+
+#include <stdio.h>
+#include <math.h>
+
+
+static const char license[] =
+"/******************************************************************************\n"
+" *\n"
+" *  Copyright 2024 Kasper Nyhus Kaae\n"
+" *\n"
+" *  Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+" *  you may not use this file except in compliance with the License.\n"
+" *  You may obtain a copy of the License at:\n"
+" *\n"
+" *  http://www.apache.org/licenses/LICENSE-2.0\n"
+" *\n"
+" *  Unless required by applicable law or agreed to in writing, software\n"
+" *  distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+" *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+" *  See the License for the specific language governing permissions and\n"
+" *  limitations under the License.\n"
+" *\n"
+" ******************************************************************************/\n";
+
+
+/**
+ * Conversion of a value to fixed point, with `q` fractional bits
+ */
+static int32_t fixed(float v, int q)
+{
+    double x = round(ldexp(v, q));
+    return x >= INT32_MAX ? INT32_MAX : x <= -INT32_MAX ? -INT32_MAX : x;
+}
+
+static const char *sr_name[] = { "8K", "16K", "24K", "32K", "48K" };
+
+static void print_complex(const struct lc3_complex *t, int n, int q, int m)
+{
+    for (int i = 0; i < n; i++)
+        printf("%s{ %11d, %11d },%s", i % m ? " " : "    ",
+            fixed(t[i].re, q), fixed(t[i].im, q), i % m == m-1 ? "\n" : "");
+
+    if (n % m)
+        printf("\n");
+}
+
+static void print_fft_twiddles(void)
+{
+    printf("\n\n"
+        "/**\n"
+        " * Twiddles FFT 3 points, Q31\n"
+        " */\n");
+
+    for (int i = 0; i < 2; i++) {
+        const struct lc3_fft_bf3_twiddles *t = lc3_fft_twiddles_bf3[i];
+        int n = 3 * t->n3;
+
+        printf("\n#if LC3_CONFIG_FFT_TW3_%d\n", n);
+        printf("\nstatic const struct lc3_complex_q31\n"
+               "    fft_twiddles_%d_q31_t[%d][2] LC3_HOT_TABLE = {\n", n, n);
+        for (int j = 0; j < n; j++) {
+            printf("    { { %11d, %11d }, { %11d, %11d } },\n",
+                fixed(t->t[j][0].re, 31), fixed(t->t[j][0].im, 31),
+                fixed(t->t[j][1].re, 31), fixed(t->t[j][1].im, 31));
+        }
+        printf("};\n");
+        printf("\nstatic const struct lc3_fft_bf3_twiddles_q31"
+               " fft_twiddles_%d_q31 = {\n", n);
+        printf("    .n3 = %d/3, .t = fft_twiddles_%d_q31_t };\n", n, n);
+        printf("\n#endif /* LC3_CONFIG_FFT_TW3_%d */\n", n);
+    }
+
+    printf("\nconst struct lc3_fft_bf3_twiddles_q31"
+           " *lc3_fft_twiddles_bf3_q31[] = {\n"
+           "#if LC3_CONFIG_FFT_TW3_15\n"
+           "    &fft_twiddles_15_q31,\n"
+           "#else\n"
+           "    NULL,\n"
+           "#endif\n"
+           "#if LC3_CONFIG_FFT_TW3_45\n"
+           "    &fft_twiddles_45_q31,\n"
+           "#endif\n"
+           "};\n");
+
+    printf("\n\n"
+        "/**\n"
+        " * Twiddles FFT 2 points, Q31\n"
+        " */\n");
+
+    static const int sizes[] =
+        { 10, 20, 30, 40, 60, 80, 90, 120, 160, 180, 240 };
+
+    for (int i = 0; i < (int)(sizeof(sizes) / sizeof(*sizes)); i++)
+        for (int i2 = 0; i2 < 5; i2++)
+            for (int i3 = 0; i3 < 3; i3++) {
+                const struct lc3_fft_bf2_twiddles *t =
+                    lc3_fft_twiddles_bf2[i2][i3];
+                int n = sizes[i];
+                if (!t || 2 * t->n2 != n)
+                    continue;
+
+                printf("\n#if LC3_CONFIG_FFT_TW2_%d\n", n);
+                printf("\nstatic const struct lc3_complex_q31\n"
+                       "    fft_twiddles_%d_q31_t[%d/2] LC3_HOT_TABLE = {\n",
+                       n, n);
+                print_complex(t->t, t->n2, 31, 2);
+                printf("};\n");
+                printf("\nstatic const struct lc3_fft_bf2_twiddles_q31"
+                       " fft_twiddles_%d_q31 = {\n", n);
+                printf("    .n2 = %d/2, .t = fft_twiddles_%d_q31_t };\n",
+                       n, n);
+                printf("\n#endif /* LC3_CONFIG_FFT_TW2_%d */\n", n);
+            }
+
+    printf("\nconst struct lc3_fft_bf2_twiddles_q31"
+           " *lc3_fft_twiddles_bf2_q31[][3] = {\n");
+    for (int i2 = 0; i2 < 5; i2++)
+        for (int i3 = 0; i3 < 3; i3++) {
+            const struct lc3_fft_bf2_twiddles *t =
+                lc3_fft_twiddles_bf2[i2][i3];
+            if (t)
+                printf("#if LC3_CONFIG_FFT_TW2_%d\n"
+                       "    [%d][%d] = &fft_twiddles_%d_q31,\n"
+                       "#endif\n", 2 * t->n2, i2, i3, 2 * t->n2);
+        }
+    printf("};\n");
+}
+
+static void print_mdct_rot(void)
+{
+    printf("\n\n"
+        "/**\n"
+        " * MDCT Rotation twiddles, Q32 (magnitudes lower than 1/2)\n"
+        " */\n");
+
+    static const int sizes[] = { 120, 160, 240, 320, 360, 480, 640, 720, 960 };
+
+    for (int i = 0; i < (int)(sizeof(sizes) / sizeof(*sizes)); i++) {
+        const struct lc3_mdct_rot_def *r = NULL;
+        int n = sizes[i];
+
+        for (int dt = 0; dt < LC3_NUM_DT; dt++)
+            for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+                if (4 * lc3_mdct_rot[dt][sr]->n4 == n)
+                    r = lc3_mdct_rot[dt][sr];
+
+        printf("\n#if LC3_CONFIG_FFT_%d\n", n/4);
+        printf("\nstatic const struct lc3_complex_q31\n"
+               "    mdct_rot_%d_q32_w[%d/4] LC3_HOT_TABLE = {\n", n, n);
+        print_complex(r->w, r->n4, 32, 2);
+        printf("};\n");
+        printf("\nstatic const struct lc3_mdct_rot_def_q32"
+               " mdct_rot_%d_q32 = {\n", n);
+        printf("    .n4 = %d/4, .w = mdct_rot_%d_q32_w };\n", n, n);
+        printf("\n#endif /* LC3_CONFIG_FFT_%d */\n", n/4);
+    }
+
+    printf("\nconst struct lc3_mdct_rot_def_q32\n"
+           "    *lc3_mdct_rot_q32[LC3_NUM_DT][LC3_NUM_SRATE] = {\n");
+    for (int dt = 0; dt < LC3_NUM_DT; dt++) {
+        const char *dt_name = dt == LC3_DT_7M5 ? "7M5" : "10M";
+
+        printf("\n#if LC3_CONFIG_DT_%s\n", dt_name);
+        printf("    [LC3_DT_%s] = {\n", dt_name);
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+            printf("#if LC3_CONFIG_%s_%s\n"
+                   "        [LC3_SRATE_%-3s] = &mdct_rot_%d_q32,\n"
+                   "#endif\n", dt_name, sr_name[sr], sr_name[sr],
+                   4 * lc3_mdct_rot[dt][sr]->n4);
+        printf("    },\n");
+        printf("#endif\n");
+    }
+    printf("};\n");
+}
+
+static void print_mdct_win(void)
+{
+    static const char *dt_name[] = { "7m5", "10m" };
+    static const char *dt_config[] = { "7M5", "10M" };
+
+    printf("\n\n"
+        "/**\n"
+        " * Low delay MDCT windows, Q30\n"
+        " */\n");
+
+    for (int dt = 0; dt < LC3_NUM_DT; dt++)
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++) {
+            int ns = LC3_NS(dt, sr), nd = LC3_ND(dt, sr);
+            const float *w = lc3_mdct_win[dt][sr];
+
+            printf("\n#if LC3_CONFIG_%s_%s\n", dt_config[dt], sr_name[sr]);
+            printf("\nstatic const int32_t"
+                   " mdct_win_%s_%d_q30[%d+%d] LC3_HOT_TABLE = {\n",
+                dt_name[dt], ns, ns, nd);
+            for (int i = 0; i < ns + nd; i++)
+                printf("%s%11d,%s", i % 5 ? " " : "   ",
+                    fixed(w[i], 30), i % 5 == 4 ? "\n" : "");
+            if ((ns + nd) % 5)
+                printf("\n");
+            printf("};\n");
+            printf("\n#endif /* LC3_CONFIG_%s_%s */\n",
+                dt_config[dt], sr_name[sr]);
+        }
+
+    printf("\nconst int32_t"
+           " *lc3_mdct_win_q30[LC3_NUM_DT][LC3_NUM_SRATE] = {\n");
+    for (int dt = 0; dt < LC3_NUM_DT; dt++) {
+        printf("\n#if LC3_CONFIG_DT_%s\n", dt_config[dt]);
+        printf("    [LC3_DT_%s] = {\n", dt_config[dt]);
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+            printf("#if LC3_CONFIG_%s_%s\n"
+                   "        [LC3_SRATE_%-3s] = mdct_win_%s_%d_q30,\n"
+                   "#endif\n", dt_config[dt], sr_name[sr],
+                   sr_name[sr], dt_name[dt], LC3_NS(dt, sr));
+        printf("    },\n");
+        printf("#endif\n");
+    }
+    printf("};\n");
+}
+
+static void print_matrix(const char *name, const int32_t *t, int n, int m)
+{
+    printf("\nconst int32_t %s[%d][%d] = {\n", name, n, m);
+
+    for (int i = 0; i < n * m; i++)
+        printf("%s%11d%s", i % m == 0 ? "\n    {" : i % 4 ? " " : "\n     ",
+            t[i], i % m == m-1 ? " },\n" : ",");
+
+    printf("\n};\n");
+}
+
+static void print_sns(void)
+{
+    int32_t t[16][16];
+
+    printf("\n\n"
+        "/**\n"
+        " * SNS Quantization codebooks, Q20\n"
+        " */\n");
+
+    for (int i = 0; i < 32; i++)
+        for (int j = 0; j < 8; j++)
+            t[0][8*i + j] = fixed(lc3_sns_lfcb[i][j], 20);
+    print_matrix("lc3_sns_lfcb_q20", t[0], 32, 8);
+
+    for (int i = 0; i < 32; i++)
+        for (int j = 0; j < 8; j++)
+            t[0][8*i + j] = fixed(lc3_sns_hfcb[i][j], 20);
+    print_matrix("lc3_sns_hfcb_q20", t[0], 32, 8);
+
+    printf("\n\n"
+        "/**\n"
+        " * SNS DCT-16 matrix, Q31\n"
+        " *\n"
+        " *   M[n][k] = 2f cos( Pi k (2n + 1) / 2N )\n"
+        " *\n"
+        " *   k = [0..N-1], n = [0..N-1], N = 16\n"
+        " *   f = sqrt(1/4N) for k=0, sqrt(1/2N) otherwise\n"
+        " */\n");
+
+    for (int n = 0; n < 16; n++)
+        for (int k = 0; k < 16; k++)
+            t[n][k] = lrint(ldexp((k == 0 ? 0.25 : sqrt(0.125)) *
+                cos(acos(-1) * k * (2*n + 1) / 32), 31));
+    print_matrix("lc3_sns_dct16_q31", t[0], 16, 16);
+}
+
+int main(void)
+{
+    printf("%s\n", license);
+    printf("/**\n"
+           " * Generated by `tables/mktables_fixed.c` from `tables.c`\n"
+           " */\n\n");
+    printf("#include \"tables.h\"\n");
+
+    print_fft_twiddles();
+    print_mdct_rot();
+    print_mdct_win();
+    print_sns();
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#
+# Copyright 2024 Kasper Nyhus Kaae
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at:
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+
+bench_src += \
+    $(TEST_DIR)/bench/run_bench.c \
+    $(TEST_DIR)/bench/lc3_bench.c
+
+bench_lib += liblc3
+
+bench_include += $(SRC_DIR)
+bench_define += LC3_BENCH=1
+bench_cflags += -ffast-math
+bench_ldlibs += m
+
+$(eval $(call add-bin,bench))
+
+bench: $(bench_bin)
+	@echo "  RUN     $(notdir $<)" >&2
+	$(V)$< $(BENCH_ARGS)
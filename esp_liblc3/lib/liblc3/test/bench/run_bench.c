@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bench.h>
+
+/* -------------------------------------------------------------------------- */
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+        "Usage: %s [-b bitrate] [-c complexity] [-n frames]\n"
+        "  -b  Bitrate in bps, 2 bits per sample by default\n"
+        "  -c  Encoder complexity, 0: High (default)  1: Medium  2: Low\n"
+        "  -n  Frames of each clip of the corpus, 200 by default\n",
+        name);
+}
+
+int main(int argc, char *argv[])
+{
+    struct lc3_bench_config cfg = {
+        .num_frames = 200,
+        .bitrate = 0,
+        .complexity = LC3_COMPLEXITY_HIGH,
+    };
+
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 >= argc || strlen(argv[i]) != 2 || argv[i][0] != '-') {
+            usage(argv[0]);
+            return -1;
+        }
+
+        int v = atoi(argv[i+1]);
+
+        switch (argv[i][1]) {
+        case 'b': cfg.bitrate = v; break;
+        case 'c': cfg.complexity = (enum lc3_complexity)v; break;
+        case 'n': cfg.num_frames = v; break;
+        default:
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (cfg.bitrate < 0 || cfg.num_frames <= 0 ||
+            cfg.complexity > LC3_COMPLEXITY_LOW) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    /* The clock counts nanoseconds */
+
+    return lc3_bench_run(&cfg, "ns", 1000000000, stdout);
+}
@@ -61,6 +61,24 @@ def check_unit(rng, dt, sr):
 
     return ok
 
+def check_bwdet(rng, dt, sr):
+
+    ns = T.NS[dt][sr]
+    ok = True
+
+    for a in [ 1, 1e-2, 1e-4 ]:
+
+        x = (2 * rng.random(ns)) - 1
+        x[ns//2:] *= a * np.linspace(1, 0, ns - ns//2)
+
+        (e, nn) = lc3.energy_compute(dt, sr, x)
+        bw = lc3.bwdet_run(dt, sr, e)
+
+        (e_c, nn_c, bw_c) = lc3.energy_compute_bwdet(dt, sr, x)
+        ok = ok and np.array_equal(e_c, e) and nn_c == nn and bw_c == bw
+
+    return ok
+
 def check_appendix_c(dt):
 
     sr = T.SRATE_16K
@@ -83,6 +101,7 @@ def check():
     for dt in range(T.NUM_DT):
         for sr in range(T.NUM_SRATE):
             ok = ok and check_unit(rng, dt, sr)
+            ok = ok and check_bwdet(rng, dt, sr)
 
     for dt in range(T.NUM_DT):
         ok = ok and check_appendix_c(dt)
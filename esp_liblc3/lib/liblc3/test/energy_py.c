@@ -47,8 +47,32 @@ static PyObject *energy_compute_py(PyObject *m, PyObject *args)
     return Py_BuildValue("Ni", e_obj, nn_flag);
 }
 
+static PyObject *energy_compute_bwdet_py(PyObject *m, PyObject *args)
+{
+    unsigned dt, sr;
+    PyObject *x_obj, *e_obj;
+    float *x, *e;
+
+    if (!PyArg_ParseTuple(args, "IIO", &dt, &sr, &x_obj))
+        return NULL;
+
+    CTYPES_CHECK("dt", (unsigned)dt < LC3_NUM_DT);
+    CTYPES_CHECK("sr", (unsigned)sr < LC3_NUM_SRATE);
+
+    int ns = LC3_NS(dt, sr);
+
+    CTYPES_CHECK("x", to_1d_ptr(x_obj, NPY_FLOAT, ns, &x));
+    e_obj = new_1d_ptr(NPY_FLOAT, LC3_NUM_BANDS, &e);
+
+    enum lc3_bandwidth bw;
+    int nn_flag = lc3_energy_compute_bwdet(dt, sr, x, e, &bw);
+
+    return Py_BuildValue("Nii", e_obj, nn_flag, bw);
+}
+
 static PyMethodDef methods[] = {
     { "energy_compute", energy_compute_py, METH_VARARGS },
+    { "energy_compute_bwdet", energy_compute_bwdet_py, METH_VARARGS },
     { NULL },
 };
 
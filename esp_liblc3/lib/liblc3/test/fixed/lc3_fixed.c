@@ -0,0 +1,238 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+/* -------------------------------------------------------------------------- */
+
+#include "lc3_fixed.h"
+#include <lc3.c>
+
+#undef lc3_delay_samples
+#undef lc3_frame_bytes
+#undef lc3_encoder_size
+#undef lc3_setup_encoder
+#undef lc3_encode
+#undef lc3_decoder_size
+#undef lc3_setup_decoder
+#undef lc3_decode
+
+int lc3_delay_samples(int dt_us, int sr_hz);
+
+int lc3_frame_bytes(int dt_us, int bitrate);
+
+unsigned lc3_encoder_size(int dt_us, int sr_hz);
+
+lc3_encoder_t lc3_setup_encoder(
+    int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
+
+int lc3_encode(lc3_encoder_t encoder, enum lc3_pcm_format fmt,
+    const void *pcm, int stride, int nbytes, void *out);
+
+unsigned lc3_decoder_size(int dt_us, int sr_hz);
+
+lc3_decoder_t lc3_setup_decoder(
+    int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
+
+int lc3_decode(lc3_decoder_t decoder, const void *in, int nbytes,
+    enum lc3_pcm_format fmt, void *pcm, int stride);
+
+/* -------------------------------------------------------------------------- */
+
+#define NUM_FRAMES  40
+
+#define PI  3.14159265358979323846
+
+enum signal {
+    SIGNAL_VOICED,
+    SIGNAL_MUSIC,
+    SIGNAL_NOISE,
+    SIGNAL_TRANSIENTS,
+    SIGNAL_LOW_LEVEL,
+    NUM_SIGNALS
+};
+
+/**
+ * Generate `n` samples of a test signal, sampled at `sr_hz`
+ */
+static void generate(enum signal signal, int sr_hz, int16_t *x, int n)
+{
+    unsigned seed = 1;
+    double phi = 0;
+
+    for (int i = 0; i < n; i++) {
+        double t = (double)i / sr_hz, v = 0;
+        double w = (seed = seed * 1103515245 + 12345) / 4294967296. - 0.5;
+
+        switch (signal) {
+
+        case SIGNAL_VOICED:
+        case SIGNAL_LOW_LEVEL:
+            phi += 2 * PI * 140 / sr_hz * (1 + 0.05 * sin(2 * PI * 5 * t));
+            for (int k = 1; k < 20; k++)
+                v += sin(k * phi) / k;
+            v = (signal == SIGNAL_VOICED ? 6000 : 24) * v + 200 * w;
+            break;
+
+        case SIGNAL_MUSIC:
+            for (int k = 0; k < 4; k++)
+                v += sin(2 * PI * (220 << k) * 1.2599 * t) *
+                     (1 + sin(2 * PI * (k + 1) * 1.3 * t)) * 2500;
+            v += 300 * w;
+            break;
+
+        case SIGNAL_NOISE:
+            v = 16000 * w;
+            break;
+
+        case SIGNAL_TRANSIENTS:
+            t = fmod(t, 0.12);
+            v = 20000 * w * exp(-t * 200) + 100 * w;
+            break;
+
+        default:
+            break;
+        }
+
+        x[i] = v > INT16_MAX ? INT16_MAX : v < INT16_MIN ? INT16_MIN : v;
+    }
+}
+
+/**
+ * Signal to noise ratio (dB) of `x`, delayed by `d` samples,
+ * against the reference `ref`
+ */
+static double snr(const int16_t *ref, const int16_t *x, int d, int n)
+{
+    double s = 0, e = 0;
+
+    for (int i = d; i < n; i++) {
+        double v = ref[i-d], dv = (double)x[i] - v;
+        s += v * v, e += dv * dv;
+    }
+
+    return e > 0 ? 10 * log10(s / e) : HUGE_VAL;
+}
+
+/**
+ * Encode and decode a signal, with the floating and fixed point builds
+ * in all combinations. The fixed point encoder shall produce streams
+ * decoded without error, of same quality as the floating point encoder,
+ * and the fixed point decoder shall output the floating point one.
+ */
+static int check_signal(int dt_us, int sr_hz, int nbytes, enum signal signal)
+{
+    int ns = lc3_frame_samples(dt_us, sr_hz);
+    int n = NUM_FRAMES * ns;
+    int ret = 0;
+
+    void *enc_mem = malloc(lc3_encoder_size(dt_us, sr_hz));
+    void *enc_fixed_mem = malloc(lc3_encoder_size_fixed(dt_us, sr_hz));
+    void *dec_mem[2], *dec_fixed_mem[2];
+
+    lc3_encoder_t enc = lc3_setup_encoder(dt_us, sr_hz, 0, enc_mem);
+    lc3_encoder_t enc_fixed =
+        lc3_setup_encoder_fixed(dt_us, sr_hz, 0, enc_fixed_mem);
+    lc3_decoder_t dec[2], dec_fixed[2];
+
+    for (int i = 0; i < 2; i++) {
+        dec_mem[i] = malloc(lc3_decoder_size(dt_us, sr_hz));
+        dec_fixed_mem[i] = malloc(lc3_decoder_size_fixed(dt_us, sr_hz));
+
+        dec[i] = lc3_setup_decoder(dt_us, sr_hz, 0, dec_mem[i]);
+        dec_fixed[i] = lc3_setup_decoder_fixed(
+            dt_us, sr_hz, 0, dec_fixed_mem[i]);
+    }
+
+    /* --- Encode and decode the 4 combinations ---
+     * Output `y[0]` and `y[1]` decodes the floating and fixed point
+     * encoded streams, `y_fixed[]` the same with the fixed point decoder */
+
+    int16_t *x = malloc(n * sizeof(*x));
+    int16_t *y[2], *y_fixed[2];
+
+    for (int i = 0; i < 2; i++) {
+        y[i] = malloc(n * sizeof(*y[i]));
+        y_fixed[i] = malloc(n * sizeof(*y_fixed[i]));
+    }
+
+    generate(signal, sr_hz, x, n);
+
+    for (int i = 0; i < n; i += ns) {
+        uint8_t frame[2][LC3_MAX_FRAME_BYTES];
+
+        lc3_encode(enc, LC3_PCM_FORMAT_S16, x + i, 1, nbytes, frame[0]);
+        lc3_encode_fixed(
+            enc_fixed, LC3_PCM_FORMAT_S16, x + i, 1, nbytes, frame[1]);
+
+        for (int j = 0; j < 2; j++) {
+            ret |= lc3_decode(dec[j],
+                frame[j], nbytes, LC3_PCM_FORMAT_S16, y[j] + i, 1);
+            ret |= lc3_decode_fixed(dec_fixed[j],
+                frame[j], nbytes, LC3_PCM_FORMAT_S16, y_fixed[j] + i, 1);
+        }
+    }
+
+    /* --- Compare the qualities ---
+     * The tolerance on the encoded stream covers different decisions,
+     * taken on rounding errors at decision thresholds. */
+
+    int d = lc3_delay_samples(dt_us, sr_hz);
+    double snr_ref = snr(x, y[0], d, n);
+
+    if (snr(x, y[1], d, n) < snr_ref - 0.5 ||
+        snr(x, y_fixed[1], d, n) < snr_ref - 0.5 ||
+        snr(y[0], y_fixed[0], 0, n) < 60 ||
+        snr(y[1], y_fixed[1], 0, n) < 60)
+        ret = -1;
+
+    free(x);
+
+    for (int i = 0; i < 2; i++) {
+        free(y[i]), free(y_fixed[i]);
+        free(dec_mem[i]), free(dec_fixed_mem[i]);
+    }
+
+    free(enc_mem);
+    free(enc_fixed_mem);
+
+    return ret;
+}
+
+int check_lc3(void)
+{
+    static const int srates_hz[] = { 8000, 16000, 24000, 32000, 48000 };
+    static const int bitrates[] = { 24000, 64000, 124000 };
+
+    for (int dt_us = 7500; dt_us <= 10000; dt_us += 2500)
+        for (int isr = 0; isr < 5; isr++)
+            for (int ib = 0; ib < 3; ib++)
+                for (int signal = 0; signal < NUM_SIGNALS; signal++) {
+                    int nbytes = LC3_CLIP(
+                        lc3_frame_bytes(dt_us, bitrates[ib]), 20, 400);
+
+                    if (check_signal(dt_us, srates_hz[isr],
+                            nbytes, signal) < 0)
+                        return -1;
+                }
+
+    return 0;
+}
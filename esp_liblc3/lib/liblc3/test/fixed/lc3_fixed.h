@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/**
+ * Fixed point build of the codec, linked along with the floating point one
+ *
+ * The sources are compiled with `LC3_FIXED_POINT` set, and the symbols
+ * shared by the 2 builds renamed with a `_fixed` suffix.
+ */
+
+#ifndef __LC3_TEST_FIXED_H
+#define __LC3_TEST_FIXED_H
+
+#define LC3_FIXED_POINT 1
+
+#define lc3_frame_samples lc3_frame_samples_fixed
+#define lc3_frame_bytes lc3_frame_bytes_fixed
+#define lc3_resolve_bitrate lc3_resolve_bitrate_fixed
+#define lc3_delay_samples lc3_delay_samples_fixed
+#define lc3_encoder_size lc3_encoder_size_fixed
+#define lc3_setup_encoder lc3_setup_encoder_fixed
+#define lc3_encoder_set_complexity lc3_encoder_set_complexity_fixed
+#define lc3_encode lc3_encode_fixed
+#define lc3_decoder_size lc3_decoder_size_fixed
+#define lc3_setup_decoder lc3_setup_decoder_fixed
+#define lc3_decode lc3_decode_fixed
+
+#define lc3_mdct_forward lc3_mdct_forward_fixed
+#define lc3_mdct_inverse lc3_mdct_inverse_fixed
+#define lc3_mdct_get_plan lc3_mdct_get_plan_fixed
+#define lc3_mdct_forward_plan lc3_mdct_forward_plan_fixed
+#define lc3_mdct_inverse_plan lc3_mdct_inverse_plan_fixed
+#define lc3_mdct_plan lc3_mdct_plan_fixed
+
+#define lc3_ltpf_analyse lc3_ltpf_analyse_fixed
+#define lc3_ltpf_analyse_skip lc3_ltpf_analyse_skip_fixed
+#define lc3_ltpf_disable lc3_ltpf_disable_fixed
+#define lc3_ltpf_get_data lc3_ltpf_get_data_fixed
+#define lc3_ltpf_get_nbits lc3_ltpf_get_nbits_fixed
+#define lc3_ltpf_put_data lc3_ltpf_put_data_fixed
+#define lc3_ltpf_synthesize lc3_ltpf_synthesize_fixed
+
+#define lc3_sns_analyze lc3_sns_analyze_fixed
+#define lc3_sns_get_data lc3_sns_get_data_fixed
+#define lc3_sns_get_nbits lc3_sns_get_nbits_fixed
+#define lc3_sns_put_data lc3_sns_put_data_fixed
+#define lc3_sns_synthesize lc3_sns_synthesize_fixed
+
+#define lc3_spec_analyze lc3_spec_analyze_fixed
+#define lc3_spec_decode lc3_spec_decode_fixed
+#define lc3_spec_encode lc3_spec_encode_fixed
+#define lc3_spec_get_side lc3_spec_get_side_fixed
+#define lc3_spec_put_side lc3_spec_put_side_fixed
+
+#define lc3_tns_analyze lc3_tns_analyze_fixed
+#define lc3_tns_analyze_skip lc3_tns_analyze_skip_fixed
+#define lc3_tns_get_data lc3_tns_get_data_fixed
+#define lc3_tns_get_nbits lc3_tns_get_nbits_fixed
+#define lc3_tns_put_data lc3_tns_put_data_fixed
+#define lc3_tns_synthesize lc3_tns_synthesize_fixed
+
+#endif /* __LC3_TEST_FIXED_H */
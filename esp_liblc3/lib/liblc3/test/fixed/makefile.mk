@@ -0,0 +1,37 @@
+#
+# Copyright 2024 Kasper Nyhus Kaae
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at:
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+test_fixed_src += \
+    $(TEST_DIR)/fixed/test_fixed.c \
+    $(TEST_DIR)/fixed/mdct_fixed.c \
+    $(TEST_DIR)/fixed/lc3_fixed.c \
+    $(TEST_DIR)/fixed/ltpf_fixed.c \
+    $(TEST_DIR)/fixed/sns_fixed.c \
+    $(TEST_DIR)/fixed/spec_fixed.c \
+    $(TEST_DIR)/fixed/tns_fixed.c
+
+test_fixed_lib += liblc3
+
+test_fixed_include += $(SRC_DIR)
+test_fixed_ldlibs += m
+
+$(eval $(call add-bin,test_fixed))
+
+test_fixed: $(test_fixed_bin)
+	@echo "  RUN     $(notdir $<)"
+	$(V)$<
+
+test: test_fixed
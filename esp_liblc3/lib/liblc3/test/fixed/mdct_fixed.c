@@ -0,0 +1,208 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -------------------------------------------------------------------------- */
+
+#include "lc3_fixed.h"
+#include <mdct_fixed.c>
+
+#undef lc3_mdct_forward
+#undef lc3_mdct_inverse
+#undef lc3_mdct_get_plan
+#undef lc3_mdct_forward_plan
+#undef lc3_mdct_inverse_plan
+#undef lc3_mdct_plan
+
+void lc3_mdct_forward(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_dst, const float *x, float *d, float *y);
+
+void lc3_mdct_inverse(enum lc3_dt dt, enum lc3_srate sr,
+    enum lc3_srate sr_src, const float *x, float *d, float *y);
+
+/* -------------------------------------------------------------------------- */
+
+#define NUM_FRAMES  4
+
+static float random_float(void)
+{
+    return 2 * (double)rand() / RAND_MAX - 1;
+}
+
+/**
+ * Signal to noise ratio (dB) of `x` against the reference `ref`
+ */
+static double snr(const float *ref, const float *x, int n)
+{
+    double s = 0, e = 0;
+
+    for (int i = 0; i < n; i++) {
+        double v = ref[i], dv = (double)x[i] - v;
+        s += v * v, e += dv * dv;
+    }
+
+    return e > 0 ? 10 * log10(s / e) : HUGE_VAL;
+}
+
+/**
+ * Largest absolute difference of `x` against the reference `ref`
+ */
+static double max_error(const float *ref, const float *x, int n)
+{
+    double m = 0;
+
+    for (int i = 0; i < n; i++)
+        m = fmax(m, fabs((double)x[i] - (double)ref[i]));
+
+    return m;
+}
+
+static int check_conversions(void)
+{
+    for (int i = 0; i < 10000; i++) {
+        float x = ldexpf(random_float(), rand() % 40 - 20);
+        int e = rand() % 20;
+
+        double v = ldexp(x, e);
+        int32_t ref = v >= LC3_FIXED_MAX ? LC3_FIXED_MAX :
+                      v <= -LC3_FIXED_MAX ? -LC3_FIXED_MAX : (int32_t)v;
+        if (lc3_fixed_from_float(x, e) != ref)
+            return -1;
+
+        int32_t q = (int32_t)(random_float() * LC3_FIXED_MAX) >> (rand() % 30);
+        float y = lc3_fixed_to_float(q, e);
+        if (fabs((double)y - ldexp(q, -e)) > ldexp(fabs((double)q), -e-24))
+            return -1;
+
+        float z = ldexpf(random_float(), rand() % 40 - 20);
+        if (lc3_float_mul(x, z) != x * z)
+            return -1;
+
+        uint32_t u = (uint32_t)rand() >> (rand() % 31);
+        if (u > 0 && fabs(ldexp(lc3_fixed_log2(u), -24) - log2(u)) > 2e-5)
+            return -1;
+
+        int32_t l = (int32_t)(random_float() * (1 << 30)), el;
+        int32_t m = lc3_fixed_exp2(l, &el);
+        if (fabs(ldexp(m, -el) / exp2(ldexp(l, -24)) - 1) > 4e-6)
+            return -1;
+    }
+
+    if (lc3_fixed_from_float(0.f, 10) != 0 ||
+        lc3_fixed_from_float(-INFINITY, 0) != -LC3_FIXED_MAX ||
+        lc3_fixed_to_float(0, 10) != 0.f ||
+        lc3_float_mul(0.f, 10.f) != 0.f ||
+        lc3_fixed_log2(1) != 0)
+        return -1;
+
+    return 0;
+}
+
+/**
+ * Fill a frame with a few tones and noise, of peak amplitude `a`
+ */
+static void random_pcm(float *x, int n, int t, float a)
+{
+    for (int i = 0; i < n; i++, t++)
+        x[i] = a * (0.4f * sinf(0.0123f * t) + 0.3f * sinf(0.731f * t) +
+                    0.1f * sinf(2.467f * t) + 0.2f * random_float());
+}
+
+static int check_forward(void)
+{
+    static const float amplitudes[] = { 32767.f, 32.f, 0.5f };
+
+    for (int dt = 0; dt < LC3_NUM_DT; dt++)
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+            for (int ia = 0; ia < 3; ia++) {
+                int ns = LC3_NS(dt, sr);
+                enum lc3_srate sr_dst = sr > 0 && ia == 1 ? sr - 1 : sr;
+
+                float x[LC3_MAX_NS];
+                float y[LC3_MAX_NS], y_fixed[LC3_MAX_NS];
+                float d[LC3_MAX_NS] = { 0 }, d_fixed[LC3_MAX_NS] = { 0 };
+
+                for (int i = 0; i < NUM_FRAMES; i++) {
+                    random_pcm(x, ns, i * ns, amplitudes[ia]);
+
+                    lc3_mdct_forward(dt, sr, sr_dst, x, d, y);
+                    lc3_mdct_forward_fixed(dt, sr, sr_dst, x, d_fixed, y_fixed);
+
+                    if (snr(y, y_fixed, LC3_NS(dt, sr_dst)) < 100)
+                        return -1;
+                }
+            }
+
+    return 0;
+}
+
+static int check_inverse(void)
+{
+    static const float amplitudes[] = { 1e5f, 100.f, 1.f };
+
+    for (int dt = 0; dt < LC3_NUM_DT; dt++)
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+            for (int ia = 0; ia < 3; ia++) {
+                int ns = LC3_NS(dt, sr);
+                enum lc3_srate sr_src = sr > 0 && ia == 1 ? sr - 1 : sr;
+                int ns_src = LC3_NS(dt, sr_src);
+
+                float x[LC3_MAX_NS];
+                float y[LC3_MAX_NS], y_fixed[LC3_MAX_NS];
+                float d[LC3_MAX_NS] = { 0 }, d_fixed[LC3_MAX_NS] = { 0 };
+
+                for (int i = 0; i < NUM_FRAMES; i++) {
+
+                    /* Spectrum decaying with frequency */
+
+                    for (int k = 0; k < ns; k++)
+                        x[k] = k < ns_src ? amplitudes[ia] *
+                            random_float() / (1 + 0.05f * k) : 0;
+
+                    lc3_mdct_inverse(dt, sr, sr_src, x, d, y);
+                    lc3_mdct_inverse_fixed(dt, sr, sr_src, x, d_fixed, y_fixed);
+
+                    /* The output precision is absolute, as the PCM one */
+
+                    if (snr(y, y_fixed, ns) < 100 &&
+                        max_error(y, y_fixed, ns) > 1./64)
+                        return -1;
+                }
+            }
+
+    return 0;
+}
+
+int check_mdct(void)
+{
+    int ret;
+
+    if ((ret = check_conversions()) < 0)
+        return ret;
+
+    if ((ret = check_forward()) < 0)
+        return ret;
+
+    if ((ret = check_inverse()) < 0)
+        return ret;
+
+    return 0;
+}
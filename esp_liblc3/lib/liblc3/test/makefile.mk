@@ -26,5 +26,10 @@ test-clean:
 
 -include $(TEST_DIR)/arm/makefile.mk
 -include $(TEST_DIR)/neon/makefile.mk
+-include $(TEST_DIR)/xtensa/makefile.mk
+-include $(TEST_DIR)/fixed/makefile.mk
+-include $(TEST_DIR)/sns/makefile.mk
+-include $(TEST_DIR)/mdct/makefile.mk
+-include $(TEST_DIR)/bench/makefile.mk
 
 clean-all: test-clean
@@ -0,0 +1,161 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* -------------------------------------------------------------------------- */
+
+#include <mdct.c>
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ * Reference FFT, with radix 2 stages only, as used before radix 2^2
+ */
+
+static struct lc3_complex *fft_ref(const struct lc3_complex *x, int n,
+    struct lc3_complex *y0, struct lc3_complex *y1)
+{
+    struct lc3_complex *y[2] = { y1, y0 };
+    int i2, i3, is = 0;
+
+    fft_5(x, y[is], n /= 5);
+
+    for (i3 = 0; n & (n-1); i3++, is ^= 1)
+        fft_bf3(lc3_fft_twiddles_bf3[i3], y[is], y[is ^ 1], n /= 3);
+
+    for (i2 = 0; n > 1; i2++, is ^= 1)
+        fft_bf2(lc3_fft_twiddles_bf2[i2][i3], y[is], y[is ^ 1], n >>= 1);
+
+    return y[is];
+}
+
+/* -------------------------------------------------------------------------- */
+
+static const int fft_sizes[] = { 30, 40, 60, 80, 90, 120, 160, 180, 240 };
+
+#define NUM_FFT_SIZES  (int)(sizeof(fft_sizes) / sizeof(*fft_sizes))
+
+static void random_complex(struct lc3_complex *x, int n)
+{
+    for (int i = 0; i < n; i++) {
+        x[i].re = 2 * (float)rand() / RAND_MAX - 1;
+        x[i].im = 2 * (float)rand() / RAND_MAX - 1;
+    }
+}
+
+int check_fft_radix(void)
+{
+    struct lc3_complex x[240], y[2][240], y_ref[2][240];
+
+    for (int k = 0; k < NUM_FFT_SIZES; k++) {
+        int n = fft_sizes[k];
+
+        for (int run = 0; run < 100; run++) {
+            random_complex(x, n);
+
+            struct lc3_complex *z_ref = fft_ref(x, n, y_ref[0], y_ref[1]);
+            struct lc3_complex *z = fft(x, n, y[0], y[1]);
+
+            if (memcmp(z, z_ref, n * sizeof(*z)) != 0)
+                return -1;
+        }
+    }
+
+    /* --- Specialized kernels of the plans --- */
+
+    for (int dt = 0; dt < LC3_NUM_DT; dt++)
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++) {
+            const struct lc3_mdct_plan *plan = lc3_mdct_get_plan(dt, sr);
+            int n = LC3_NS(dt, sr) / 2;
+
+            float xf[2*240], d[LC3_MAX_NS], d_ref[LC3_MAX_NS];
+            float yf[2*240], yf_ref[2*240];
+
+            random_complex((struct lc3_complex *)xf, n);
+            memset(d, 0, sizeof(d));
+            memset(d_ref, 0, sizeof(d_ref));
+
+            lc3_mdct_forward_plan(plan, sr, xf, d, yf);
+            mdct_forward(dt, sr, lc3_mdct_win[dt][sr], lc3_mdct_rot[dt][sr],
+                fft_ref, sr, xf, d_ref, yf_ref);
+            if (memcmp(yf, yf_ref, 2*n * sizeof(*yf)) != 0 ||
+                memcmp(d, d_ref, LC3_ND(dt, sr) * sizeof(*d)) != 0)
+                return -1;
+
+            lc3_mdct_inverse_plan(plan, sr, xf, d, yf);
+            mdct_inverse(dt, sr, lc3_mdct_win[dt][sr], lc3_mdct_rot[dt][sr],
+                fft_ref, sr, xf, d_ref, yf_ref);
+            if (memcmp(yf, yf_ref, 2*n * sizeof(*yf)) != 0 ||
+                memcmp(d, d_ref, LC3_ND(dt, sr) * sizeof(*d)) != 0)
+                return -1;
+        }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static uint64_t clock_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+int bench_fft_radix(void)
+{
+    enum { NUM_TRANSFORMS = 1000, NUM_RUNS = 20 };
+
+    struct lc3_complex x[240], y[2][240];
+    volatile float sink = 0;
+
+    random_complex(x, 240);
+
+    for (int k = 0; k < NUM_FFT_SIZES; k++) {
+        int n = fft_sizes[k];
+        uint64_t t_ref = UINT64_MAX, t_radix4 = UINT64_MAX;
+
+        for (int run = 0; run < NUM_RUNS; run++) {
+            uint64_t t0 = clock_ns();
+
+            for (int i = 0; i < NUM_TRANSFORMS; i++)
+                sink += fft_ref(x, n, y[0], y[1])->re;
+
+            uint64_t t1 = clock_ns();
+
+            for (int i = 0; i < NUM_TRANSFORMS; i++)
+                sink += fft(x, n, y[0], y[1])->re;
+
+            uint64_t t2 = clock_ns();
+
+            t_ref = LC3_MIN(t_ref, t1 - t0);
+            t_radix4 = LC3_MIN(t_radix4, t2 - t1);
+        }
+
+        printf("FFT %3d points (ns = %3d): "
+            "radix 2 %5u ns, radix 2^2 %5u ns\n",
+            n, 2*n, (unsigned)(t_ref / NUM_TRANSFORMS),
+            (unsigned)(t_radix4 / NUM_TRANSFORMS));
+    }
+
+    return 0;
+}
@@ -0,0 +1,322 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* -------------------------------------------------------------------------- */
+
+#include <sns.c>
+
+void lc3_put_bits_generic(lc3_bits_t *a, unsigned b, int c)
+{ (void)a, (void)b, (void)c; }
+
+unsigned lc3_get_bits_generic(struct lc3_bits *a, int b)
+{ return (void)a, (void)b, 0; }
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ * Reference exhaustive searches, as used before the fast search
+ */
+
+static void resolve_codebooks_ref(
+    const float *scf, int *lfcb_idx, int *hfcb_idx)
+{
+    float dlfcb_max = 0, dhfcb_max = 0;
+    *lfcb_idx = *hfcb_idx = 0;
+
+    for (int icb = 0; icb < 32; icb++) {
+        const float *lfcb = lc3_sns_lfcb[icb];
+        const float *hfcb = lc3_sns_hfcb[icb];
+        float dlfcb = 0, dhfcb = 0;
+
+        for (int i = 0; i < 8; i++) {
+            dlfcb += (scf[  i] - lfcb[i]) * (scf[  i] - lfcb[i]);
+            dhfcb += (scf[8+i] - hfcb[i]) * (scf[8+i] - hfcb[i]);
+        }
+
+        if (icb == 0 || dlfcb < dlfcb_max)
+            *lfcb_idx = icb, dlfcb_max = dlfcb;
+
+        if (icb == 0 || dhfcb < dhfcb_max)
+            *hfcb_idx = icb, dhfcb_max = dhfcb;
+    }
+}
+
+static void add_pulse_ref(const float *x, int *y, int n,
+    int start, int end, float *corr, float *energy)
+{
+    for (int k = start; k < end; k++) {
+        float best_c2 = (*corr + x[0]) * (*corr + x[0]);
+        float best_e = *energy + 2*y[0] + 1;
+        int nbest = 0;
+
+        for (int i = 1; i < n; i++) {
+            float c2 = (*corr + x[i]) * (*corr + x[i]);
+            float e  = *energy + 2*y[i] + 1;
+
+            if (c2 * best_e > e * best_c2)
+                best_c2 = c2, best_e = e, nbest = i;
+        }
+
+        *corr += x[nbest];
+        *energy += 2*y[nbest] + 1;
+        y[nbest]++;
+    }
+}
+
+static void quantize_ref(const float *scf, int lfcb_idx, int hfcb_idx,
+    int nshapes, int (*c)[16], float (*cn)[16], int *shape_idx, int *gain_idx)
+{
+    const float *lfcb = lc3_sns_lfcb[lfcb_idx];
+    const float *hfcb = lc3_sns_hfcb[hfcb_idx];
+    float r[16], x[16];
+
+    for (int i = 0; i < 8; i++) {
+        r[  i] = scf[  i] - lfcb[i];
+        r[8+i] = scf[8+i] - hfcb[i];
+    }
+
+    dct16_forward(r, x);
+
+    float xm[16];
+    float xm_sum = 0;
+
+    for (int i = 0; i < 16; i++) {
+        xm[i] = fabsf(x[i]);
+        xm_sum += xm[i];
+    }
+
+    float proj_factor = (6 - 1) / fmaxf(xm_sum, 1e-31f);
+    float corr = 0, energy = 0;
+    int npulses = 0;
+
+    for (int i = 0; i < 16; i++) {
+        c[3][i] = floorf(xm[i] * proj_factor);
+        npulses += c[3][i];
+        corr    += c[3][i] * xm[i];
+        energy  += c[3][i] * c[3][i];
+    }
+
+    add_pulse_ref(xm, c[3], 16, npulses, 6, &corr, &energy);
+    npulses = 6;
+
+    memcpy(c[2], c[3], sizeof(c[2]));
+
+    add_pulse_ref(xm, c[2], 16, npulses, 8, &corr, &energy);
+    npulses = 8;
+
+    memcpy(c[1], c[2], sizeof(c[1]));
+
+    for (int i = 10; i < 16; i++) {
+        c[1][i] = 0;
+        npulses -= c[2][i];
+        corr    -= c[2][i] * xm[i];
+        energy  -= c[2][i] * c[2][i];
+    }
+
+    add_pulse_ref(xm, c[1], 10, npulses, 10, &corr, &energy);
+    npulses = 10;
+
+    memcpy(c[0], c[1], sizeof(c[0]));
+
+    add_pulse_ref(xm + 10, c[0] + 10, 6, 0, 1, &corr, &energy);
+
+    for (int j = 0; j < 16; j++)
+        for (int i = 0; i < nshapes; i++)
+            c[i][j] = x[j] < 0 ? -c[i][j] : c[i][j];
+
+    for (int i = 0; i < nshapes; i++)
+        normalize(c[i], cn[i]);
+
+    float mse_min = INFINITY;
+    *shape_idx = *gain_idx = 0;
+
+    for (int ic = 0; ic < nshapes; ic++) {
+        const struct lc3_sns_vq_gains *cgains = lc3_sns_vq_gains + ic;
+        float cmse_min = INFINITY;
+        int cgain_idx = 0;
+
+        for (int ig = 0; ig < cgains->count; ig++) {
+            float g = cgains->v[ig];
+
+            float mse = 0;
+            for (int i = 0; i < 16; i++)
+                mse += (x[i] - g * cn[ic][i]) * (x[i] - g * cn[ic][i]);
+
+            if (mse < cmse_min) {
+                cgain_idx = ig,
+                cmse_min = mse;
+            }
+        }
+
+        if (cmse_min < mse_min) {
+            *shape_idx = ic, *gain_idx = cgain_idx;
+            mse_min = cmse_min;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+static float frand(float scale)
+{
+    return scale * (2.f * rand() / RAND_MAX - 1);
+}
+
+static int check_scf(const float *scf, int nshapes)
+{
+    struct { int lfcb, hfcb, shape, gain; int c[4][16]; float cn[4][16]; }
+        ref, fast;
+
+    float scf_ref[16], scf_fast[16];
+
+    resolve_codebooks_ref(scf, &ref.lfcb, &ref.hfcb);
+    resolve_codebooks(scf, &fast.lfcb, &fast.hfcb);
+    if (ref.lfcb != fast.lfcb || ref.hfcb != fast.hfcb)
+        return -1;
+
+    quantize_ref(scf, ref.lfcb, ref.hfcb,
+        nshapes, ref.c, ref.cn, &ref.shape, &ref.gain);
+    quantize(scf, fast.lfcb, fast.hfcb,
+        nshapes, fast.c, fast.cn, &fast.shape, &fast.gain);
+    if (ref.shape != fast.shape || ref.gain != fast.gain ||
+        memcmp(ref.c[ref.shape], fast.c[fast.shape], sizeof(*ref.c)) != 0)
+        return -1;
+
+    unquantize(ref.lfcb, ref.hfcb,
+        ref.cn[ref.shape], ref.shape, ref.gain, scf_ref);
+    unquantize(fast.lfcb, fast.hfcb,
+        fast.cn[fast.shape], fast.shape, fast.gain, scf_fast);
+    if (memcmp(scf_ref, scf_fast, sizeof(scf_ref)) != 0)
+        return -1;
+
+    return 0;
+}
+
+int check_sns_search(void)
+{
+    float scf[16], eb[LC3_NUM_BANDS];
+
+    for (int nshapes = 2; nshapes <= 4; nshapes += 2) {
+
+        /* --- Random scale factors, at various levels --- */
+
+        static const float scales[] = { 0, 1e-3f, 0.1f, 1, 3, 10, 40 };
+
+        for (int is = 0; is < (int)(sizeof(scales)/sizeof(*scales)); is++)
+            for (int n = 0; n < 20000; n++) {
+                for (int i = 0; i < 16; i++)
+                    scf[i] = frand(scales[is]);
+
+                if (check_scf(scf, nshapes) < 0)
+                    return -1;
+            }
+
+        /* --- Near codebook vectors, where the searches are close --- */
+
+        for (int icb = 0; icb < 32; icb++)
+            for (int n = 0; n < 200; n++) {
+                for (int i = 0; i < 8; i++) {
+                    scf[  i] = lc3_sns_lfcb[icb][i] + frand(n * 1e-3f);
+                    scf[8+i] = lc3_sns_hfcb[(icb + n) & 31][i];
+                }
+
+                if (check_scf(scf, nshapes) < 0)
+                    return -1;
+            }
+
+        /* --- Scale factors of band energies --- */
+
+        for (int dt = 0; dt < LC3_NUM_DT; dt++)
+            for (int sr = 0; sr < LC3_NUM_SRATE; sr++)
+                for (int n = 0; n < 2000; n++) {
+                    float level = powf(10, frand(5));
+                    for (int i = 0; i < LC3_NUM_BANDS; i++)
+                        eb[i] = level * (1 + frand(1)) / (1 + i * (n & 7));
+
+                    compute_scale_factors(dt, sr, eb, n & 8, scf);
+
+                    if (check_scf(scf, nshapes) < 0)
+                        return -1;
+                }
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static uint64_t clock_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+int bench_sns_search(void)
+{
+    enum { NUM_FRAMES = 1000, NUM_RUNS = 20 };
+
+    static float scf[NUM_FRAMES][16];
+    float eb[LC3_NUM_BANDS];
+
+    for (int n = 0; n < NUM_FRAMES; n++) {
+        for (int i = 0; i < LC3_NUM_BANDS; i++)
+            eb[i] = powf(10, frand(2)) / (1 + i * (n & 7));
+
+        compute_scale_factors(LC3_DT_10M, LC3_SRATE_48K, eb, false, scf[n]);
+    }
+
+    uint64_t t_ref = UINT64_MAX, t_fast = UINT64_MAX;
+    volatile int sink = 0;
+
+    for (int run = 0; run < NUM_RUNS; run++) {
+        int lfcb, hfcb, shape, gain, c[4][16];
+        float cn[4][16];
+
+        uint64_t t0 = clock_ns();
+
+        for (int n = 0; n < NUM_FRAMES; n++) {
+            resolve_codebooks_ref(scf[n], &lfcb, &hfcb);
+            quantize_ref(scf[n], lfcb, hfcb, 4, c, cn, &shape, &gain);
+            sink += shape + gain;
+        }
+
+        uint64_t t1 = clock_ns();
+
+        for (int n = 0; n < NUM_FRAMES; n++) {
+            resolve_codebooks(scf[n], &lfcb, &hfcb);
+            quantize(scf[n], lfcb, hfcb, 4, c, cn, &shape, &gain);
+            sink += shape + gain;
+        }
+
+        uint64_t t2 = clock_ns();
+
+        t_ref = LC3_MIN(t_ref, t1 - t0);
+        t_fast = LC3_MIN(t_fast, t2 - t1);
+    }
+
+    printf("SNS search per frame: reference %u ns, fast %u ns\n",
+        (unsigned)(t_ref / NUM_FRAMES), (unsigned)(t_fast / NUM_FRAMES));
+
+    return 0;
+}
@@ -155,7 +155,7 @@ static PyObject *analyze_py(PyObject *m, PyObject *args)
     CTYPES_CHECK("eb", to_1d_ptr(eb_obj, NPY_FLOAT, nb, &eb));
     CTYPES_CHECK("x", x_obj = to_1d_ptr(x_obj, NPY_FLOAT, ne, &x));
 
-    lc3_sns_analyze(dt, sr, eb, att, &data, x, x);
+    lc3_sns_analyze(dt, sr, eb, att, false, &data, x, x);
 
     return Py_BuildValue("ON", x_obj, new_sns_data(&data));
 }
@@ -0,0 +1,156 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include "xtensa_fp.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* -------------------------------------------------------------------------- */
+
+#define TEST_XTENSA
+#include <mdct.c>
+
+/* -------------------------------------------------------------------------- */
+
+static void random_complex(struct lc3_complex *x, int n)
+{
+    for (int i = 0; i < n; i++) {
+          x[i].re = 2 * (double)rand() / RAND_MAX - 1;
+          x[i].im = 2 * (double)rand() / RAND_MAX - 1;
+    }
+}
+
+static int compare(const float *a, const float *b, int n)
+{
+    for (int i = 0; i < n; i++)
+        if (fabsf(a[i] - b[i]) > 1e-6f * fmaxf(1.f, fabsf(a[i])))
+            return -1;
+
+    return 0;
+}
+
+static int check_fft(void)
+{
+    struct lc3_complex x[240];
+    struct lc3_complex y[240], y_xtensa[240];
+
+    random_complex(x, 240);
+
+    fft_5(x, y, 240/5);
+    xtensa_fft_5(x, y_xtensa, 240/5);
+    if (compare((float *)y, (float *)y_xtensa, 2*240) < 0)
+        return -1;
+
+    for (int i3 = 0; i3 < 2; i3++) {
+        int n3 = lc3_fft_twiddles_bf3[i3]->n3;
+
+        fft_bf3(lc3_fft_twiddles_bf3[i3], x, y, 240/(3*n3));
+        xtensa_fft_bf3(lc3_fft_twiddles_bf3[i3], x, y_xtensa, 240/(3*n3));
+        if (compare((float *)y, (float *)y_xtensa, 2*240) < 0)
+            return -1;
+    }
+
+    for (int i2 = 0; i2 < 5; i2++)
+        for (int i3 = 0; i3 < 3; i3++) {
+            const struct lc3_fft_bf2_twiddles *tw = lc3_fft_twiddles_bf2[i2][i3];
+            if (!tw || 240 % (2*tw->n2))
+                continue;
+
+            fft_bf2(tw, x, y, 240/(2*tw->n2));
+            xtensa_fft_bf2(tw, x, y_xtensa, 240/(2*tw->n2));
+            if (compare((float *)y, (float *)y_xtensa, 2*240) < 0)
+                return -1;
+        }
+
+    for (int i2 = 0; i2 < 4; i2++)
+        for (int i3 = 0; i3 < 3; i3++) {
+            const struct lc3_fft_bf2_twiddles *tw_a, *tw_b;
+            tw_a = lc3_fft_twiddles_bf2[i2][i3];
+            tw_b = lc3_fft_twiddles_bf2[i2+1][i3];
+            if (!tw_a || !tw_b || 240 % (4*tw_a->n2))
+                continue;
+
+            fft_bf4(tw_a, tw_b, x, y, 240/(2*tw_a->n2));
+            xtensa_fft_bf4(tw_a, tw_b, x, y_xtensa, 240/(2*tw_a->n2));
+            if (compare((float *)y, (float *)y_xtensa, 2*240) < 0)
+                return -1;
+
+            /* Same results as the 2 stages radix 2 */
+
+            struct lc3_complex z[240];
+            xtensa_fft_bf2(tw_a, x, z, 240/(2*tw_a->n2));
+            xtensa_fft_bf2(tw_b, z, y, 240/(4*tw_a->n2));
+            if (memcmp(y, y_xtensa, sizeof(y)) != 0)
+                return -1;
+        }
+
+    return 0;
+}
+
+static int check_rotations(void)
+{
+    for (int dt = 0; dt < LC3_NUM_DT; dt++)
+        for (int sr = 0; sr < LC3_NUM_SRATE; sr++) {
+            const struct lc3_mdct_rot_def *rot = lc3_mdct_rot[dt][sr];
+            int n4 = rot->n4;
+
+            struct lc3_complex x[240], y[240], y_xtensa[240];
+            random_complex(x, n4);
+
+            /* Run in place, as the MDCT does */
+
+            memcpy(y, x, n4 * sizeof(*x));
+            memcpy(y_xtensa, x, n4 * sizeof(*x));
+            mdct_pre_fft(rot, (float *)y, y);
+            xtensa_mdct_pre_fft(rot, (float *)y_xtensa, y_xtensa);
+            if (compare((float *)y, (float *)y_xtensa, 2*n4) < 0)
+                return -1;
+
+            mdct_post_fft(rot, y, (float *)y);
+            xtensa_mdct_post_fft(rot, y_xtensa, (float *)y_xtensa);
+            if (compare((float *)y, (float *)y_xtensa, 2*n4) < 0)
+                return -1;
+
+            imdct_pre_fft(rot, (float *)y, y);
+            xtensa_imdct_pre_fft(rot, (float *)y_xtensa, y_xtensa);
+            if (compare((float *)y, (float *)y_xtensa, 2*n4) < 0)
+                return -1;
+
+            imdct_post_fft(rot, y, (float *)y);
+            xtensa_imdct_post_fft(rot, y_xtensa, (float *)y_xtensa);
+            if (compare((float *)y, (float *)y_xtensa, 2*n4) < 0)
+                return -1;
+        }
+
+    return 0;
+}
+
+int check_mdct(void)
+{
+    int ret;
+
+    if ((ret = check_fft()) < 0)
+        return ret;
+
+    if ((ret = check_rotations()) < 0)
+        return ret;
+
+    return 0;
+}
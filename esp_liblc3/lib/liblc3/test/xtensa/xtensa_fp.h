@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#if __XTENSA__ && !__XTENSA_SOFT_FLOAT__
+
+static inline float __xt_madd(float a, float b, float c)
+{
+    __asm("madd.s %0, %1, %2" : "+f" (a) : "f" (b), "f" (c));
+    return a;
+}
+
+static inline float __xt_msub(float a, float b, float c)
+{
+    __asm("msub.s %0, %1, %2" : "+f" (a) : "f" (b), "f" (c));
+    return a;
+}
+
+#else
+
+#include <math.h>
+
+/* `madd.s` and `msub.s` round once, as `fmaf()` */
+
+__attribute__((unused))
+static float __xt_madd(float a, float b, float c)
+{
+    return fmaf(b, c, a);
+}
+
+__attribute__((unused))
+static float __xt_msub(float a, float b, float c)
+{
+    return fmaf(-b, c, a);
+}
+
+#endif /* __XTENSA__ && !__XTENSA_SOFT_FLOAT__ */
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ *  Copyright 2024 Kasper Nyhus Kaae
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if __XTENSA__
+#include <xtensa/config/core-isa.h>
+#endif
+
+#if __XTENSA__ && XCHAL_HAVE_MAC16
+
+static inline void __xt_acc_clear(void)
+{
+    __asm volatile ("wsr %0, acclo\n\twsr %0, acchi" : : "r" (0));
+}
+
+static inline void __xt_mula_ll(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.ll %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_hh(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.hh %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_lh(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.lh %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline void __xt_mula_hl(int32_t a, int32_t b)
+{
+    __asm volatile ("mula.aa.hl %0, %1" : : "r" (a), "r" (b));
+}
+
+static inline int64_t __xt_acc_read(void)
+{
+    uint32_t lo; int32_t hi;
+    __asm volatile ("rsr %0, acclo" : "=r" (lo));
+    __asm volatile ("rsr %0, acchi" : "=r" (hi));
+    return (int64_t)(int8_t)hi * (1LL << 32) + lo;
+}
+
+static inline int32_t __xt_l32i(const int32_t *p)
+{
+    return *p;
+}
+
+#else
+
+/* The MAC16 ACC register, 40 bits */
+
+static int64_t __xt_acc;
+
+__attribute__((unused))
+static void __xt_acc_clear(void)
+{
+    __xt_acc = 0;
+}
+
+__attribute__((unused))
+static void __xt_mula(int16_t a, int16_t b)
+{
+    int64_t v = (uint64_t)(__xt_acc + a * b) << 24;
+    __xt_acc = v >> 24;
+}
+
+__attribute__((unused))
+static void __xt_mula_ll(int32_t a, int32_t b)
+{
+    __xt_mula(a & 0xffff, b & 0xffff);
+}
+
+__attribute__((unused))
+static void __xt_mula_hh(int32_t a, int32_t b)
+{
+    __xt_mula(a >> 16, b >> 16);
+}
+
+__attribute__((unused))
+static void __xt_mula_lh(int32_t a, int32_t b)
+{
+    __xt_mula(a & 0xffff, b >> 16);
+}
+
+__attribute__((unused))
+static void __xt_mula_hl(int32_t a, int32_t b)
+{
+    __xt_mula(a >> 16, b & 0xffff);
+}
+
+__attribute__((unused))
+static int64_t __xt_acc_read(void)
+{
+    return __xt_acc;
+}
+
+/* Loads fault as `l32i` does, when not aligned on 32 bits */
+
+__attribute__((unused))
+static int32_t __xt_l32i(const int32_t *p)
+{
+    if ((uintptr_t)p & 3) {
+        fprintf(stderr, "LoadStoreAlignment at %p\n", (const void *)p);
+        abort();
+    }
+
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+#endif /* __XTENSA__ && XCHAL_HAVE_MAC16 */
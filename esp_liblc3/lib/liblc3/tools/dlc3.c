@@ -197,10 +197,14 @@ int main(int argc, char *argv[])
     enum lc3_pcm_format pcm_fmt =
         pcm_sbits == 24 ? LC3_PCM_FORMAT_S24_3LE : LC3_PCM_FORMAT_S16;
 
-    for (int ich = 0; ich < nch; ich++)
+    for (int ich = 0; ich < nch; ich++) {
         dec[ich] = lc3_setup_decoder(frame_us, srate_hz, p.srate_hz,
             malloc(lc3_decoder_size(frame_us, pcm_srate_hz)));
 
+        if (!dec[ich])
+            error(EINVAL, "Decoder initialization failed");
+    }
+
     /* --- Decoding loop --- */
 
     static const char *dash_line = "========================================";
@@ -61,6 +61,7 @@ struct parameters {
     float frame_ms;
     int srate_hz;
     int bitrate;
+    int complexity;
 };
 
 static struct parameters parse_args(int argc, char *argv[])
@@ -76,6 +77,7 @@ static struct parameters parse_args(int argc, char *argv[])
         "\t-b\t"     "Bitrate in bps (mandatory)\n"
         "\t-m\t"     "Frame duration in ms (default 10)\n"
         "\t-r\t"     "Encoder samplerate (default is input samplerate)\n"
+        "\t-c\t"     "Complexity 0: High  1: Medium  2: Low (default 0)\n"
         "\n";
 
     struct parameters p = { .frame_ms = 10 };
@@ -91,7 +93,7 @@ static struct parameters parse_args(int argc, char *argv[])
             const char *optarg = NULL;
 
             switch (opt) {
-                case 'b': case 'm': case 'r':
+                case 'b': case 'm': case 'r': case 'c':
                     if (iarg >= argc)
                         error(EINVAL, "Argument %s", arg);
                     optarg = argv[iarg++];
@@ -102,6 +104,7 @@ static struct parameters parse_args(int argc, char *argv[])
                 case 'b': p.bitrate = atoi(optarg); break;
                 case 'm': p.frame_ms = atof(optarg); break;
                 case 'r': p.srate_hz = atoi(optarg); break;
+                case 'c': p.complexity = atoi(optarg); break;
                 default:
                     error(EINVAL, "Option %s", arg);
             }
@@ -204,10 +207,17 @@ int main(int argc, char *argv[])
         pcm_sbytes == 32/8 ? LC3_PCM_FORMAT_S24 :
         pcm_sbytes == 24/8 ? LC3_PCM_FORMAT_S24_3LE : LC3_PCM_FORMAT_S16;
 
-    for (int ich = 0; ich < nch; ich++)
+    for (int ich = 0; ich < nch; ich++) {
         enc[ich] = lc3_setup_encoder(frame_us, enc_srate_hz, srate_hz,
             malloc(lc3_encoder_size(frame_us, srate_hz)));
 
+        if (!enc[ich])
+            error(EINVAL, "Encoder initialization failed");
+
+        if (lc3_encoder_set_complexity(enc[ich], p.complexity) < 0)
+            error(EINVAL, "Complexity %d", p.complexity);
+    }
+
     /* --- Encoding loop --- */
 
     static const char *dash_line = "========================================";
@@ -0,0 +1,20 @@
+/**
+ * @file esp_liblc3_private.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Helpers shared by the esp_liblc3 sources
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "lc3.h"
+
+/**
+ * @brief Bytes per PCM sample of a format
+ */
+size_t esp_lc3_sample_size(enum lc3_pcm_format format);
@@ -0,0 +1,250 @@
+/**
+ * @file test_esp_liblc3.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_heap_caps.h"
+
+#include "esp_liblc3.h"
+
+#define DT_US 10000
+#define SR_HZ 48000
+#define NS 480
+#define NBYTES 100
+#define NUM_FRAMES 20
+#define LOST_FRAME 5
+
+/**
+ * @brief One frame of interleaved PCM, a different tone per channel over noise
+ */
+static void fill_pcm(int16_t* pcm, int num_channels, int frame)
+{
+    static uint32_t seed = 1;
+
+    for (int i = 0; i < NS; i++) {
+        for (int ch = 0; ch < num_channels; ch++) {
+            seed = seed * 1664525 + 1013904223;
+            float tone = 8000 * sinf(0.02f * (ch + 1) * (frame * NS + i));
+            pcm[i * num_channels + ch] = (int16_t)(tone + (int16_t)(seed >> 16) / 16);
+        }
+    }
+}
+
+/**
+ * @brief Encode the same frames with two multi-channel configurations, which may only differ in memory placement
+ */
+static void check_same_encoding(const esp_lc3_config_t* cfg_a, const esp_lc3_config_t* cfg_b)
+{
+    esp_lc3_multi_encoder_t enc_a, enc_b;
+    int16_t pcm[ESP_LC3_CHANNELS_MAX * NS];
+    uint8_t out_a[ESP_LC3_CHANNELS_MAX * NBYTES], out_b[ESP_LC3_CHANNELS_MAX * NBYTES];
+    int num_channels = cfg_a->num_channels ? cfg_a->num_channels : 1;
+
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&enc_a, cfg_a));
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&enc_b, cfg_b));
+    for (int f = 0; f < NUM_FRAMES; f++) {
+        fill_pcm(pcm, num_channels, f);
+        TEST_ESP_OK(esp_lc3_multi_encode(&enc_a, pcm, out_a));
+        TEST_ESP_OK(esp_lc3_multi_encode(&enc_b, pcm, out_b));
+        TEST_ASSERT_EQUAL_MEMORY(out_a, out_b, num_channels * NBYTES);
+    }
+    esp_lc3_multi_encoder_deinit(&enc_a);
+    esp_lc3_multi_encoder_deinit(&enc_b);
+}
+
+TEST_CASE("LC3 multi-channel layout", "[lc3]")
+{
+    enum { NUM_CHANNELS = 3 };
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .stride = NUM_CHANNELS,
+        .num_channels = NUM_CHANNELS,
+    };
+    esp_lc3_multi_encoder_t multi_enc;
+    esp_lc3_multi_decoder_t multi_dec;
+    esp_lc3_encoder_t enc[NUM_CHANNELS];
+    esp_lc3_decoder_t dec[NUM_CHANNELS];
+
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&multi_enc, &cfg));
+    TEST_ESP_OK(esp_lc3_multi_decoder_init(&multi_dec, &cfg));
+    TEST_ASSERT_EQUAL_INT(NS, multi_enc.num_frames);
+    for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+        TEST_ESP_OK(esp_lc3_encoder_init(&enc[ch], &cfg));
+        TEST_ESP_OK(esp_lc3_decoder_init(&dec[ch], &cfg));
+    }
+
+    // Channel n of the interleaved PCM is the frame at n * NBYTES, and back
+    static int16_t pcm[NUM_CHANNELS * NS], multi_pcm[NUM_CHANNELS * NS], single_pcm[NUM_CHANNELS * NS];
+    uint8_t multi_out[NUM_CHANNELS * NBYTES], single_out[NUM_CHANNELS * NBYTES];
+    for (int f = 0; f < NUM_FRAMES; f++) {
+        fill_pcm(pcm, NUM_CHANNELS, f);
+        TEST_ESP_OK(esp_lc3_multi_encode(&multi_enc, pcm, multi_out));
+        for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+            TEST_ESP_OK(esp_lc3_encode(&enc[ch], pcm + ch, single_out + ch * NBYTES));
+        }
+        TEST_ASSERT_EQUAL_MEMORY(single_out, multi_out, sizeof(multi_out));
+
+        // NULL conceals the lost frame on every channel
+        bool lost = f == LOST_FRAME;
+        TEST_ESP_OK(esp_lc3_multi_decode(&multi_dec, lost ? NULL : multi_out, multi_pcm));
+        for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+            TEST_ESP_OK(esp_lc3_decode(&dec[ch], lost ? NULL : single_out + ch * NBYTES, single_pcm + ch));
+        }
+        TEST_ASSERT_EQUAL_INT16_ARRAY(single_pcm, multi_pcm, NUM_CHANNELS * NS);
+    }
+
+    esp_lc3_multi_encoder_deinit(&multi_enc);
+    esp_lc3_multi_decoder_deinit(&multi_dec);
+    for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+        esp_lc3_encoder_deinit(&enc[ch]);
+        esp_lc3_decoder_deinit(&dec[ch]);
+    }
+}
+
+TEST_CASE("LC3 multi-channel invalid configuration", "[lc3]")
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .num_channels = ESP_LC3_CHANNELS_MAX + 1,
+    };
+    esp_lc3_multi_encoder_t enc;
+    esp_lc3_multi_decoder_t dec;
+
+    TEST_ESP_ERR(esp_lc3_multi_encoder_init(&enc, &cfg), ESP_ERR_INVALID_ARG);
+    TEST_ESP_ERR(esp_lc3_multi_decoder_init(&dec, &cfg), ESP_ERR_INVALID_ARG);
+
+    cfg.num_channels = 2;
+    cfg.sample_rate = 44100;
+    TEST_ESP_ERR(esp_lc3_multi_encoder_init(&enc, &cfg), ESP_ERR_INVALID_ARG);
+    TEST_ESP_ERR(esp_lc3_multi_decoder_init(&dec, &cfg), ESP_ERR_INVALID_ARG);
+
+    cfg.sample_rate = SR_HZ;
+    cfg.complexity = LC3_COMPLEXITY_LOW + 1;
+    TEST_ESP_ERR(esp_lc3_multi_encoder_init(&enc, &cfg), ESP_ERR_INVALID_ARG);
+}
+
+TEST_CASE("LC3 static memory", "[lc3]")
+{
+    static LC3_ENCODER_MEM_T(DT_US, SR_HZ) enc_mem;
+    static uint8_t multi_mem[ESP_LC3_MULTI_ENCODER_SIZE(DT_US, SR_HZ, 2)] __attribute__((aligned(ESP_LC3_STATE_ALIGN)));
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .stride = 1,
+        .mem = {
+            .type = ESP_LC3_MEM_STATIC,
+            .memory = &enc_mem,
+            .size = sizeof(enc_mem),
+        },
+    };
+
+    esp_lc3_encoder_t enc;
+    TEST_ESP_OK(esp_lc3_encoder_init(&enc, &cfg));
+    TEST_ASSERT_TRUE(enc.lc3_encoder_memory == (uint8_t*)&enc_mem);
+    esp_lc3_encoder_deinit(&enc);
+
+    // Too small for two channels
+    esp_lc3_multi_encoder_t multi_enc;
+    cfg.num_channels = 2;
+    TEST_ESP_ERR(esp_lc3_multi_encoder_init(&multi_enc, &cfg), ESP_ERR_NO_MEM);
+
+    // Sized by the compile-time macro, encodes like malloc()'d state
+    TEST_ASSERT_EQUAL_INT(sizeof(multi_mem), esp_lc3_state_size(&cfg, false));
+    cfg.mem.memory = multi_mem;
+    cfg.mem.size = sizeof(multi_mem);
+    esp_lc3_config_t cfg_default = cfg;
+    cfg_default.mem = (esp_lc3_mem_config_t) { 0 };
+    check_same_encoding(&cfg_default, &cfg);
+}
+
+TEST_CASE("LC3 memory pool", "[lc3]")
+{
+    enum { NUM_SLOTS = 2 };
+    static uint8_t pool_mem[NUM_SLOTS * ESP_LC3_STATE_ALIGN_UP(ESP_LC3_DECODER_SIZE(DT_US, SR_HZ))]
+        __attribute__((aligned(ESP_LC3_STATE_ALIGN)));
+    esp_lc3_pool_t pool;
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .stride = 1,
+        .mem = {
+            .type = ESP_LC3_MEM_POOL,
+            .pool = &pool,
+        },
+    };
+
+    TEST_ESP_ERR(esp_lc3_pool_init(&pool, "dec", pool_mem, 0, NUM_SLOTS), ESP_ERR_INVALID_ARG);
+    TEST_ESP_ERR(esp_lc3_pool_init(&pool, "dec", pool_mem, 1024, ESP_LC3_POOL_SLOTS_MAX + 1), ESP_ERR_INVALID_ARG);
+    TEST_ESP_OK(esp_lc3_pool_init(&pool, "dec", pool_mem, ESP_LC3_DECODER_SIZE(DT_US, SR_HZ), NUM_SLOTS));
+
+    // One slot per session, a freed slot is reused
+    esp_lc3_decoder_t dec[NUM_SLOTS + 1];
+    TEST_ESP_OK(esp_lc3_decoder_init(&dec[0], &cfg));
+    TEST_ESP_OK(esp_lc3_decoder_init(&dec[1], &cfg));
+    TEST_ASSERT_TRUE(dec[0].lc3_decoder_memory != dec[1].lc3_decoder_memory);
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, esp_lc3_decoder_init(&dec[2], &cfg));
+
+    uint8_t* freed = dec[0].lc3_decoder_memory;
+    esp_lc3_decoder_deinit(&dec[0]);
+    TEST_ESP_OK(esp_lc3_decoder_init(&dec[2], &cfg));
+    TEST_ASSERT_TRUE(dec[2].lc3_decoder_memory == freed);
+
+    // Two channels do not fit one slot
+    esp_lc3_decoder_deinit(&dec[1]);
+    esp_lc3_multi_decoder_t multi_dec;
+    cfg.num_channels = 2;
+    TEST_ESP_ERR(esp_lc3_multi_decoder_init(&multi_dec, &cfg), ESP_ERR_NO_MEM);
+    esp_lc3_decoder_deinit(&dec[2]);
+    TEST_ASSERT_EQUAL_UINT32(0, atomic_load(&pool.used));
+    esp_lc3_pool_deinit(&pool);
+
+    // Pool allocated from internal DRAM, slots sized for two channels
+    TEST_ESP_OK(esp_lc3_pool_init(&pool, "enc", NULL, ESP_LC3_MULTI_ENCODER_SIZE(DT_US, SR_HZ, 2), 1));
+    TEST_ASSERT_NOT_NULL(pool.memory);
+    esp_lc3_config_t cfg_default = cfg;
+    cfg_default.mem = (esp_lc3_mem_config_t) { 0 };
+    check_same_encoding(&cfg_default, &cfg);
+    TEST_ASSERT_EQUAL_UINT32(0, atomic_load(&pool.used));
+    esp_lc3_pool_deinit(&pool);
+}
+
+TEST_CASE("LC3 heap capabilities memory", "[lc3]")
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .num_channels = 2,
+    };
+    esp_lc3_config_t cfg_caps = cfg;
+    cfg_caps.mem = (esp_lc3_mem_config_t) {
+        .type = ESP_LC3_MEM_CAPS,
+        .caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    };
+    esp_lc3_config_t cfg_internal = cfg;
+    cfg_internal.mem.type = ESP_LC3_MEM_INTERNAL;
+
+    check_same_encoding(&cfg, &cfg_caps);
+    check_same_encoding(&cfg, &cfg_internal);
+}
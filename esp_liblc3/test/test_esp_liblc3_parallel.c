@@ -0,0 +1,179 @@
+/**
+ * @file test_esp_liblc3_parallel.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_timer.h"
+
+#include "esp_liblc3_parallel.h"
+
+#define DT_US 10000
+#define NBYTES 40
+#define STRESS_FRAMES 500
+#define BENCH_FRAMES 200
+#define BENCH_CHANNELS 4
+
+static void fill_pcm(int16_t* pcm, int num_samples, int frame)
+{
+    for (int i = 0; i < num_samples; i++) {
+        pcm[i] = (int16_t)(8000 * sinf(0.0123f * (1 + i % 5) * (frame * num_samples + i)));
+    }
+}
+
+/**
+ * @brief Encode with the workers and with esp_lc3_multi_encode(), the output must be the same for every frame
+ */
+static void check_multi_encode(int num_workers, int num_channels, int sr_hz, int num_frames)
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = sr_hz,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .num_channels = num_channels,
+    };
+    esp_lc3_parallel_config_t parallel_cfg = ESP_LC3_PARALLEL_DEFAULT_CONFIG();
+    parallel_cfg.num_workers = num_workers;
+    esp_lc3_parallel_handle_t parallel;
+    esp_lc3_multi_encoder_t enc, ref;
+
+    TEST_ESP_OK(esp_lc3_parallel_create(&parallel_cfg, &parallel));
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&enc, &cfg));
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&ref, &cfg));
+
+    int num_samples = enc.num_frames * num_channels;
+    static int16_t pcm[ESP_LC3_CHANNELS_MAX * LC3_MAX_FRAME_SAMPLES];
+    uint8_t out[ESP_LC3_CHANNELS_MAX * NBYTES], out_ref[ESP_LC3_CHANNELS_MAX * NBYTES];
+    for (int f = 0; f < num_frames; f++) {
+        fill_pcm(pcm, num_samples, f);
+        memset(out, 0, sizeof(out));
+        TEST_ESP_OK(esp_lc3_parallel_multi_encode(parallel, &enc, pcm, out));
+        TEST_ESP_OK(esp_lc3_multi_encode(&ref, pcm, out_ref));
+        TEST_ASSERT_EQUAL_MEMORY(out_ref, out, num_channels * NBYTES);
+    }
+
+    esp_lc3_multi_encoder_deinit(&enc);
+    esp_lc3_multi_encoder_deinit(&ref);
+    esp_lc3_parallel_delete(parallel);
+}
+
+TEST_CASE("LC3 parallel multi-channel encode", "[lc3]")
+{
+    static const int num_channels[] = { 1, 2, 3, 5, 8 };
+
+    for (int w = 1; w <= ESP_LC3_PARALLEL_WORKERS_MAX; w++) {
+        for (int i = 0; i < sizeof(num_channels) / sizeof(*num_channels); i++) {
+            check_multi_encode(w, num_channels[i], 16000, STRESS_FRAMES);
+        }
+    }
+    check_multi_encode(0, 2, 16000, 10);
+}
+
+TEST_CASE("LC3 parallel encode of independent streams", "[lc3]")
+{
+    enum { NUM_STREAMS = ESP_LC3_PARALLEL_JOBS_MAX };
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = 16000,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .stride = 1,
+    };
+    esp_lc3_parallel_config_t parallel_cfg = ESP_LC3_PARALLEL_DEFAULT_CONFIG();
+    parallel_cfg.num_workers = 3;
+    esp_lc3_parallel_handle_t parallel;
+    static esp_lc3_encoder_t enc[NUM_STREAMS], ref[NUM_STREAMS];
+
+    TEST_ESP_OK(esp_lc3_parallel_create(&parallel_cfg, &parallel));
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        TEST_ESP_OK(esp_lc3_encoder_init(&enc[i], &cfg));
+        TEST_ESP_OK(esp_lc3_encoder_init(&ref[i], &cfg));
+    }
+
+    // The number of streams changes every frame
+    static int16_t pcm[NUM_STREAMS * 160];
+    uint8_t out[NUM_STREAMS][NBYTES], out_ref[NBYTES];
+    esp_lc3_parallel_job_t jobs[NUM_STREAMS];
+    for (int f = 0; f < STRESS_FRAMES; f++) {
+        int num_jobs = 1 + f % NUM_STREAMS;
+        fill_pcm(pcm, num_jobs * 160, f);
+        for (int i = 0; i < num_jobs; i++) {
+            jobs[i] = (esp_lc3_parallel_job_t) { .enc = &enc[i], .in = pcm + i * 160, .out = out[i] };
+        }
+        TEST_ESP_OK(esp_lc3_parallel_encode(parallel, jobs, num_jobs));
+        for (int i = 0; i < num_jobs; i++) {
+            TEST_ESP_OK(esp_lc3_encode(&ref[i], pcm + i * 160, out_ref));
+            TEST_ASSERT_EQUAL_MEMORY(out_ref, out[i], NBYTES);
+        }
+    }
+
+    TEST_ESP_OK(esp_lc3_parallel_encode(parallel, jobs, 0));
+    TEST_ESP_ERR(esp_lc3_parallel_encode(parallel, jobs, ESP_LC3_PARALLEL_JOBS_MAX + 1), ESP_ERR_INVALID_ARG);
+
+    for (int i = 0; i < NUM_STREAMS; i++) {
+        esp_lc3_encoder_deinit(&enc[i]);
+        esp_lc3_encoder_deinit(&ref[i]);
+    }
+    esp_lc3_parallel_delete(parallel);
+
+    parallel_cfg.num_workers = ESP_LC3_PARALLEL_WORKERS_MAX + 1;
+    TEST_ESP_ERR(esp_lc3_parallel_create(&parallel_cfg, &parallel), ESP_ERR_INVALID_ARG);
+}
+
+TEST_CASE("LC3 parallel encode scaling", "[lc3][bench]")
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = 48000,
+        .frame_size = DT_US,
+        .nbytes_target = 120,
+        .num_channels = BENCH_CHANNELS,
+    };
+    static int16_t pcm[BENCH_CHANNELS * 480];
+    uint8_t out[BENCH_CHANNELS * 120];
+    int64_t t_serial = 0;
+
+    printf("%d channels, 48 kHz, 10 ms\n", BENCH_CHANNELS);
+    for (int w = -1; w <= ESP_LC3_PARALLEL_WORKERS_MAX; w++) {
+        esp_lc3_parallel_config_t parallel_cfg = ESP_LC3_PARALLEL_DEFAULT_CONFIG();
+        parallel_cfg.num_workers = w < 0 ? 0 : w;
+        esp_lc3_parallel_handle_t parallel;
+        esp_lc3_multi_encoder_t enc;
+        TEST_ESP_OK(esp_lc3_parallel_create(&parallel_cfg, &parallel));
+        TEST_ESP_OK(esp_lc3_multi_encoder_init(&enc, &cfg));
+
+        int64_t t = 0;
+        for (int f = 0; f < BENCH_FRAMES; f++) {
+            fill_pcm(pcm, BENCH_CHANNELS * 480, f);
+            int64_t t0 = esp_timer_get_time();
+            if (w < 0) {
+                TEST_ESP_OK(esp_lc3_multi_encode(&enc, pcm, out));
+            } else {
+                TEST_ESP_OK(esp_lc3_parallel_multi_encode(parallel, &enc, pcm, out));
+            }
+            t += esp_timer_get_time() - t0;
+        }
+
+        // -1 is esp_lc3_multi_encode(), the reference for the speedup
+        if (w < 0) {
+            t_serial = t;
+            printf("serial:    %6lld us/frame\n", (long long)(t / BENCH_FRAMES));
+        } else {
+            printf("%d workers: %6lld us/frame, speedup %.2f\n", w, (long long)(t / BENCH_FRAMES), (double)t_serial / t);
+        }
+
+        esp_lc3_multi_encoder_deinit(&enc);
+        esp_lc3_parallel_delete(parallel);
+    }
+}
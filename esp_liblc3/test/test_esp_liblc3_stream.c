@@ -0,0 +1,160 @@
+/**
+ * @file test_esp_liblc3_stream.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "esp_liblc3_stream.h"
+
+#define DT_US 10000
+#define SR_HZ 48000
+#define NS 480
+#define NBYTES 100
+#define NUM_CHANNELS 2
+#define NUM_FRAMES 21
+#define TAIL_SAMPLES 123 // samples of the last frame, completed by the flush
+#define LOST_FRAME 5
+
+// Chunks smaller than, equal to, and straddling frames
+static const int chunk_sizes[] = { 1, 7, 13, 48, 480, 960, 1000 };
+
+static int16_t pcm[NUM_FRAMES * NS * NUM_CHANNELS];
+static uint8_t frames[NUM_FRAMES][NUM_CHANNELS * NBYTES];
+
+typedef struct {
+    uint8_t (*frames)[NUM_CHANNELS * NBYTES];
+    int num_frames;
+} stream_ctx_t;
+
+static void fill_pcm(int16_t* pcm, int num_samples)
+{
+    for (int i = 0; i < num_samples; i++) {
+        for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+            pcm[i * NUM_CHANNELS + ch] = (int16_t)(8000 * sinf(0.02f * (ch + 1) * i));
+        }
+    }
+}
+
+static void encoded_cb(const void* frame, size_t size, void* ctx)
+{
+    stream_ctx_t* s = ctx;
+
+    TEST_ASSERT_EQUAL_INT(NUM_CHANNELS * NBYTES, size);
+    TEST_ASSERT_LESS_THAN_INT(NUM_FRAMES, s->num_frames);
+    memcpy(s->frames[s->num_frames++], frame, size);
+}
+
+static bool fetch_cb(void* frame, size_t size, void* ctx)
+{
+    stream_ctx_t* s = ctx;
+
+    TEST_ASSERT_EQUAL_INT(NUM_CHANNELS * NBYTES, size);
+    TEST_ASSERT_LESS_THAN_INT(NUM_FRAMES, s->num_frames);
+    if (s->num_frames++ == LOST_FRAME) {
+        return false;
+    }
+    memcpy(frame, s->frames[s->num_frames - 1], size);
+    return true;
+}
+
+/**
+ * @brief Encode with the stream encoder in chunks of mixed sizes, the frames must be the ones of
+ * esp_lc3_multi_encode(), the incomplete last frame being completed with silence by the flush
+ */
+TEST_CASE("LC3 stream encode of mixed chunk sizes", "[lc3]")
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .num_channels = NUM_CHANNELS,
+    };
+    int num_samples = (NUM_FRAMES - 1) * NS + TAIL_SAMPLES;
+    esp_lc3_multi_encoder_t ref;
+    esp_lc3_stream_encoder_t enc;
+    stream_ctx_t ctx = { .frames = frames };
+
+    memset(pcm, 0, sizeof(pcm));
+    fill_pcm(pcm, num_samples);
+
+    TEST_ESP_OK(esp_lc3_stream_encoder_init(&enc, &cfg, encoded_cb, &ctx));
+    for (int i = 0, pos = 0; pos < num_samples; i++) {
+        int n = chunk_sizes[i % (sizeof(chunk_sizes) / sizeof(*chunk_sizes))];
+        n = n < num_samples - pos ? n : num_samples - pos;
+        TEST_ESP_OK(esp_lc3_stream_encode(&enc, pcm + pos * NUM_CHANNELS, n));
+        pos += n;
+    }
+    TEST_ASSERT_EQUAL_INT(NUM_FRAMES - 1, ctx.num_frames);
+    TEST_ESP_OK(esp_lc3_stream_encoder_flush(&enc));
+    TEST_ASSERT_EQUAL_INT(NUM_FRAMES, ctx.num_frames);
+
+    // Nothing is pending after the flush
+    TEST_ESP_OK(esp_lc3_stream_encoder_flush(&enc));
+    TEST_ASSERT_EQUAL_INT(NUM_FRAMES, ctx.num_frames);
+    esp_lc3_stream_encoder_deinit(&enc);
+
+    uint8_t out[NUM_CHANNELS * NBYTES];
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&ref, &cfg));
+    for (int f = 0; f < NUM_FRAMES; f++) {
+        TEST_ESP_OK(esp_lc3_multi_encode(&ref, pcm + f * NS * NUM_CHANNELS, out));
+        TEST_ASSERT_EQUAL_MEMORY(out, frames[f], sizeof(out));
+    }
+    esp_lc3_multi_encoder_deinit(&ref);
+}
+
+/**
+ * @brief Decode with the stream decoder in chunks of mixed sizes, one frame being lost,
+ * the PCM must be the one of esp_lc3_multi_decode()
+ */
+TEST_CASE("LC3 stream decode of mixed chunk sizes", "[lc3]")
+{
+    esp_lc3_config_t cfg = {
+        .format = LC3_PCM_FORMAT_S16,
+        .sample_rate = SR_HZ,
+        .frame_size = DT_US,
+        .nbytes_target = NBYTES,
+        .num_channels = NUM_CHANNELS,
+    };
+    esp_lc3_multi_encoder_t enc;
+    esp_lc3_multi_decoder_t ref;
+    esp_lc3_stream_decoder_t dec;
+    stream_ctx_t ctx = { .frames = frames };
+
+    fill_pcm(pcm, NUM_FRAMES * NS);
+    TEST_ESP_OK(esp_lc3_multi_encoder_init(&enc, &cfg));
+    for (int f = 0; f < NUM_FRAMES; f++) {
+        TEST_ESP_OK(esp_lc3_multi_encode(&enc, pcm + f * NS * NUM_CHANNELS, frames[f]));
+    }
+    esp_lc3_multi_encoder_deinit(&enc);
+
+    TEST_ESP_OK(esp_lc3_stream_decoder_init(&dec, &cfg, fetch_cb, &ctx));
+    for (int i = 0, pos = 0; pos < NUM_FRAMES * NS; i++) {
+        int n = chunk_sizes[i % (sizeof(chunk_sizes) / sizeof(*chunk_sizes))];
+        n = n < NUM_FRAMES * NS - pos ? n : NUM_FRAMES * NS - pos;
+        TEST_ESP_OK(esp_lc3_stream_decode(&dec, pcm + pos * NUM_CHANNELS, n));
+        pos += n;
+
+        // A frame is fetched only when its first sample is needed
+        TEST_ASSERT_EQUAL_INT((pos + NS - 1) / NS, ctx.num_frames);
+    }
+    esp_lc3_stream_decoder_deinit(&dec);
+
+    static int16_t out[NS * NUM_CHANNELS];
+    TEST_ESP_OK(esp_lc3_multi_decoder_init(&ref, &cfg));
+    for (int f = 0; f < NUM_FRAMES; f++) {
+        TEST_ESP_OK(esp_lc3_multi_decode(&ref, f == LOST_FRAME ? NULL : frames[f], out));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(out, pcm + f * NS * NUM_CHANNELS, NS * NUM_CHANNELS);
+    }
+    esp_lc3_multi_decoder_deinit(&ref);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file rtcp.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief RTCP sender/receiver reports and SDES (RFC 3550)
+ * @version 0.1
+ * @date 2024-03-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include "rtp.h"
+
+#define RTCP_PT_SR 200
+#define RTCP_PT_RR 201
+#define RTCP_PT_SDES 202
+#define RTCP_PT_BYE 203
+
+#define RTCP_SDES_CNAME 1
+#define RTCP_CNAME_MAX 32
+
+#define RTCP_NTP_UNIX_OFFSET 2208988800ULL // seconds from 1900 to 1970
+
+/**
+ * @brief Reception quality of our stream as reported by the peer
+ */
+typedef struct {
+    uint32_t ssrc; // reporting peer
+    uint8_t fraction_lost; // 8 bit fixed point, since the peer's previous report
+    int32_t lost; // cumulative packets lost
+    uint32_t extended_max_seq;
+    uint32_t jitter; // interarrival jitter in timestamp units
+    bool rtt_valid; // set once the peer has received one of our sender reports
+    uint32_t rtt_us; // round-trip time
+} rtcp_feedback_t;
+
+/**
+ * @brief Called for every received report block about our stream, e.g. to adapt bitrate
+ */
+typedef void (*rtcp_feedback_cb_t)(uint8_t session, const rtcp_feedback_t* feedback, void* user_ctx);
+
+typedef struct {
+    uint32_t clock_rate; // RTP timestamp rate in Hz
+    const char* cname; // canonical name sent in SDES, at most RTCP_CNAME_MAX characters
+    rtcp_feedback_cb_t on_feedback;
+    void* user_ctx;
+} rtcp_config_t;
+
+/**
+ * @brief Initialize RTCP for an initialized session
+ *
+ * @param session identifier
+ * @param cfg RTCP configuration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtcp_init(uint8_t session, const rtcp_config_t* cfg);
+
+/**
+ * @brief Create a compound RTCP packet: a sender report if RTP packets were sent since the previous
+ *        report, a receiver report otherwise, followed by an SDES CNAME chunk.
+ *        The report block about the received stream is included when the session has an active receiver.
+ *        The sender report maps the current wallclock time to the RTP timestamp, extrapolated from
+ *        the timestamp and creation time of the last RTP packet.
+ *
+ * @param session identifier
+ * @param output buffer holding the RTCP packet
+ * @param size output buffer size
+ * @return size_t RTCP packet size in bytes, 0 on error
+ */
+size_t rtcp_create_report(uint8_t session, void* output, size_t size);
+
+/**
+ * @brief Process a received compound RTCP packet. Sender reports update the RTP to wallclock mapping
+ *        of the peer's stream, report blocks about our stream update the feedback and call `on_feedback`.
+ *
+ * @param session identifier
+ * @param buf received packet
+ * @param len packet length in bytes
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE / ESP_ERR_INVALID_VERSION if malformed
+ */
+esp_err_t rtcp_receive(uint8_t session, const void* buf, size_t len);
+
+/**
+ * @brief Get the latest feedback about our stream
+ *
+ * @param session identifier
+ * @param feedback latest feedback
+ * @return esp_err_t ESP_OK on success, ESP_FAIL if no report has been received
+ */
+esp_err_t rtcp_get_feedback(uint8_t session, rtcp_feedback_t* feedback);
+
+/**
+ * @brief Map an RTP timestamp of the peer's stream to wallclock time, using the last received sender report
+ *
+ * @param session identifier
+ * @param rtp_timestamp RTP timestamp of a received packet
+ * @param ntp_timestamp 64 bit NTP timestamp (Q32.32 seconds since 1900)
+ * @return esp_err_t ESP_OK on success, ESP_FAIL if no sender report has been received
+ */
+esp_err_t rtcp_rtp_to_ntp(uint8_t session, uint32_t rtp_timestamp, uint64_t* ntp_timestamp);
+
+/**
+ * @brief Get the CNAME of the peer from its last SDES packet
+ *
+ * @param session identifier
+ * @return const char* CNAME, empty string if unknown
+ */
+const char* rtcp_get_peer_cname(uint8_t session);
+
+/**
+ * @brief Current wallclock time as a 64 bit NTP timestamp. Wallclock must be set, e.g. by SNTP.
+ *
+ * @return uint64_t NTP timestamp (Q32.32 seconds since 1900)
+ */
+uint64_t rtcp_ntp_now(void);
@@ -13,9 +13,19 @@
 #pragma once
 #include <esp_system.h>
 
+#include "lwip/sockets.h"
+
 #define RTP_SESSION_MAX 4
 #define RTP_HEADER_SIZE 12
 
+/* RFC 8285 header extensions */
+#define RTP_EXTENSION_MAX 4
+#define RTP_EXTENSION_BLOCK_MAX 32
+#define RTP_HEADER_MAX_SIZE (RTP_HEADER_SIZE + 4 + RTP_EXTENSION_BLOCK_MAX)
+#define RTP_EXT_PROFILE_ONE_BYTE 0xBEDE
+#define RTP_EXT_PROFILE_TWO_BYTE 0x1000
+#define RTP_EXT_ABS_CAPTURE_TIME_SIZE 8
+
 typedef enum {
     RTP_STATE_INACTIVE,
     RTP_STATE_INITIALIZED,
@@ -34,11 +44,24 @@ typedef struct {
     uint32_t ssrc : 32; // synchronization source (SSRC) identifier
 } __attribute__((packed)) rtp_header_t;
 
+typedef struct {
+    uint8_t id;
+    uint8_t length; // data length in bytes
+    uint8_t offset; // data offset in the header template
+} rtp_extension_t;
+
 typedef struct {
     rtp_header_t header;
     int64_t esp_timestamp;
+    int64_t last_packet_us; // esp_timer time the last packet was created, anchors RTP timestamps to wallclock for RTCP
     size_t timestamp_inc;
+    uint32_t packet_count; // packets sent
+    uint32_t octet_count; // payload octets sent
     rtp_state_t state;
+    uint8_t header_template[RTP_HEADER_MAX_SIZE]; // pre-serialized big endian header
+    size_t header_size;
+    rtp_extension_t extensions[RTP_EXTENSION_MAX];
+    uint8_t num_extensions;
 } rtp_session_t;
 
 /**
@@ -86,3 +109,85 @@ rtp_state_t rtp_session_get_state(uint8_t session);
  * @return size_t total rtp packet size in bytes
  */
 size_t rtp_create_packet(uint8_t session, void* payload, size_t payload_length, void* output, size_t size);
+
+/**
+ * @brief Create an RTP packet in place, without copying the payload.
+ *        - The caller reserves `rtp_session_get_header_size()` bytes of headroom in front of the payload
+ *          (RTP_HEADER_SIZE without extensions): `packet` points to the headroom and the payload follows it.
+ *        - Only the header is written, in big endian.
+ *
+ * @param session identifier
+ * @param packet buffer with headroom followed by the payload
+ * @param payload_length length in bytes
+ * @param size packet buffer size, including headroom
+ * @return size_t total rtp packet size in bytes
+ */
+size_t rtp_create_packet_inplace(uint8_t session, void* packet, size_t payload_length, size_t size);
+
+/**
+ * @brief Write the header of the next RTP packet into `header`.
+ *        To be used when the payload is chained separately, e.g. with an lwIP pbuf chain.
+ *        The payload length is unknown here, so it is not counted in the RTCP sender octet count.
+ *
+ * @param session identifier
+ * @param header buffer receiving the header
+ * @param size header buffer size
+ * @return size_t header size in bytes
+ */
+size_t rtp_create_header(uint8_t session, void* header, size_t size);
+
+/**
+ * @brief Write the header of the next RTP packet into `header` and describe header and payload
+ *        as an iovec pair, ready for `sendmsg`. The payload is not copied.
+ *
+ * @param session identifier
+ * @param header buffer of RTP_HEADER_MAX_SIZE bytes, must stay valid until sent
+ * @param payload buffer with payload
+ * @param payload_length length in bytes
+ * @param iov iovec pair filled with header and payload
+ * @return size_t total rtp packet size in bytes
+ */
+size_t rtp_create_iovec(uint8_t session, void* header, void* payload, size_t payload_length, struct iovec iov[2]);
+
+/**
+ * @brief Get the header size of the session, including header extensions.
+ *
+ * @param session identifier
+ * @return size_t header size in bytes, 0 if the session is inactive
+ */
+size_t rtp_session_get_header_size(uint8_t session);
+
+/**
+ * @brief Add an RFC 8285 header extension element to every packet of the session.
+ *        The one-byte form is used while all elements have id 1-14 and 1-16 bytes of data,
+ *        otherwise the two-byte form. The extension block is part of the pre-serialized
+ *        header template, so it costs a copy and no encoding per packet.
+ *
+ * @param session identifier
+ * @param id extension element id, negotiated out of band (e.g. SDP extmap)
+ * @param length data length in bytes
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_session_add_extension(uint8_t session, uint8_t id, uint8_t length);
+
+/**
+ * @brief Set the data of a header extension element. Used by all following packets.
+ *
+ * @param session identifier
+ * @param id extension element id
+ * @param data extension data
+ * @param length data length, must match the length given when the extension was added
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_session_set_extension(uint8_t session, uint8_t id, const void* data, uint8_t length);
+
+/**
+ * @brief Set the absolute capture time extension (64 bit NTP timestamp, Q32.32).
+ *        The extension must have been added with length RTP_EXT_ABS_CAPTURE_TIME_SIZE.
+ *
+ * @param session identifier
+ * @param id extension element id
+ * @param ntp_timestamp capture time of the next packet
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_session_set_abs_capture_time(uint8_t session, uint8_t id, uint64_t ntp_timestamp);
@@ -0,0 +1,108 @@
+/**
+ * @file rtp_fanout.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief RTP session sending every packet to a list of unicast destinations or a multicast group
+ * @version 0.1
+ * @date 2024-03-30
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include "rtp.h"
+
+#include "lwip/sockets.h"
+
+typedef struct rtp_fanout* rtp_fanout_handle_t;
+
+typedef struct {
+    uint8_t payload_type;
+    size_t timestamp_inc; // RTP timestamp increment per packet
+    uint16_t local_port; // 0 for any
+    uint8_t multicast_ttl; // hops for multicast destinations, 0 for the lwIP default
+    bool multicast_loop; // deliver multicast packets to local listeners too
+} rtp_fanout_config_t;
+
+typedef struct {
+    uint32_t sent; // packets sent
+    uint32_t bytes; // bytes sent, including headers
+    uint32_t errors; // failed sends
+    int last_errno; // errno of the latest failed send
+} rtp_fanout_dest_stats_t;
+
+/**
+ * @brief Create a fan-out session with its own RTP session and socket. Any number can be created,
+ *        they are not limited by RTP_SESSION_MAX.
+ *
+ * @param cfg configuration
+ * @param handle created session
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_fanout_create(const rtp_fanout_config_t* cfg, rtp_fanout_handle_t* handle);
+
+/**
+ * @brief Close the socket and free the session and its destinations
+ *
+ * @param handle session
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_fanout_delete(rtp_fanout_handle_t handle);
+
+/**
+ * @brief Add a destination, unicast or multicast group. Can be called while sending.
+ *
+ * @param handle session
+ * @param destination address and port
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_STATE if already added
+ */
+esp_err_t rtp_fanout_add_destination(rtp_fanout_handle_t handle, const struct sockaddr_in* destination);
+
+/**
+ * @brief Remove a destination. Can be called while sending.
+ *
+ * @param handle session
+ * @param destination address and port
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if not added
+ */
+esp_err_t rtp_fanout_remove_destination(rtp_fanout_handle_t handle, const struct sockaddr_in* destination);
+
+/**
+ * @brief Build one RTP packet around the payload and send it to every destination.
+ *        The header is serialized once, the payload is not copied.
+ *
+ * @param handle session
+ * @param payload buffer with payload
+ * @param payload_length length in bytes
+ * @return esp_err_t ESP_OK if sent to all destinations, ESP_FAIL if any send failed
+ */
+esp_err_t rtp_fanout_send(rtp_fanout_handle_t handle, const void* payload, size_t payload_length);
+
+/**
+ * @brief Get the RTP session of a fan-out session, e.g. for its SSRC and packet counts
+ *
+ * @param handle session
+ * @return rtp_session_t* session
+ */
+rtp_session_t* rtp_fanout_get_session(rtp_fanout_handle_t handle);
+
+/**
+ * @brief Get the number of destinations
+ *
+ * @param handle session
+ * @return size_t destinations
+ */
+size_t rtp_fanout_get_num_destinations(rtp_fanout_handle_t handle);
+
+/**
+ * @brief Get the send statistics of one destination
+ *
+ * @param handle session
+ * @param destination address and port
+ * @param stats statistics
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if not added
+ */
+esp_err_t rtp_fanout_get_destination_stats(rtp_fanout_handle_t handle, const struct sockaddr_in* destination,
+                                           rtp_fanout_dest_stats_t* stats);
@@ -0,0 +1,140 @@
+/**
+ * @file rtp_lc3.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief LC3 RTP payload: several frames per packet and optional RFC 2198 redundancy of previous frames
+ * @version 0.1
+ * @date 2024-03-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include "rtp.h"
+#include "rtp_receiver.h"
+
+#define RTP_RED_HEADER_SIZE 4 // redundant block header
+#define RTP_RED_PRIMARY_HEADER_SIZE 1 // primary block header
+#define RTP_RED_TIMESTAMP_OFFSET_MAX 0x3fff // 14 bit
+#define RTP_RED_BLOCK_LENGTH_MAX 0x3ff // 10 bit
+#define RTP_LC3_RESYNC_FRAMES 50 // larger gaps restart the stream instead of reporting lost frames
+
+/**
+ * @brief Payload layout. Both sides must use the same configuration.
+ *
+ * The payload is `frames_per_packet` LC3 frames of `frame_bytes` each, back to back, with the
+ * RTP timestamp of the first frame. Frames of several channels are concatenated into one frame.
+ * With `redundancy` > 0 the RTP payload type is `red_payload_type` and the payload is RFC 2198:
+ * one redundant block holding the `redundancy` frames preceding the packet, followed by the primary block.
+ */
+typedef struct {
+    uint8_t payload_type; // LC3 payload type
+    uint8_t red_payload_type; // RFC 2198 payload type, used when redundancy > 0
+    uint16_t frame_bytes; // encoded frame size, constant
+    uint16_t frame_samples; // RTP timestamp units per frame, e.g. 480 for 10 ms at 48 kHz
+    uint8_t frames_per_packet;
+    uint8_t redundancy; // previous frames repeated in each packet, 0 to disable
+} rtp_lc3_config_t;
+
+typedef struct {
+    rtp_lc3_config_t cfg;
+    uint8_t* frames; // redundancy + frames_per_packet frames, oldest first
+    uint8_t num_history; // previous frames available for redundancy
+    uint8_t num_pending; // frames of the next packet written
+} rtp_lc3_packer_t;
+
+typedef enum {
+    RTP_LC3_FRAME_PRIMARY, // received as primary data
+    RTP_LC3_FRAME_RECOVERED, // primary was lost, recovered from redundancy
+    RTP_LC3_FRAME_LOST, // lost, `frame` is NULL: run the decoder's packet loss concealment
+} rtp_lc3_frame_status_t;
+
+/**
+ * @brief Called for every frame in timestamp order, including lost frames
+ */
+typedef void (*rtp_lc3_frame_cb_t)(const uint8_t* frame, uint32_t timestamp, rtp_lc3_frame_status_t status, void* user_ctx);
+
+typedef struct {
+    uint32_t frames; // frames delivered as primary data
+    uint32_t recovered; // frames recovered from redundancy
+    uint32_t lost; // frames reported lost
+    uint32_t invalid; // malformed payloads
+} rtp_lc3_stats_t;
+
+typedef struct {
+    rtp_lc3_config_t cfg;
+    rtp_lc3_frame_cb_t on_frame;
+    void* user_ctx;
+    bool started;
+    uint32_t next_timestamp; // timestamp of the next frame to deliver
+    rtp_lc3_stats_t stats;
+} rtp_lc3_depacketizer_t;
+
+/**
+ * @brief Largest payload produced with a configuration
+ *
+ * @param cfg payload configuration
+ * @return size_t payload size in bytes
+ */
+size_t rtp_lc3_payload_size(const rtp_lc3_config_t* cfg);
+
+/**
+ * @brief Initialize a packer, allocating room for one packet of frames and the redundancy history
+ *
+ * @param packer packer
+ * @param cfg payload configuration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_lc3_packer_init(rtp_lc3_packer_t* packer, const rtp_lc3_config_t* cfg);
+
+/**
+ * @brief Free a packer
+ *
+ * @param packer packer
+ */
+void rtp_lc3_packer_deinit(rtp_lc3_packer_t* packer);
+
+/**
+ * @brief Get the buffer the encoder writes the next frame into, e.g. as output of lc3_encode()
+ *
+ * @param packer packer
+ * @return uint8_t* buffer of `frame_bytes`
+ */
+uint8_t* rtp_lc3_packer_next_frame(rtp_lc3_packer_t* packer);
+
+/**
+ * @brief Commit the frame written to rtp_lc3_packer_next_frame(). Once `frames_per_packet` frames are
+ *        committed the payload is written to `output`, ready for rtp_create_packet() or rtp_sender_commit().
+ *        The session's `timestamp_inc` must be `frames_per_packet * frame_samples`.
+ *
+ * @param packer packer
+ * @param output payload buffer
+ * @param size output buffer size, at least rtp_lc3_payload_size()
+ * @return size_t payload length in bytes, 0 while the packet is not complete or on error
+ */
+size_t rtp_lc3_packer_push(rtp_lc3_packer_t* packer, void* output, size_t size);
+
+/**
+ * @brief Initialize a depacketizer
+ *
+ * @param depacketizer depacketizer
+ * @param cfg payload configuration
+ * @param on_frame called for every frame
+ * @param user_ctx passed to on_frame
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_lc3_depacketizer_init(rtp_lc3_depacketizer_t* depacketizer, const rtp_lc3_config_t* cfg,
+                                    rtp_lc3_frame_cb_t on_frame, void* user_ctx);
+
+/**
+ * @brief Unpack the frames of a packet, e.g. from the rtp_receiver on_packet callback.
+ *        Packets must arrive in sequence order. Frames missing from the previous packets are taken
+ *        from the redundant block if present, otherwise reported lost.
+ *
+ * @param depacketizer depacketizer
+ * @param packet parsed packet
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE if the payload is malformed
+ */
+esp_err_t rtp_lc3_unpack(rtp_lc3_depacketizer_t* depacketizer, const rtp_packet_t* packet);
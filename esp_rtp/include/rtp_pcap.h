@@ -0,0 +1,122 @@
+/**
+ * @file rtp_pcap.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Capture of sent and received RTP packets in pcap format, into a memory ring or a stream sink
+ * @version 0.1
+ * @date 2024-04-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "rtp.h"
+
+#include "lwip/sockets.h"
+
+#define RTP_PCAP_LINKTYPE_IPV4 228 // records hold an IPv4 and UDP header in front of the RTP packet
+#define RTP_PCAP_IP_UDP_HEADER_SIZE 28
+#define RTP_PCAP_RECORD_HEADER_SIZE 16
+#define RTP_PCAP_DEFAULT_PORT 5004 // UDP port written when the peer is unknown
+#define RTP_PCAP_STREAM_BUFFER_DEFAULT 8192 // bytes buffered ahead of the writer task of a stream sink
+#define RTP_PCAP_SESSION_FANOUT RTP_SESSION_MAX // session id of packets sent by fan-out sessions
+#define RTP_PCAP_ALL_SESSIONS ((1u << (RTP_PCAP_SESSION_FANOUT + 1)) - 1)
+
+typedef enum {
+    RTP_PCAP_TX = 0x01,
+    RTP_PCAP_RX = 0x02,
+} rtp_pcap_direction_t;
+
+typedef enum {
+    RTP_PCAP_SINK_RING, // records are kept in a memory ring, oldest overwritten, read out with rtp_pcap_dump()
+    RTP_PCAP_SINK_STREAM, // records are written out by a background task, e.g. to a file or CDC
+} rtp_pcap_sink_t;
+
+/**
+ * @brief Write pcap data to a sink, e.g. fwrite() to a file on the FAT volume or a CDC write
+ */
+typedef void (*rtp_pcap_write_cb_t)(const void* data, size_t len, void* user_ctx);
+
+typedef struct {
+    rtp_pcap_sink_t sink;
+    size_t ring_size; // bytes, RTP_PCAP_SINK_RING; RTP_PCAP_SINK_STREAM buffer, 0 for RTP_PCAP_STREAM_BUFFER_DEFAULT
+    rtp_pcap_write_cb_t write; // RTP_PCAP_SINK_STREAM, called from the writer task
+    void* user_ctx; // passed to write
+    uint32_t task_priority; // RTP_PCAP_SINK_STREAM writer task, below the RTP tasks
+    uint32_t snaplen; // bytes kept per packet, including the IPv4 and UDP header, 0 for all
+    uint32_t session_mask; // bit n captures session n, bit RTP_PCAP_SESSION_FANOUT fan-out sessions
+    uint8_t directions; // rtp_pcap_direction_t flags
+} rtp_pcap_config_t;
+
+typedef struct {
+    uint32_t captured; // packets captured
+    uint32_t overwritten; // packets dropped from the ring to make room
+    uint32_t dropped; // packets not captured because the stream writer fell behind
+    uint32_t bytes; // record bytes captured, including headers
+} rtp_pcap_stats_t;
+
+/**
+ * @brief Start capturing. For a stream sink the pcap file header is written right away,
+ *        and a writer task is started that writes the records out, away from the RTP tasks.
+ *
+ * @param cfg capture configuration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_pcap_start(const rtp_pcap_config_t* cfg);
+
+/**
+ * @brief Stop capturing and free the ring. The records buffered for a stream sink are written out first.
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_pcap_stop(void);
+
+/**
+ * @brief Capture a packet if capture is on and the session and direction pass the filter.
+ *        Called by the sender, fan-out and receiver, and can be called for packets sent by the application.
+ *
+ * @param session identifier, RTP_PCAP_SESSION_FANOUT for fan-out sessions
+ * @param direction RTP_PCAP_TX or RTP_PCAP_RX
+ * @param packet RTP packet
+ * @param len packet length in bytes
+ * @param peer destination of sent or source of received packets, NULL if unknown
+ */
+void rtp_pcap_capture(uint8_t session, rtp_pcap_direction_t direction, const void* packet, size_t len,
+                      const struct sockaddr_in* peer);
+
+/**
+ * @brief Same as rtp_pcap_capture() for a packet in pieces, e.g. header and payload from rtp_create_iovec()
+ *
+ * @param session identifier, RTP_PCAP_SESSION_FANOUT for fan-out sessions
+ * @param direction RTP_PCAP_TX or RTP_PCAP_RX
+ * @param iov packet pieces
+ * @param iovcnt number of pieces
+ * @param peer destination of sent or source of received packets, NULL if unknown
+ */
+void rtp_pcap_capture_iovec(uint8_t session, rtp_pcap_direction_t direction, const struct iovec* iov, int iovcnt,
+                            const struct sockaddr_in* peer);
+
+/**
+ * @brief Write the pcap file header and all records in the ring to a sink, and empty the ring.
+ *        Capture waits while the ring is written out.
+ *
+ * @param write sink
+ * @param user_ctx passed to write
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_STATE if not capturing to a ring
+ */
+esp_err_t rtp_pcap_dump(rtp_pcap_write_cb_t write, void* user_ctx);
+
+/**
+ * @brief Sink writing to a FILE*, pass the FILE* as user_ctx. Works on the FAT volume and on a Linux host.
+ */
+void rtp_pcap_file_write(const void* data, size_t len, void* user_ctx);
+
+/**
+ * @brief Get capture statistics
+ *
+ * @param stats statistics
+ */
+void rtp_pcap_get_stats(rtp_pcap_stats_t* stats);
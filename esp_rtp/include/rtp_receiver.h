@@ -0,0 +1,141 @@
+/**
+ * @file rtp_receiver.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief RTP receive side: header parsing, sequence tracking, reordering and RFC 3550 statistics
+ * @version 0.1
+ * @date 2024-03-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "rtp.h"
+
+#define RTP_REORDER_WINDOW 8 // packets held while waiting for a missing sequence number
+#define RTP_MAX_DROPOUT 3000 // RFC 3550 A.1
+#define RTP_MAX_MISORDER 100 // RFC 3550 A.1
+#define RTP_SEQ_MOD (1 << 16)
+
+/**
+ * @brief Parsed RTP packet. All pointers point into the received buffer, nothing is copied.
+ */
+typedef struct {
+    rtp_header_t header; // host byte order
+    const uint8_t* csrc; // header.csrc_count big endian CSRC identifiers
+    uint16_t ext_profile; // header extension profile, e.g. RTP_EXT_PROFILE_ONE_BYTE
+    const uint8_t* ext; // header extension data, NULL if none
+    size_t ext_length; // header extension data length in bytes
+    const uint8_t* payload;
+    size_t payload_length; // excluding padding
+    const void* buf; // buffer passed to rtp_receive
+    size_t len;
+    int64_t arrival_us;
+} rtp_packet_t;
+
+/**
+ * @brief Called for every packet delivered in sequence order.
+ *        After the callback returns the receiver no longer references `packet->buf`.
+ */
+typedef void (*rtp_packet_cb_t)(uint8_t session, const rtp_packet_t* packet, void* user_ctx);
+
+typedef struct {
+    uint32_t clock_rate; // RTP timestamp rate in Hz, used for jitter
+    rtp_packet_cb_t on_packet;
+    void* user_ctx;
+} rtp_receiver_config_t;
+
+typedef struct {
+    uint32_t ssrc;
+    uint32_t extended_max_seq; // highest sequence number received, with wrap count in the upper 16 bits
+    uint32_t received; // packets received, including duplicates (RFC 3550 A.3)
+    int32_t lost; // cumulative packets lost, may be negative with duplicates
+    uint8_t fraction_lost; // fraction lost since the previous call, 8 bit fixed point
+    uint32_t jitter; // interarrival jitter in timestamp units (RFC 3550 A.8)
+    uint32_t reordered; // packets that arrived out of order and were delivered in order
+    uint32_t duplicates; // packets dropped because they were already held or delivered
+    uint32_t late; // packets dropped because their sequence number was already skipped
+    uint32_t skipped; // sequence numbers given up on when the reorder window moved on
+    uint32_t invalid; // malformed packets, wrong SSRC or bad sequence numbers
+} rtp_receiver_stats_t;
+
+/**
+ * @brief Parse an RTP packet without copying it.
+ *
+ * @param buf received packet
+ * @param len packet length in bytes
+ * @param packet parsed packet, pointing into `buf`
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE if truncated, ESP_ERR_INVALID_VERSION if not RTP version 2
+ */
+esp_err_t rtp_parse(const void* buf, size_t len, rtp_packet_t* packet);
+
+/**
+ * @brief Find an RFC 8285 header extension element in a parsed packet.
+ *
+ * @param packet parsed packet
+ * @param id extension element id
+ * @param data set to the element data, pointing into the packet
+ * @param length set to the element data length
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if the packet does not carry the element
+ */
+esp_err_t rtp_packet_get_extension(const rtp_packet_t* packet, uint8_t id, const uint8_t** data, size_t* length);
+
+/**
+ * @brief Initialize the receive side of an initialized session. Resets sequence state and statistics.
+ *
+ * @param session identifier
+ * @param cfg receiver configuration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_receiver_init(uint8_t session, const rtp_receiver_config_t* cfg);
+
+/**
+ * @brief Receive a packet. Packets are delivered through `on_packet` in sequence order, either
+ *        right away or when the missing packets in front of them arrive or are given up on.
+ *        On ESP_OK the receiver may hold on to `buf` until it has been delivered,
+ *        so the buffer must stay valid until then. On any error `buf` is not referenced.
+ *
+ * @param session identifier
+ * @param buf received packet
+ * @param len packet length in bytes
+ * @return esp_err_t ESP_OK if accepted, ESP_ERR_INVALID_STATE if dropped as duplicate, late or from another source,
+ *                   ESP_ERR_INVALID_SIZE / ESP_ERR_INVALID_VERSION if malformed
+ */
+esp_err_t rtp_receive(uint8_t session, const void* buf, size_t len);
+
+/**
+ * @brief Same as rtp_receive() with an explicit arrival time, e.g. when replaying a recorded trace.
+ *
+ * @param session identifier
+ * @param buf received packet
+ * @param len packet length in bytes
+ * @param arrival_us arrival time [us]
+ * @return esp_err_t see rtp_receive()
+ */
+esp_err_t rtp_receive_at(uint8_t session, const void* buf, size_t len, int64_t arrival_us);
+
+/**
+ * @brief Deliver all held packets in order, giving up on the missing ones in between.
+ *
+ * @param session identifier
+ */
+void rtp_receiver_flush(uint8_t session);
+
+/**
+ * @brief Check, without logging, whether the receiver is initialized and has received a packet,
+ *        e.g. before asking for statistics on a session that may be send-only.
+ *
+ * @param session identifier
+ * @return true if statistics are available
+ */
+bool rtp_receiver_is_active(uint8_t session);
+
+/**
+ * @brief Get receive statistics. `fraction_lost` covers the interval since the previous call,
+ *        as reported in RTCP receiver reports.
+ *
+ * @param session identifier
+ * @param stats statistics
+ * @return esp_err_t ESP_OK on success, ESP_FAIL if no packet has been received
+ */
+esp_err_t rtp_receiver_get_stats(uint8_t session, rtp_receiver_stats_t* stats);
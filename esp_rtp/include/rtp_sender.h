@@ -0,0 +1,106 @@
+/**
+ * @file rtp_sender.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Paced RTP sender task owning the UDP socket of a session
+ * @version 0.1
+ * @date 2024-03-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "rtp.h"
+#include "rtp_srtp.h"
+
+#include "lwip/sockets.h"
+
+#define RTP_SENDER_BATCH_MAX 8 // packets submitted per batch
+#define RTP_SENDER_PACING_SLACK_US 500 // packets due within this time are sent right away
+#define RTP_SENDER_RESYNC_US 1000000 // re-anchor pacing when a packet is this far off schedule
+
+typedef struct {
+    struct sockaddr_in destination;
+    uint16_t local_port; // 0 for any
+    uint32_t clock_rate; // RTP timestamp rate in Hz, used for pacing
+    uint32_t queue_len; // packets, power of 2
+    size_t payload_size_max; // largest payload queued
+    uint8_t max_burst; // packets sent back to back, at most RTP_SENDER_BATCH_MAX
+    uint32_t task_priority;
+    int task_core;
+    rtp_srtp_t* srtp; // protects every packet when set, NULL to send plain RTP
+} rtp_sender_config_t;
+
+typedef struct {
+    uint32_t sent; // packets sent
+    uint32_t bytes; // bytes sent, including headers
+    uint32_t dropped; // packets not queued because the queue was full
+    uint32_t send_errors;
+    uint32_t late; // packets sent more than RTP_SENDER_PACING_SLACK_US after their due time
+    uint32_t batches; // socket submissions
+    uint32_t latency_min_us; // time from queueing to sending
+    uint32_t latency_max_us;
+    uint32_t latency_avg_us;
+} rtp_sender_stats_t;
+
+/**
+ * @brief Start the sender of an initialized session: opens and owns a UDP socket and starts the sender task
+ *
+ * @param session identifier
+ * @param cfg sender configuration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_sender_start(uint8_t session, const rtp_sender_config_t* cfg);
+
+/**
+ * @brief Stop the sender task, drop queued packets and close the socket
+ *
+ * @param session identifier
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_sender_stop(uint8_t session);
+
+/**
+ * @brief Get a queue slot to write the next payload into, without copying it afterwards.
+ *        Must be followed by rtp_sender_commit(). Only one task may queue packets per session.
+ *
+ * @param session identifier
+ * @return uint8_t* payload buffer of `payload_size_max` bytes, NULL if the queue is full
+ */
+uint8_t* rtp_sender_acquire(uint8_t session);
+
+/**
+ * @brief Build the RTP packet around the payload written to the acquired slot and queue it for sending
+ *
+ * @param session identifier
+ * @param payload_length payload length in bytes
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_STATE if the queue is full, i.e. no slot was acquired
+ */
+esp_err_t rtp_sender_commit(uint8_t session, size_t payload_length);
+
+/**
+ * @brief Copy a payload into the queue, build the RTP packet and queue it for sending
+ *
+ * @param session identifier
+ * @param payload buffer with payload
+ * @param payload_length length in bytes
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if the queue is full
+ */
+esp_err_t rtp_sender_send(uint8_t session, const void* payload, size_t payload_length);
+
+/**
+ * @brief Get the socket owned by the sender, e.g. to receive RTCP on it
+ *
+ * @param session identifier
+ * @return int socket, -1 if the sender is not started
+ */
+int rtp_sender_get_socket(uint8_t session);
+
+/**
+ * @brief Get send statistics
+ *
+ * @param session identifier
+ * @param stats statistics
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_sender_get_stats(uint8_t session, rtp_sender_stats_t* stats);
@@ -0,0 +1,92 @@
+/**
+ * @file rtp_srtp.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief SRTP (RFC 3711, RFC 7714) packet protection on top of mbedTLS, using the AES/SHA accelerators
+ * @version 0.1
+ * @date 2024-04-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+
+#include "rtp.h"
+
+#include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
+#include "mbedtls/md.h"
+
+#define RTP_SRTP_MASTER_KEY_SIZE 16
+#define RTP_SRTP_MASTER_SALT_SIZE 14 // AES-CM, AEAD-GCM uses 12
+#define RTP_SRTP_GCM_MASTER_SALT_SIZE 12
+#define RTP_SRTP_AUTH_KEY_SIZE 20
+#define RTP_SRTP_HMAC_TAG_SIZE 10 // HMAC-SHA1-80
+#define RTP_SRTP_GCM_TAG_SIZE 16
+#define RTP_SRTP_TRAILER_MAX 16 // bytes added to a packet by protection
+#define RTP_SRTP_REPLAY_WINDOW 64 // packets
+
+typedef enum {
+    RTP_SRTP_AES128_CM_HMAC_SHA1_80, // RFC 3711
+    RTP_SRTP_AEAD_AES_128_GCM, // RFC 7714
+} rtp_srtp_profile_t;
+
+/**
+ * @brief Protection state of one stream in one direction: one context protects our stream,
+ *        another unprotects the peer's stream.
+ */
+typedef struct {
+    rtp_srtp_profile_t profile;
+    mbedtls_aes_context aes; // AES-CM session key
+    mbedtls_gcm_context gcm; // AEAD session key
+    mbedtls_md_context_t hmac; // HMAC-SHA1 keyed with the session auth key
+    uint8_t salt[RTP_SRTP_MASTER_SALT_SIZE]; // session salt
+    bool started;
+    uint32_t roc; // rollover counter
+    uint16_t s_l; // highest sequence number protected or authenticated
+    uint64_t replay_window; // bit n set when index s_l - n has been received
+    uint32_t auth_failures;
+    uint32_t replayed;
+} rtp_srtp_t;
+
+/**
+ * @brief Derive the session keys from the master key and salt (key derivation rate 0)
+ *
+ * @param srtp context
+ * @param profile protection profile
+ * @param master_key RTP_SRTP_MASTER_KEY_SIZE bytes
+ * @param master_salt RTP_SRTP_MASTER_SALT_SIZE bytes, RTP_SRTP_GCM_MASTER_SALT_SIZE for AEAD-GCM
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t rtp_srtp_init(rtp_srtp_t* srtp, rtp_srtp_profile_t profile, const uint8_t* master_key, const uint8_t* master_salt);
+
+/**
+ * @brief Free the cipher contexts
+ *
+ * @param srtp context
+ */
+void rtp_srtp_deinit(rtp_srtp_t* srtp);
+
+/**
+ * @brief Protect an RTP packet in place: encrypt the payload and append the authentication tag
+ *
+ * @param srtp context
+ * @param packet RTP packet, e.g. from rtp_create_packet()
+ * @param len packet length in bytes
+ * @param size buffer size, at least `len` + RTP_SRTP_TRAILER_MAX
+ * @return size_t SRTP packet length in bytes, 0 on error
+ */
+size_t rtp_srtp_protect(rtp_srtp_t* srtp, void* packet, size_t len, size_t size);
+
+/**
+ * @brief Authenticate and decrypt an SRTP packet in place, e.g. before rtp_receive()
+ *
+ * @param srtp context
+ * @param packet SRTP packet
+ * @param len packet length in bytes
+ * @param rtp_len set to the RTP packet length without the authentication tag
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_MAC if authentication fails,
+ *         ESP_ERR_INVALID_STATE if replayed or too old, ESP_ERR_INVALID_SIZE if truncated
+ */
+esp_err_t rtp_srtp_unprotect(rtp_srtp_t* srtp, void* packet, size_t len, size_t* rtp_len);
@@ -0,0 +1,39 @@
+/**
+ * @file rtp_private.h
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief Internal session access shared between the esp_rtp source files
+ * @version 0.1
+ * @date 2024-03-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#pragma once
+
+#include "rtp.h"
+
+/**
+ * @brief Get an initialized session
+ *
+ * @param session identifier
+ * @return rtp_session_t* session, NULL if out of range or inactive
+ */
+rtp_session_t* rtp_get_active_session(uint8_t session);
+
+/**
+ * @brief Reset a session to its initial state: random SSRC, sequence number and timestamp, no extensions
+ *
+ * @param s session
+ * @param payload_type RTP payload type
+ */
+void rtp_session_setup(rtp_session_t* s, uint8_t payload_type);
+
+/**
+ * @brief Advance the session to the next packet and write its header
+ *
+ * @param s session
+ * @param header buffer of at least `s->header_size` bytes
+ * @param payload_length payload length of the packet, counted for RTCP
+ * @return size_t header length in bytes
+ */
+size_t rtp_session_write_next_header(rtp_session_t* s, void* header, size_t payload_length);
@@ -0,0 +1,331 @@
+/**
+ * @file rtcp.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtcp.h"
+#include "rtp_private.h"
+#include "rtp_receiver.h"
+
+#include <string.h>
+#include <sys/time.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#define RTCP_HEADER_SIZE 4
+#define RTCP_SR_SIZE 28 // header, SSRC and sender info
+#define RTCP_RR_SIZE 8 // header and SSRC
+#define RTCP_REPORT_BLOCK_SIZE 24
+
+static const char* TAG = "RTCP";
+
+typedef struct {
+    rtcp_config_t cfg;
+    bool initialized;
+    uint32_t last_packet_count; // packets sent at the previous report
+
+    // Last sender report received from the peer
+    bool sr_valid;
+    uint64_t sr_ntp;
+    uint32_t sr_rtp;
+    int64_t sr_arrival_us;
+
+    bool feedback_valid;
+    rtcp_feedback_t feedback;
+    char peer_cname[RTCP_CNAME_MAX + 1];
+} rtcp_state_t;
+
+static rtcp_state_t rtcp_states[RTP_SESSION_MAX];
+
+static void put16(uint8_t* p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+static void put32(uint8_t* p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static uint16_t get16(const uint8_t* p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static rtcp_state_t* rtcp_get_state(uint8_t session)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return NULL;
+    }
+
+    if (!rtcp_states[session].initialized) {
+        ESP_LOGE(TAG, "RTCP %d not initialized", session);
+        return NULL;
+    }
+
+    return &rtcp_states[session];
+}
+
+uint64_t rtcp_ntp_now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    uint64_t frac = ((uint64_t)tv.tv_usec << 32) / 1000000;
+    return ((uint64_t)(tv.tv_sec + RTCP_NTP_UNIX_OFFSET) << 32) | frac;
+}
+
+esp_err_t rtcp_init(uint8_t session, const rtcp_config_t* cfg)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (cfg->clock_rate == 0 || cfg->cname == NULL || strlen(cfg->cname) > RTCP_CNAME_MAX) {
+        ESP_LOGE(TAG, "Invalid RTCP configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(&rtcp_states[session], 0, sizeof(rtcp_state_t));
+    rtcp_states[session].cfg = *cfg;
+    rtcp_states[session].initialized = true;
+    ESP_LOGI(TAG, "RTCP %d initialized.", session);
+
+    return ESP_OK;
+}
+
+static size_t rtcp_write_report_block(uint8_t session, rtcp_state_t* r, uint8_t* p)
+{
+    rtp_receiver_stats_t stats;
+    if (!rtp_receiver_is_active(session) || rtp_receiver_get_stats(session, &stats) != ESP_OK) {
+        return 0;
+    }
+
+    uint32_t lsr = 0;
+    uint32_t dlsr = 0;
+    if (r->sr_valid) {
+        lsr = (uint32_t)(r->sr_ntp >> 16);
+        dlsr = (uint32_t)(((esp_timer_get_time() - r->sr_arrival_us) << 16) / 1000000);
+    }
+
+    put32(&p[0], stats.ssrc);
+    put32(&p[4], ((uint32_t)stats.fraction_lost << 24) | ((uint32_t)stats.lost & 0xffffff));
+    put32(&p[8], stats.extended_max_seq);
+    put32(&p[12], stats.jitter);
+    put32(&p[16], lsr);
+    put32(&p[20], dlsr);
+    return RTCP_REPORT_BLOCK_SIZE;
+}
+
+size_t rtcp_create_report(uint8_t session, void* output, size_t size)
+{
+    rtcp_state_t* r = rtcp_get_state(session);
+    if (r == NULL) {
+        return 0;
+    }
+    rtp_session_t* s = rtp_get_active_session(session);
+    uint8_t* p = output;
+
+    bool sender = s->packet_count != r->last_packet_count;
+    size_t report_size = sender ? RTCP_SR_SIZE : RTCP_RR_SIZE;
+    size_t cname_length = strlen(r->cfg.cname);
+    size_t sdes_size = (RTCP_HEADER_SIZE + 4 + 2 + cname_length + 1 + 3) & ~3; // chunk ends with a null item, padded
+    if (size < report_size + RTCP_REPORT_BLOCK_SIZE + sdes_size) {
+        ESP_LOGE(TAG, "Output buffer too small to hold RTCP packet");
+        return 0;
+    }
+
+    put32(&p[4], s->header.ssrc);
+    if (sender) {
+        // Sample wallclock and media clock at the same instant, extrapolating from the last packet
+        uint64_t ntp = rtcp_ntp_now();
+        int64_t elapsed_us = esp_timer_get_time() - s->last_packet_us;
+        uint32_t rtp_timestamp = s->header.timestamp + (uint32_t)((elapsed_us * r->cfg.clock_rate) / 1000000);
+        put32(&p[8], ntp >> 32);
+        put32(&p[12], ntp);
+        put32(&p[16], rtp_timestamp);
+        put32(&p[20], s->packet_count);
+        put32(&p[24], s->octet_count);
+        r->last_packet_count = s->packet_count;
+    }
+
+    size_t block_size = rtcp_write_report_block(session, r, &p[report_size]);
+    uint8_t report_count = block_size ? 1 : 0;
+    size_t length = report_size + block_size;
+    p[0] = 0x80 | report_count;
+    p[1] = sender ? RTCP_PT_SR : RTCP_PT_RR;
+    put16(&p[2], length / 4 - 1);
+
+    // SDES with one chunk holding the CNAME
+    uint8_t* sdes = &p[length];
+    memset(sdes, 0, sdes_size);
+    sdes[0] = 0x80 | 1;
+    sdes[1] = RTCP_PT_SDES;
+    put16(&sdes[2], sdes_size / 4 - 1);
+    put32(&sdes[4], s->header.ssrc);
+    sdes[8] = RTCP_SDES_CNAME;
+    sdes[9] = cname_length;
+    memcpy(&sdes[10], r->cfg.cname, cname_length);
+
+    return length + sdes_size;
+}
+
+static void rtcp_parse_report_blocks(uint8_t session, rtcp_state_t* r, const uint8_t* p, uint8_t count, uint32_t reporter)
+{
+    rtp_session_t* s = rtp_get_active_session(session);
+
+    for (int i = 0; i < count; i++, p += RTCP_REPORT_BLOCK_SIZE) {
+        if (get32(p) != s->header.ssrc) {
+            continue; // report about another source
+        }
+
+        int32_t lost = get32(&p[4]) & 0xffffff;
+        if (lost & 0x800000) {
+            lost |= ~0xffffff; // sign extend 24 bit
+        }
+        uint32_t lsr = get32(&p[16]);
+        uint32_t dlsr = get32(&p[20]);
+
+        r->feedback = (rtcp_feedback_t) {
+            .ssrc = reporter,
+            .fraction_lost = p[4],
+            .lost = lost,
+            .extended_max_seq = get32(&p[8]),
+            .jitter = get32(&p[12]),
+            .rtt_valid = false,
+            .rtt_us = 0,
+        };
+
+        if (lsr != 0) {
+            // RFC 3550 6.4.1: RTT = A - LSR - DLSR, in 1/65536 seconds
+            uint32_t a = (uint32_t)(rtcp_ntp_now() >> 16);
+            int32_t rtt = (int32_t)(a - lsr - dlsr);
+            r->feedback.rtt_valid = true;
+            r->feedback.rtt_us = rtt > 0 ? (uint32_t)(((int64_t)rtt * 1000000) >> 16) : 0;
+        }
+        r->feedback_valid = true;
+
+        if (r->cfg.on_feedback) {
+            r->cfg.on_feedback(session, &r->feedback, r->cfg.user_ctx);
+        }
+    }
+}
+
+static void rtcp_parse_sdes(rtcp_state_t* r, const uint8_t* p, size_t len)
+{
+    // First chunk only: SSRC followed by items
+    size_t i = 4;
+    while (i + 2 <= len && p[i] != 0) {
+        uint8_t type = p[i];
+        uint8_t length = p[i + 1];
+        if (i + 2 + length > len) {
+            return;
+        }
+        if (type == RTCP_SDES_CNAME) {
+            size_t n = length < RTCP_CNAME_MAX ? length : RTCP_CNAME_MAX;
+            memcpy(r->peer_cname, &p[i + 2], n);
+            r->peer_cname[n] = '\0';
+        }
+        i += 2 + length;
+    }
+}
+
+esp_err_t rtcp_receive(uint8_t session, const void* buf, size_t len)
+{
+    rtcp_state_t* r = rtcp_get_state(session);
+    if (r == NULL) {
+        return ESP_FAIL;
+    }
+
+    const uint8_t* p = buf;
+    while (len >= RTCP_HEADER_SIZE) {
+        if ((p[0] >> 6) != 2) {
+            return ESP_ERR_INVALID_VERSION;
+        }
+        uint8_t count = p[0] & 0x1f;
+        uint8_t type = p[1];
+        size_t length = 4 * (get16(&p[2]) + 1);
+        if (length > len) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        switch (type) {
+        case RTCP_PT_SR:
+            if (length < RTCP_SR_SIZE + count * RTCP_REPORT_BLOCK_SIZE) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            r->sr_ntp = ((uint64_t)get32(&p[8]) << 32) | get32(&p[12]);
+            r->sr_rtp = get32(&p[16]);
+            r->sr_arrival_us = esp_timer_get_time();
+            r->sr_valid = true;
+            rtcp_parse_report_blocks(session, r, &p[RTCP_SR_SIZE], count, get32(&p[4]));
+            break;
+        case RTCP_PT_RR:
+            if (length < RTCP_RR_SIZE + count * RTCP_REPORT_BLOCK_SIZE) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            rtcp_parse_report_blocks(session, r, &p[RTCP_RR_SIZE], count, get32(&p[4]));
+            break;
+        case RTCP_PT_SDES:
+            if (count > 0) {
+                rtcp_parse_sdes(r, &p[RTCP_HEADER_SIZE], length - RTCP_HEADER_SIZE);
+            }
+            break;
+        default:
+            break; // BYE, APP and others are ignored
+        }
+
+        p += length;
+        len -= length;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t rtcp_get_feedback(uint8_t session, rtcp_feedback_t* feedback)
+{
+    rtcp_state_t* r = rtcp_get_state(session);
+    if (r == NULL || !r->feedback_valid) {
+        return ESP_FAIL;
+    }
+
+    *feedback = r->feedback;
+    return ESP_OK;
+}
+
+esp_err_t rtcp_rtp_to_ntp(uint8_t session, uint32_t rtp_timestamp, uint64_t* ntp_timestamp)
+{
+    rtcp_state_t* r = rtcp_get_state(session);
+    if (r == NULL || !r->sr_valid) {
+        return ESP_FAIL;
+    }
+
+    int64_t delta = (int32_t)(rtp_timestamp - r->sr_rtp);
+    *ntp_timestamp = r->sr_ntp + ((delta * (1LL << 32)) / (int64_t)r->cfg.clock_rate);
+    return ESP_OK;
+}
+
+const char* rtcp_get_peer_cname(uint8_t session)
+{
+    rtcp_state_t* r = rtcp_get_state(session);
+    if (r == NULL) {
+        return "";
+    }
+
+    return r->peer_cname;
+}
@@ -9,7 +9,9 @@
  *
  */
 #include "rtp.h"
+#include "rtp_private.h"
 
+#include <stdbool.h>
 #include <string.h>
 
 #include "esp_err.h"
@@ -22,20 +24,81 @@ static const char* TAG = "RTP";
 
 static rtp_session_t active_sessions[RTP_SESSION_MAX];
 
-esp_err_t rtp_session_init(uint8_t session, uint8_t payload_type)
+/**
+ * @brief Serialize the constant part of the header, and the header extension block if any,
+ *        into the session header template. Extension data already set is kept.
+ */
+static void rtp_build_template(rtp_session_t* s)
 {
-    if (session > RTP_SESSION_MAX) {
-        ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
-        return ESP_FAIL;
-    }
+    uint8_t t[RTP_HEADER_MAX_SIZE] = { 0 };
+    rtp_header_t header = s->header;
 
-    if (active_sessions[session].state != RTP_STATE_INACTIVE) {
-        ESP_LOGE(TAG, "Session already initialized");
-        return ESP_FAIL;
+    header.extension = (s->num_extensions > 0);
+    t[0] = (header.version << 6) | (header.padding << 5) | (header.extension << 4) | header.csrc_count;
+    t[1] = (header.marker << 7) | header.payload_type;
+    t[8] = header.ssrc >> 24;
+    t[9] = header.ssrc >> 16;
+    t[10] = header.ssrc >> 8;
+    t[11] = header.ssrc;
+    size_t size = RTP_HEADER_SIZE;
+
+    if (header.extension) {
+        // RFC 8285: use the one-byte form when every element fits, else the two-byte form
+        bool one_byte = true;
+        for (int i = 0; i < s->num_extensions; i++) {
+            if (s->extensions[i].id > 14 || s->extensions[i].length == 0 || s->extensions[i].length > 16) {
+                one_byte = false;
+            }
+        }
+        uint16_t profile = one_byte ? RTP_EXT_PROFILE_ONE_BYTE : RTP_EXT_PROFILE_TWO_BYTE;
+        size_t offset = RTP_HEADER_SIZE + 4;
+        for (int i = 0; i < s->num_extensions; i++) {
+            rtp_extension_t* ext = &s->extensions[i];
+            if (one_byte) {
+                t[offset++] = (ext->id << 4) | (ext->length - 1);
+            } else {
+                t[offset++] = ext->id;
+                t[offset++] = ext->length;
+            }
+            if (ext->offset != 0) {
+                memcpy(&t[offset], &s->header_template[ext->offset], ext->length);
+            }
+            ext->offset = offset;
+            offset += ext->length;
+        }
+        size_t words = (offset - RTP_HEADER_SIZE - 4 + 3) / 4;
+        t[RTP_HEADER_SIZE] = profile >> 8;
+        t[RTP_HEADER_SIZE + 1] = profile;
+        t[RTP_HEADER_SIZE + 2] = words >> 8;
+        t[RTP_HEADER_SIZE + 3] = words;
+        size = RTP_HEADER_SIZE + 4 + words * 4; // zero padded
     }
 
+    s->header.extension = header.extension;
+    memcpy(s->header_template, t, size);
+    s->header_size = size;
+}
+
+/**
+ * @brief Copy the header template and patch marker, sequence number and timestamp.
+ */
+static size_t rtp_write_header(const rtp_session_t* s, rtp_header_t header, uint8_t* rtp_packet)
+{
+    memcpy(rtp_packet, s->header_template, s->header_size);
+    rtp_packet[1] = (header.marker << 7) | header.payload_type;
+    rtp_packet[2] = header.sequence_number >> 8;
+    rtp_packet[3] = header.sequence_number;
+    rtp_packet[4] = header.timestamp >> 24;
+    rtp_packet[5] = header.timestamp >> 16;
+    rtp_packet[6] = header.timestamp >> 8;
+    rtp_packet[7] = header.timestamp;
+    return s->header_size;
+}
+
+void rtp_session_setup(rtp_session_t* s, uint8_t payload_type)
+{
     // Initialize RTP header
-    active_sessions[session].header = (rtp_header_t) {
+    s->header = (rtp_header_t) {
         .version = 2,
         .padding = 0,
         .extension = 0,
@@ -47,8 +110,31 @@ esp_err_t rtp_session_init(uint8_t session, uint8_t payload_type)
         .ssrc = esp_random()
     };
 
-    active_sessions[session].state = RTP_STATE_INITIALIZED;
-    active_sessions[session].esp_timestamp = esp_timer_get_time();
+    s->num_extensions = 0;
+    memset(s->extensions, 0, sizeof(s->extensions));
+    rtp_build_template(s);
+
+    s->last_packet_us = 0;
+    s->packet_count = 0;
+    s->octet_count = 0;
+
+    s->state = RTP_STATE_INITIALIZED;
+    s->esp_timestamp = esp_timer_get_time();
+}
+
+esp_err_t rtp_session_init(uint8_t session, uint8_t payload_type)
+{
+    if (session >= RTP_SESSION_MAX) {
+        ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
+        return ESP_FAIL;
+    }
+
+    if (active_sessions[session].state != RTP_STATE_INACTIVE) {
+        ESP_LOGE(TAG, "Session already initialized");
+        return ESP_FAIL;
+    }
+
+    rtp_session_setup(&active_sessions[session], payload_type);
     ESP_LOGI(TAG, "RTP session %d initialized.", session);
 
     return ESP_OK;
@@ -56,7 +142,7 @@ esp_err_t rtp_session_init(uint8_t session, uint8_t payload_type)
 
 esp_err_t rtp_session_deinit(uint8_t session)
 {
-    if (session > RTP_SESSION_MAX) {
+    if (session >= RTP_SESSION_MAX) {
         ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
         return ESP_FAIL;
     }
@@ -72,7 +158,7 @@ void rtp_session_set_timestamp_inc(uint8_t session, size_t timestamp_inc)
 
 rtp_state_t rtp_session_get_state(uint8_t session)
 {
-    if (session > RTP_SESSION_MAX) {
+    if (session >= RTP_SESSION_MAX) {
         ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
         return ESP_FAIL;
     }
@@ -80,62 +166,196 @@ rtp_state_t rtp_session_get_state(uint8_t session)
     return active_sessions[session].state;
 }
 
-static size_t rtp_serialize(rtp_header_t header, uint8_t* payload, size_t payload_length, uint8_t* rtp_packet)
+rtp_session_t* rtp_get_active_session(uint8_t session)
 {
-    size_t total_length = 0;
-    if (payload_length == 0) {
-        return total_length;
+    if (session >= RTP_SESSION_MAX) {
+        ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
+        return NULL;
     }
 
-    // Convert RTP header to Big Endian
-    uint16_t* buffer = (uint16_t*)rtp_packet;
-    buffer[0] = (header.version << 14) | (0 << 13) | (header.extension << 12) | (header.csrc_count << 8) | (header.marker << 7) | (header.payload_type);
-    buffer[1] = header.sequence_number;
-    buffer[2] = header.timestamp >> 16;
-    buffer[3] = header.timestamp;
-    buffer[4] = header.ssrc >> 16;
-    buffer[5] = header.ssrc;
-
-    for (int i = 0; i < (RTP_HEADER_SIZE >> 1); i++) {
-        buffer[i] = htons(buffer[i]);
+    if (active_sessions[session].state == RTP_STATE_INACTIVE) {
+        ESP_LOGE(TAG, "RTP session %d inactive", session);
+        return NULL;
     }
 
-    // TODO: remove above code and use this instead:
-    // *(rtp_header_t*)rtp_packet = header;
-    // (requires fiddling around with endian swapping afterwards)
+    return &active_sessions[session];
+}
+
+/**
+ * @brief Advance sequence number and timestamp and return the header for the next packet.
+ *        The marker is cleared for the following packets after the first one.
+ *        Packet and payload octet counts and the creation time are kept for RTCP sender reports.
+ */
+static rtp_header_t rtp_next_header(rtp_session_t* s, size_t payload_length)
+{
+    s->header.sequence_number++;
+    s->header.timestamp += s->timestamp_inc;
+    s->packet_count++;
+    s->octet_count += payload_length;
+    s->last_packet_us = esp_timer_get_time();
 
-    // Add payload
-    uint8_t* destination = rtp_packet + RTP_HEADER_SIZE;
-    memcpy(destination, payload, payload_length);
+    rtp_header_t header = s->header;
+    if (s->header.marker == 1u) { // Change the market to 0 after building the first packet.
+        s->header.marker = 0;
+    }
+    return header;
+}
 
-    total_length = RTP_HEADER_SIZE + payload_length;
-    return total_length;
+size_t rtp_session_write_next_header(rtp_session_t* s, void* header, size_t payload_length)
+{
+    return rtp_write_header(s, rtp_next_header(s, payload_length), header);
 }
 
 size_t rtp_create_packet(uint8_t session, void* payload, size_t payload_length, void* output, size_t size)
 {
-    if (session > RTP_SESSION_MAX) {
-        ESP_LOGE(TAG, "Session above RTP_SESSION_MAX");
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
         return 0;
     }
 
-    if (size < (RTP_HEADER_SIZE + payload_length)) {
+    if (size < (s->header_size + payload_length)) {
         ESP_LOGE(TAG, "Output buffer too small to hold RTP packet");
         return 0;
     }
 
-    if (active_sessions[session].state == RTP_STATE_INACTIVE) {
-        ESP_LOGE(TAG, "RTP session %d inactive", session);
+    if (payload_length == 0) {
         return 0;
     }
 
-    active_sessions[session].header.sequence_number++;
-    active_sessions[session].header.timestamp += active_sessions[session].timestamp_inc;
+    size_t header_length = rtp_write_header(s, rtp_next_header(s, payload_length), output);
+    memcpy((uint8_t*)output + header_length, payload, payload_length);
 
-    size_t output_size = rtp_serialize(active_sessions[session].header, payload, payload_length, output);
-    if (active_sessions[session].header.marker == 1u) { // Change the market to 0 after building the first packet.
-        active_sessions[session].header.marker = 0;
+    return header_length + payload_length;
+}
+
+size_t rtp_create_packet_inplace(uint8_t session, void* packet, size_t payload_length, size_t size)
+{
+    if (payload_length == 0) {
+        return 0;
     }
 
-    return output_size;
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return 0;
+    }
+
+    if (size < (s->header_size + payload_length)) {
+        ESP_LOGE(TAG, "Buffer too small to hold RTP packet");
+        return 0;
+    }
+
+    return rtp_write_header(s, rtp_next_header(s, payload_length), packet) + payload_length;
+}
+
+size_t rtp_create_header(uint8_t session, void* header, size_t size)
+{
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return 0;
+    }
+
+    if (size < s->header_size) {
+        ESP_LOGE(TAG, "Buffer too small to hold RTP header");
+        return 0;
+    }
+
+    return rtp_write_header(s, rtp_next_header(s, 0), header);
+}
+
+size_t rtp_create_iovec(uint8_t session, void* header, void* payload, size_t payload_length, struct iovec iov[2])
+{
+    if (payload_length == 0) {
+        return 0;
+    }
+
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return 0;
+    }
+
+    size_t header_length = rtp_write_header(s, rtp_next_header(s, payload_length), header);
+
+    iov[0].iov_base = header;
+    iov[0].iov_len = header_length;
+    iov[1].iov_base = payload;
+    iov[1].iov_len = payload_length;
+    return header_length + payload_length;
+}
+
+size_t rtp_session_get_header_size(uint8_t session)
+{
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return 0;
+    }
+
+    return s->header_size;
+}
+
+esp_err_t rtp_session_add_extension(uint8_t session, uint8_t id, uint8_t length)
+{
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (id == 0 || id == 15 || length == 0) {
+        ESP_LOGE(TAG, "Invalid extension id %d or length %d", id, length);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t block = 0;
+    for (int i = 0; i < s->num_extensions; i++) {
+        if (s->extensions[i].id == id) {
+            ESP_LOGE(TAG, "Extension id %d already added", id);
+            return ESP_ERR_INVALID_ARG;
+        }
+        block += 2 + s->extensions[i].length;
+    }
+
+    if (s->num_extensions >= RTP_EXTENSION_MAX || block + 2 + length > RTP_EXTENSION_BLOCK_MAX) {
+        ESP_LOGE(TAG, "No room for extension id %d", id);
+        return ESP_ERR_NO_MEM;
+    }
+
+    s->extensions[s->num_extensions] = (rtp_extension_t) {
+        .id = id,
+        .length = length,
+        .offset = 0
+    };
+    s->num_extensions++;
+    rtp_build_template(s);
+
+    return ESP_OK;
+}
+
+esp_err_t rtp_session_set_extension(uint8_t session, uint8_t id, const void* data, uint8_t length)
+{
+    rtp_session_t* s = rtp_get_active_session(session);
+    if (s == NULL) {
+        return ESP_FAIL;
+    }
+
+    for (int i = 0; i < s->num_extensions; i++) {
+        if (s->extensions[i].id == id) {
+            if (length != s->extensions[i].length) {
+                ESP_LOGE(TAG, "Extension id %d has length %d", id, s->extensions[i].length);
+                return ESP_ERR_INVALID_SIZE;
+            }
+            memcpy(&s->header_template[s->extensions[i].offset], data, length);
+            return ESP_OK;
+        }
+    }
+
+    ESP_LOGE(TAG, "Extension id %d not added", id);
+    return ESP_ERR_NOT_FOUND;
 }
+
+esp_err_t rtp_session_set_abs_capture_time(uint8_t session, uint8_t id, uint64_t ntp_timestamp)
+{
+    uint8_t data[RTP_EXT_ABS_CAPTURE_TIME_SIZE];
+    for (int i = 0; i < RTP_EXT_ABS_CAPTURE_TIME_SIZE; i++) {
+        data[i] = ntp_timestamp >> (56 - 8 * i);
+    }
+    return rtp_session_set_extension(session, id, data, sizeof(data));
+}
\ No newline at end of file
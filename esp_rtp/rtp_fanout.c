@@ -0,0 +1,243 @@
+/**
+ * @file rtp_fanout.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-30
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtp_fanout.h"
+#include "rtp_pcap.h"
+#include "rtp_private.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lwip/sockets.h"
+
+static const char* TAG = "RTP-FANOUT";
+
+typedef struct {
+    struct sockaddr_in addr;
+    rtp_fanout_dest_stats_t stats;
+} rtp_fanout_dest_t;
+
+struct rtp_fanout {
+    rtp_fanout_config_t cfg;
+    rtp_session_t session;
+    int sock;
+    SemaphoreHandle_t lock; // guards the destination list
+    rtp_fanout_dest_t* dests;
+    size_t num_dests;
+    size_t capacity;
+};
+
+static bool rtp_fanout_addr_equal(const struct sockaddr_in* a, const struct sockaddr_in* b)
+{
+    return a->sin_addr.s_addr == b->sin_addr.s_addr && a->sin_port == b->sin_port;
+}
+
+static rtp_fanout_dest_t* rtp_fanout_find(rtp_fanout_handle_t f, const struct sockaddr_in* destination)
+{
+    for (size_t i = 0; i < f->num_dests; i++) {
+        if (rtp_fanout_addr_equal(&f->dests[i].addr, destination)) {
+            return &f->dests[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t rtp_fanout_create(const rtp_fanout_config_t* cfg, rtp_fanout_handle_t* handle)
+{
+    rtp_fanout_handle_t f = calloc(1, sizeof(struct rtp_fanout));
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate session");
+        return ESP_ERR_NO_MEM;
+    }
+    f->cfg = *cfg;
+    rtp_session_setup(&f->session, cfg->payload_type);
+    f->session.timestamp_inc = cfg->timestamp_inc;
+
+    f->lock = xSemaphoreCreateMutex();
+    f->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (f->lock == NULL || f->sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket");
+        rtp_fanout_delete(f);
+        return ESP_FAIL;
+    }
+
+    struct sockaddr_in local = {
+        .sin_family = AF_INET,
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+        .sin_port = htons(cfg->local_port),
+    };
+    if (bind(f->sock, (struct sockaddr*)&local, sizeof(local)) != 0) {
+        ESP_LOGE(TAG, "Failed to bind socket: errno %d", errno);
+        rtp_fanout_delete(f);
+        return ESP_FAIL;
+    }
+
+    uint8_t loop = cfg->multicast_loop;
+    setsockopt(f->sock, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+    if (cfg->multicast_ttl != 0) {
+        uint8_t ttl = cfg->multicast_ttl;
+        setsockopt(f->sock, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    }
+
+    *handle = f;
+    ESP_LOGI(TAG, "RTP fan-out session %08" PRIx32 " created.", f->session.header.ssrc);
+    return ESP_OK;
+}
+
+esp_err_t rtp_fanout_delete(rtp_fanout_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (handle->sock >= 0) {
+        closesocket(handle->sock);
+    }
+    if (handle->lock != NULL) {
+        vSemaphoreDelete(handle->lock);
+    }
+    free(handle->dests);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t rtp_fanout_add_destination(rtp_fanout_handle_t handle, const struct sockaddr_in* destination)
+{
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    if (rtp_fanout_find(handle, destination) != NULL) {
+        err = ESP_ERR_INVALID_STATE;
+    } else {
+        if (handle->num_dests == handle->capacity) {
+            size_t capacity = handle->capacity ? 2 * handle->capacity : 4;
+            rtp_fanout_dest_t* dests = realloc(handle->dests, capacity * sizeof(rtp_fanout_dest_t));
+            if (dests == NULL) {
+                err = ESP_ERR_NO_MEM;
+            } else {
+                handle->dests = dests;
+                handle->capacity = capacity;
+            }
+        }
+        if (err == ESP_OK) {
+            handle->dests[handle->num_dests++] = (rtp_fanout_dest_t) {
+                .addr = *destination,
+            };
+        }
+    }
+    xSemaphoreGive(handle->lock);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add destination %s:%d", inet_ntoa(destination->sin_addr), ntohs(destination->sin_port));
+    }
+    return err;
+}
+
+esp_err_t rtp_fanout_remove_destination(rtp_fanout_handle_t handle, const struct sockaddr_in* destination)
+{
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    rtp_fanout_dest_t* dest = rtp_fanout_find(handle, destination);
+    if (dest != NULL) {
+        *dest = handle->dests[--handle->num_dests]; // order does not matter
+        err = ESP_OK;
+    }
+    xSemaphoreGive(handle->lock);
+
+    return err;
+}
+
+esp_err_t rtp_fanout_send(rtp_fanout_handle_t handle, const void* payload, size_t payload_length)
+{
+    if (payload_length == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t header[RTP_HEADER_MAX_SIZE];
+    struct iovec iov[2] = {
+        { .iov_base = header },
+        { .iov_base = (void*)payload, .iov_len = payload_length },
+    };
+    struct msghdr msg = {
+        .msg_namelen = sizeof(struct sockaddr_in),
+        .msg_iov = iov,
+        .msg_iovlen = 2,
+    };
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    iov[0].iov_len = rtp_session_write_next_header(&handle->session, header, payload_length);
+    size_t len = iov[0].iov_len + payload_length;
+
+    for (size_t i = 0; i < handle->num_dests; i++) {
+        rtp_fanout_dest_t* dest = &handle->dests[i];
+        msg.msg_name = &dest->addr;
+        if (sendmsg(handle->sock, &msg, 0) == (ssize_t)len) {
+            dest->stats.sent++;
+            dest->stats.bytes += len;
+        } else {
+            dest->stats.errors++;
+            dest->stats.last_errno = errno;
+            err = ESP_FAIL;
+        }
+    }
+
+    // The destination list may change once unlocked
+    bool has_dest = handle->num_dests > 0;
+    struct sockaddr_in first_dest;
+    if (has_dest) {
+        first_dest = handle->dests[0].addr;
+    }
+    xSemaphoreGive(handle->lock);
+
+    // Captured once, not per destination
+    rtp_pcap_capture_iovec(RTP_PCAP_SESSION_FANOUT, RTP_PCAP_TX, iov, 2, has_dest ? &first_dest : NULL);
+
+    return err;
+}
+
+rtp_session_t* rtp_fanout_get_session(rtp_fanout_handle_t handle)
+{
+    return &handle->session;
+}
+
+size_t rtp_fanout_get_num_destinations(rtp_fanout_handle_t handle)
+{
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    size_t num_dests = handle->num_dests;
+    xSemaphoreGive(handle->lock);
+
+    return num_dests;
+}
+
+esp_err_t rtp_fanout_get_destination_stats(rtp_fanout_handle_t handle, const struct sockaddr_in* destination,
+                                           rtp_fanout_dest_stats_t* stats)
+{
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+
+    xSemaphoreTake(handle->lock, portMAX_DELAY);
+    rtp_fanout_dest_t* dest = rtp_fanout_find(handle, destination);
+    if (dest != NULL) {
+        *stats = dest->stats;
+        err = ESP_OK;
+    }
+    xSemaphoreGive(handle->lock);
+
+    return err;
+}
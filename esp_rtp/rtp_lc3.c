@@ -0,0 +1,239 @@
+/**
+ * @file rtp_lc3.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtp_lc3.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+static const char* TAG = "RTP LC3";
+
+size_t rtp_lc3_payload_size(const rtp_lc3_config_t* cfg)
+{
+    size_t size = (size_t)cfg->frames_per_packet * cfg->frame_bytes;
+    if (cfg->redundancy > 0) {
+        size += RTP_RED_HEADER_SIZE + RTP_RED_PRIMARY_HEADER_SIZE + (size_t)cfg->redundancy * cfg->frame_bytes;
+    }
+    return size;
+}
+
+static esp_err_t rtp_lc3_check_config(const rtp_lc3_config_t* cfg)
+{
+    if (cfg->frame_bytes == 0 || cfg->frame_samples == 0 || cfg->frames_per_packet == 0) {
+        ESP_LOGE(TAG, "Invalid LC3 payload configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (cfg->redundancy > 0 && ((size_t)cfg->redundancy * cfg->frame_bytes > RTP_RED_BLOCK_LENGTH_MAX
+                                   || (uint32_t)cfg->redundancy * cfg->frame_samples > RTP_RED_TIMESTAMP_OFFSET_MAX)) {
+        ESP_LOGE(TAG, "Redundant block does not fit RFC 2198 header");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t rtp_lc3_packer_init(rtp_lc3_packer_t* packer, const rtp_lc3_config_t* cfg)
+{
+    esp_err_t err = rtp_lc3_check_config(cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    memset(packer, 0, sizeof(rtp_lc3_packer_t));
+    packer->cfg = *cfg;
+    packer->frames = malloc((size_t)(cfg->redundancy + cfg->frames_per_packet) * cfg->frame_bytes);
+    if (packer->frames == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate frames");
+        return ESP_ERR_NO_MEM;
+    }
+
+    return ESP_OK;
+}
+
+void rtp_lc3_packer_deinit(rtp_lc3_packer_t* packer)
+{
+    free(packer->frames);
+    packer->frames = NULL;
+}
+
+uint8_t* rtp_lc3_packer_next_frame(rtp_lc3_packer_t* packer)
+{
+    return packer->frames + (size_t)(packer->cfg.redundancy + packer->num_pending) * packer->cfg.frame_bytes;
+}
+
+size_t rtp_lc3_packer_push(rtp_lc3_packer_t* packer, void* output, size_t size)
+{
+    const rtp_lc3_config_t* cfg = &packer->cfg;
+
+    if (++packer->num_pending < cfg->frames_per_packet) {
+        return 0;
+    }
+    packer->num_pending = 0;
+
+    if (size < rtp_lc3_payload_size(cfg)) {
+        ESP_LOGE(TAG, "Output buffer too small to hold LC3 payload");
+        return 0;
+    }
+
+    uint8_t* p = output;
+    size_t primary_length = (size_t)cfg->frames_per_packet * cfg->frame_bytes;
+    const uint8_t* primary = packer->frames + (size_t)cfg->redundancy * cfg->frame_bytes;
+    if (cfg->redundancy == 0) {
+        memcpy(p, primary, primary_length);
+        return primary_length;
+    }
+
+    // RFC 2198: block headers, then the blocks in the same order
+    size_t length = 0;
+    if (packer->num_history > 0) {
+        uint16_t offset = packer->num_history * cfg->frame_samples;
+        uint16_t block_length = packer->num_history * cfg->frame_bytes;
+        p[0] = 0x80 | cfg->payload_type;
+        p[1] = offset >> 6;
+        p[2] = (offset << 2) | (block_length >> 8);
+        p[3] = block_length;
+        length += RTP_RED_HEADER_SIZE;
+    }
+    p[length++] = cfg->payload_type;
+
+    // History is the newest `redundancy` frames in front of the primary frames
+    size_t history_length = (size_t)packer->num_history * cfg->frame_bytes;
+    memcpy(&p[length], primary - history_length, history_length + primary_length);
+    length += history_length + primary_length;
+
+    // Keep the newest frames as history for the next packet
+    memmove(packer->frames, packer->frames + primary_length, (size_t)cfg->redundancy * cfg->frame_bytes);
+    packer->num_history = packer->num_history + cfg->frames_per_packet < cfg->redundancy
+        ? packer->num_history + cfg->frames_per_packet
+        : cfg->redundancy;
+
+    return length;
+}
+
+esp_err_t rtp_lc3_depacketizer_init(rtp_lc3_depacketizer_t* depacketizer, const rtp_lc3_config_t* cfg,
+                                    rtp_lc3_frame_cb_t on_frame, void* user_ctx)
+{
+    esp_err_t err = rtp_lc3_check_config(cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    memset(depacketizer, 0, sizeof(rtp_lc3_depacketizer_t));
+    depacketizer->cfg = *cfg;
+    depacketizer->on_frame = on_frame;
+    depacketizer->user_ctx = user_ctx;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Deliver the frames of a block starting at `timestamp`, skipping frames already delivered
+ *        and reporting frames missing in front of it as lost
+ */
+static void rtp_lc3_deliver(rtp_lc3_depacketizer_t* d, const uint8_t* frames, size_t num_frames, uint32_t timestamp,
+                            rtp_lc3_frame_status_t status)
+{
+    const rtp_lc3_config_t* cfg = &d->cfg;
+
+    if (!d->started) {
+        d->started = true;
+        d->next_timestamp = timestamp;
+    }
+
+    // Frames are only delivered on the frame grid of the stream: a misaligned redundant block
+    // is dropped, a misaligned primary block restarts the stream as a jump does
+    int32_t gap = (int32_t)(timestamp - d->next_timestamp);
+    if (gap % cfg->frame_samples != 0 && status == RTP_LC3_FRAME_RECOVERED) {
+        d->stats.invalid++;
+        return;
+    }
+    if (gap % cfg->frame_samples != 0 || gap > RTP_LC3_RESYNC_FRAMES * cfg->frame_samples) {
+        ESP_LOGW(TAG, "Timestamp jump, restarting stream");
+        d->next_timestamp = timestamp;
+    }
+
+    for (size_t i = 0; i < num_frames; i++, timestamp += cfg->frame_samples) {
+        if ((int32_t)(timestamp - d->next_timestamp) < 0) {
+            continue; // already delivered
+        }
+
+        while ((int32_t)(timestamp - d->next_timestamp) > 0) {
+            d->stats.lost++;
+            d->on_frame(NULL, d->next_timestamp, RTP_LC3_FRAME_LOST, d->user_ctx);
+            d->next_timestamp += cfg->frame_samples;
+        }
+
+        if (status == RTP_LC3_FRAME_RECOVERED) {
+            d->stats.recovered++;
+        } else {
+            d->stats.frames++;
+        }
+        d->on_frame(&frames[i * cfg->frame_bytes], timestamp, status, d->user_ctx);
+        d->next_timestamp += cfg->frame_samples;
+    }
+}
+
+esp_err_t rtp_lc3_unpack(rtp_lc3_depacketizer_t* depacketizer, const rtp_packet_t* packet)
+{
+    const rtp_lc3_config_t* cfg = &depacketizer->cfg;
+    const uint8_t* p = packet->payload;
+    size_t len = packet->payload_length;
+
+    if (cfg->redundancy == 0 || packet->header.payload_type != cfg->red_payload_type) {
+        if (len == 0 || len % cfg->frame_bytes != 0) {
+            depacketizer->stats.invalid++;
+            return ESP_ERR_INVALID_SIZE;
+        }
+        rtp_lc3_deliver(depacketizer, p, len / cfg->frame_bytes, packet->header.timestamp, RTP_LC3_FRAME_PRIMARY);
+        return ESP_OK;
+    }
+
+    // Walk the block headers first, blocks follow in the same order
+    size_t header_length = 0;
+    size_t data_length = 0;
+    while (header_length < len && (p[header_length] & 0x80)) {
+        if (header_length + RTP_RED_HEADER_SIZE > len) {
+            depacketizer->stats.invalid++;
+            return ESP_ERR_INVALID_SIZE;
+        }
+        data_length += ((p[header_length + 2] & 0x03) << 8) | p[header_length + 3];
+        header_length += RTP_RED_HEADER_SIZE;
+    }
+    header_length += RTP_RED_PRIMARY_HEADER_SIZE;
+    if (header_length + data_length > len) {
+        depacketizer->stats.invalid++;
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    const uint8_t* block = &p[header_length];
+    for (const uint8_t* h = p; h < &p[header_length - RTP_RED_PRIMARY_HEADER_SIZE]; h += RTP_RED_HEADER_SIZE) {
+        uint16_t offset = (h[1] << 6) | (h[2] >> 2);
+        uint16_t block_length = ((h[2] & 0x03) << 8) | h[3];
+        // Redundancy only fills gaps, a stream starts at the first primary frame
+        if (depacketizer->started && (h[0] & 0x7f) == cfg->payload_type && block_length % cfg->frame_bytes == 0) {
+            rtp_lc3_deliver(depacketizer, block, block_length / cfg->frame_bytes, packet->header.timestamp - offset,
+                            RTP_LC3_FRAME_RECOVERED);
+        }
+        block += block_length;
+    }
+
+    size_t primary_length = len - header_length - data_length;
+    if (primary_length == 0 || primary_length % cfg->frame_bytes != 0) {
+        depacketizer->stats.invalid++;
+        return ESP_ERR_INVALID_SIZE;
+    }
+    rtp_lc3_deliver(depacketizer, block, primary_length / cfg->frame_bytes, packet->header.timestamp, RTP_LC3_FRAME_PRIMARY);
+
+    return ESP_OK;
+}
@@ -0,0 +1,361 @@
+/**
+ * @file rtp_pcap.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtp_pcap.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define RTP_PCAP_MAGIC 0xa1b2c3d4
+#define RTP_PCAP_SNAPLEN_MAX 65535
+#define RTP_PCAP_WRITER_STACK_SIZE 4096
+
+static const char* TAG = "RTP-PCAP";
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+} rtp_pcap_file_header_t;
+
+typedef struct {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+} rtp_pcap_record_header_t;
+
+static rtp_pcap_config_t pcap_cfg;
+static volatile bool capturing;
+static SemaphoreHandle_t pcap_lock;
+static rtp_pcap_stats_t pcap_stats;
+
+// Ring of records, oldest at tail. A stream sink empties it from the writer task.
+static uint8_t* ring;
+static size_t ring_head;
+static size_t ring_tail;
+static size_t ring_used;
+static TaskHandle_t writer_task;
+
+static void rtp_pcap_ring_put(const void* data, size_t len)
+{
+    const uint8_t* p = data;
+    size_t n = pcap_cfg.ring_size - ring_head < len ? pcap_cfg.ring_size - ring_head : len;
+    memcpy(&ring[ring_head], p, n);
+    memcpy(ring, p + n, len - n);
+    ring_head = (ring_head + len) % pcap_cfg.ring_size;
+    ring_used += len;
+}
+
+static void rtp_pcap_ring_peek(void* data, size_t len)
+{
+    uint8_t* p = data;
+    size_t n = pcap_cfg.ring_size - ring_tail < len ? pcap_cfg.ring_size - ring_tail : len;
+    memcpy(p, &ring[ring_tail], n);
+    memcpy(p + n, ring, len - n);
+}
+
+static void rtp_pcap_ring_pop_record(void)
+{
+    rtp_pcap_record_header_t header;
+    rtp_pcap_ring_peek(&header, sizeof(header));
+    size_t len = sizeof(header) + header.incl_len;
+    ring_tail = (ring_tail + len) % pcap_cfg.ring_size;
+    ring_used -= len;
+}
+
+static void rtp_pcap_file_header(rtp_pcap_write_cb_t write, void* user_ctx)
+{
+    const rtp_pcap_file_header_t header = {
+        .magic = RTP_PCAP_MAGIC,
+        .version_major = 2,
+        .version_minor = 4,
+        .snaplen = pcap_cfg.snaplen,
+        .linktype = RTP_PCAP_LINKTYPE_IPV4,
+    };
+    write(&header, sizeof(header), user_ctx);
+}
+
+/**
+ * @brief Stream sink: write the ring out in the background, so storage latency never blocks RTP I/O.
+ *        The ring is written in place, capture only appends to the free space behind it.
+ */
+static void rtp_pcap_writer_task(void* arg)
+{
+    bool running = true;
+    while (running) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (;;) {
+            xSemaphoreTake(pcap_lock, portMAX_DELAY);
+            running = capturing;
+            size_t tail = ring_tail;
+            size_t n = pcap_cfg.ring_size - tail < ring_used ? pcap_cfg.ring_size - tail : ring_used;
+            xSemaphoreGive(pcap_lock);
+            if (n == 0) {
+                break;
+            }
+
+            pcap_cfg.write(&ring[tail], n, pcap_cfg.user_ctx);
+
+            xSemaphoreTake(pcap_lock, portMAX_DELAY);
+            ring_tail = (tail + n) % pcap_cfg.ring_size;
+            ring_used -= n;
+            xSemaphoreGive(pcap_lock);
+        }
+    }
+
+    writer_task = NULL;
+    vTaskDelete(NULL);
+}
+
+esp_err_t rtp_pcap_start(const rtp_pcap_config_t* cfg)
+{
+    if (capturing) {
+        ESP_LOGE(TAG, "Capture already running");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if ((cfg->sink == RTP_PCAP_SINK_RING && cfg->ring_size == 0) || (cfg->sink == RTP_PCAP_SINK_STREAM && cfg->write == NULL)) {
+        ESP_LOGE(TAG, "Invalid capture configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (pcap_lock == NULL) {
+        pcap_lock = xSemaphoreCreateMutex();
+        if (pcap_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    pcap_cfg = *cfg;
+    if (pcap_cfg.snaplen == 0 || pcap_cfg.snaplen > RTP_PCAP_SNAPLEN_MAX) {
+        pcap_cfg.snaplen = RTP_PCAP_SNAPLEN_MAX;
+    }
+    if (pcap_cfg.snaplen < RTP_PCAP_IP_UDP_HEADER_SIZE + RTP_HEADER_SIZE) {
+        pcap_cfg.snaplen = RTP_PCAP_IP_UDP_HEADER_SIZE + RTP_HEADER_SIZE;
+    }
+    if (pcap_cfg.ring_size == 0) {
+        pcap_cfg.ring_size = RTP_PCAP_STREAM_BUFFER_DEFAULT;
+    }
+    memset(&pcap_stats, 0, sizeof(pcap_stats));
+
+    ring = malloc(pcap_cfg.ring_size);
+    if (ring == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate capture ring");
+        return ESP_ERR_NO_MEM;
+    }
+    ring_head = 0;
+    ring_tail = 0;
+    ring_used = 0;
+
+    capturing = true;
+    if (cfg->sink == RTP_PCAP_SINK_STREAM) {
+        rtp_pcap_file_header(cfg->write, cfg->user_ctx);
+        if (xTaskCreate(rtp_pcap_writer_task, "rtp_pcap", RTP_PCAP_WRITER_STACK_SIZE, NULL, cfg->task_priority, &writer_task) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create writer task");
+            capturing = false;
+            free(ring);
+            ring = NULL;
+            return ESP_FAIL;
+        }
+    }
+
+    ESP_LOGI(TAG, "Capture started, snaplen %" PRIu32, pcap_cfg.snaplen);
+    return ESP_OK;
+}
+
+esp_err_t rtp_pcap_stop(void)
+{
+    if (!capturing) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(pcap_lock, portMAX_DELAY);
+    capturing = false;
+    xSemaphoreGive(pcap_lock);
+
+    // The writer task writes out what is left before it exits
+    while (writer_task != NULL) {
+        xTaskNotifyGive(writer_task);
+        vTaskDelay(1);
+    }
+
+    xSemaphoreTake(pcap_lock, portMAX_DELAY);
+    free(ring);
+    ring = NULL;
+    xSemaphoreGive(pcap_lock);
+
+    ESP_LOGI(TAG, "Capture stopped, %" PRIu32 " packets", pcap_stats.captured);
+    return ESP_OK;
+}
+
+/**
+ * @brief IPv4 and UDP header in front of the RTP packet, so the capture opens as RTP over UDP
+ */
+static void rtp_pcap_ip_udp_header(uint8_t* p, rtp_pcap_direction_t direction, size_t len, const struct sockaddr_in* peer)
+{
+    uint32_t local_addr = 0;
+    uint16_t local_port = htons(RTP_PCAP_DEFAULT_PORT);
+    uint32_t peer_addr = peer ? peer->sin_addr.s_addr : 0;
+    uint16_t peer_port = peer ? peer->sin_port : htons(RTP_PCAP_DEFAULT_PORT);
+    uint32_t src = direction == RTP_PCAP_TX ? local_addr : peer_addr;
+    uint32_t dst = direction == RTP_PCAP_TX ? peer_addr : local_addr;
+    uint16_t sport = direction == RTP_PCAP_TX ? local_port : peer_port;
+    uint16_t dport = direction == RTP_PCAP_TX ? peer_port : local_port;
+    uint16_t total = RTP_PCAP_IP_UDP_HEADER_SIZE + len;
+
+    memset(p, 0, RTP_PCAP_IP_UDP_HEADER_SIZE);
+    p[0] = 0x45;
+    p[2] = total >> 8;
+    p[3] = total;
+    p[6] = 0x40; // don't fragment
+    p[8] = 64; // TTL
+    p[9] = IPPROTO_UDP;
+    memcpy(&p[12], &src, 4); // network byte order already
+    memcpy(&p[16], &dst, 4);
+
+    uint32_t sum = 0;
+    for (int i = 0; i < 20; i += 2) {
+        sum += (p[i] << 8) | p[i + 1];
+    }
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = ~((sum & 0xffff) + (sum >> 16));
+    p[10] = sum >> 8;
+    p[11] = sum;
+
+    memcpy(&p[20], &sport, 2);
+    memcpy(&p[22], &dport, 2);
+    p[24] = (total - 20) >> 8;
+    p[25] = total - 20;
+}
+
+void rtp_pcap_capture(uint8_t session, rtp_pcap_direction_t direction, const void* packet, size_t len,
+                      const struct sockaddr_in* peer)
+{
+    const struct iovec iov = {
+        .iov_base = (void*)packet,
+        .iov_len = len,
+    };
+    rtp_pcap_capture_iovec(session, direction, &iov, 1, peer);
+}
+
+void rtp_pcap_capture_iovec(uint8_t session, rtp_pcap_direction_t direction, const struct iovec* iov, int iovcnt,
+                            const struct sockaddr_in* peer)
+{
+    if (!capturing || session > RTP_PCAP_SESSION_FANOUT || !(pcap_cfg.session_mask & (1u << session))
+        || !(pcap_cfg.directions & direction)) {
+        return;
+    }
+
+    size_t len = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        len += iov[i].iov_len;
+    }
+
+    uint8_t headers[RTP_PCAP_RECORD_HEADER_SIZE + RTP_PCAP_IP_UDP_HEADER_SIZE];
+    size_t orig_len = RTP_PCAP_IP_UDP_HEADER_SIZE + len;
+    size_t incl_len = orig_len < pcap_cfg.snaplen ? orig_len : pcap_cfg.snaplen;
+    size_t data_len = incl_len - RTP_PCAP_IP_UDP_HEADER_SIZE;
+
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    const rtp_pcap_record_header_t record = {
+        .ts_sec = tv.tv_sec,
+        .ts_usec = tv.tv_usec,
+        .incl_len = incl_len,
+        .orig_len = orig_len,
+    };
+    memcpy(headers, &record, sizeof(record));
+    rtp_pcap_ip_udp_header(&headers[RTP_PCAP_RECORD_HEADER_SIZE], direction, len, peer);
+
+    xSemaphoreTake(pcap_lock, portMAX_DELAY);
+    if (!capturing) {
+        xSemaphoreGive(pcap_lock);
+        return;
+    }
+
+    size_t record_len = RTP_PCAP_RECORD_HEADER_SIZE + incl_len;
+    if (pcap_cfg.sink == RTP_PCAP_SINK_RING) {
+        if (record_len > pcap_cfg.ring_size) {
+            pcap_stats.overwritten++;
+            xSemaphoreGive(pcap_lock);
+            return;
+        }
+        while (pcap_cfg.ring_size - ring_used < record_len) {
+            rtp_pcap_ring_pop_record();
+            pcap_stats.overwritten++;
+        }
+    } else if (pcap_cfg.ring_size - ring_used < record_len) {
+        // The writer task fell behind, records being written out are kept
+        pcap_stats.dropped++;
+        xSemaphoreGive(pcap_lock);
+        return;
+    }
+    rtp_pcap_ring_put(headers, sizeof(headers));
+
+    // Packet data up to the snap length
+    for (int i = 0; i < iovcnt && data_len > 0; i++) {
+        size_t n = iov[i].iov_len < data_len ? iov[i].iov_len : data_len;
+        rtp_pcap_ring_put(iov[i].iov_base, n);
+        data_len -= n;
+    }
+    pcap_stats.captured++;
+    pcap_stats.bytes += record_len;
+    if (pcap_cfg.sink == RTP_PCAP_SINK_STREAM) {
+        xTaskNotifyGive(writer_task);
+    }
+    xSemaphoreGive(pcap_lock);
+}
+
+esp_err_t rtp_pcap_dump(rtp_pcap_write_cb_t write, void* user_ctx)
+{
+    if (!capturing || pcap_cfg.sink != RTP_PCAP_SINK_RING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Capture waits while the ring is written out
+    xSemaphoreTake(pcap_lock, portMAX_DELAY);
+    rtp_pcap_file_header(write, user_ctx);
+    size_t n = pcap_cfg.ring_size - ring_tail < ring_used ? pcap_cfg.ring_size - ring_tail : ring_used;
+    write(&ring[ring_tail], n, user_ctx);
+    if (ring_used > n) {
+        write(ring, ring_used - n, user_ctx);
+    }
+    ring_head = 0;
+    ring_tail = 0;
+    ring_used = 0;
+    xSemaphoreGive(pcap_lock);
+
+    return ESP_OK;
+}
+
+void rtp_pcap_file_write(const void* data, size_t len, void* user_ctx)
+{
+    fwrite(data, 1, len, (FILE*)user_ctx);
+}
+
+void rtp_pcap_get_stats(rtp_pcap_stats_t* stats)
+{
+    *stats = pcap_stats;
+}
@@ -0,0 +1,458 @@
+/**
+ * @file rtp_receiver.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtp_receiver.h"
+#include "rtp_pcap.h"
+#include "rtp_private.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char* TAG = "RTP-RX";
+
+typedef enum {
+    RTP_SEQ_OK,
+    RTP_SEQ_BAD,
+    RTP_SEQ_RESTART
+} rtp_seq_result_t;
+
+typedef struct {
+    rtp_receiver_config_t cfg;
+    bool initialized;
+    bool started; // first packet received
+    uint32_t ssrc;
+
+    // RFC 3550 A.1 source state
+    uint16_t max_seq;
+    uint32_t cycles;
+    uint32_t base_seq;
+    uint32_t bad_seq;
+    uint32_t received;
+    uint32_t expected_prior;
+    uint32_t received_prior;
+    int32_t transit;
+    uint32_t jitter; // scaled by 16
+
+    // Reorder window
+    uint16_t next_seq; // next sequence number to deliver
+    uint32_t history; // bit n set if next_seq - 1 - n was delivered, clear if skipped
+    rtp_packet_t window[RTP_REORDER_WINDOW];
+    bool held[RTP_REORDER_WINDOW];
+    uint8_t num_held;
+
+    uint32_t reordered;
+    uint32_t duplicates;
+    uint32_t late;
+    uint32_t skipped;
+    uint32_t invalid;
+} rtp_receiver_t;
+
+static rtp_receiver_t receivers[RTP_SESSION_MAX];
+
+static rtp_receiver_t* rtp_get_receiver(uint8_t session)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return NULL;
+    }
+
+    if (!receivers[session].initialized) {
+        ESP_LOGE(TAG, "RTP receiver %d not initialized", session);
+        return NULL;
+    }
+
+    return &receivers[session];
+}
+
+esp_err_t rtp_parse(const void* buf, size_t len, rtp_packet_t* packet)
+{
+    const uint8_t* p = buf;
+
+    if (len < RTP_HEADER_SIZE) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if ((p[0] >> 6) != 2) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    memset(packet, 0, sizeof(rtp_packet_t));
+    packet->header.version = p[0] >> 6;
+    packet->header.padding = (p[0] >> 5) & 1;
+    packet->header.extension = (p[0] >> 4) & 1;
+    packet->header.csrc_count = p[0] & 0x0f;
+    packet->header.marker = p[1] >> 7;
+    packet->header.payload_type = p[1] & 0x7f;
+    packet->header.sequence_number = (p[2] << 8) | p[3];
+    packet->header.timestamp = ((uint32_t)p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7];
+    packet->header.ssrc = ((uint32_t)p[8] << 24) | (p[9] << 16) | (p[10] << 8) | p[11];
+    packet->buf = buf;
+    packet->len = len;
+
+    size_t offset = RTP_HEADER_SIZE + 4 * packet->header.csrc_count;
+    if (len < offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    packet->csrc = packet->header.csrc_count ? &p[RTP_HEADER_SIZE] : NULL;
+
+    if (packet->header.extension) {
+        if (len < offset + 4) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        packet->ext_profile = (p[offset] << 8) | p[offset + 1];
+        packet->ext_length = 4 * ((p[offset + 2] << 8) | p[offset + 3]);
+        offset += 4;
+        if (len < offset + packet->ext_length) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        packet->ext = &p[offset];
+        offset += packet->ext_length;
+    }
+
+    size_t padding = 0;
+    if (packet->header.padding) {
+        padding = p[len - 1];
+        if (padding == 0 || len < offset + padding) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+
+    packet->payload = &p[offset];
+    packet->payload_length = len - offset - padding;
+
+    return ESP_OK;
+}
+
+esp_err_t rtp_packet_get_extension(const rtp_packet_t* packet, uint8_t id, const uint8_t** data, size_t* length)
+{
+    if (packet->ext == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const uint8_t* p = packet->ext;
+    size_t i = 0;
+
+    if (packet->ext_profile == RTP_EXT_PROFILE_ONE_BYTE) {
+        while (i < packet->ext_length) {
+            if (p[i] == 0) { // padding
+                i++;
+                continue;
+            }
+            uint8_t element_id = p[i] >> 4;
+            size_t element_length = (p[i] & 0x0f) + 1;
+            if (element_id == 15 || i + 1 + element_length > packet->ext_length) {
+                break;
+            }
+            if (element_id == id) {
+                *data = &p[i + 1];
+                *length = element_length;
+                return ESP_OK;
+            }
+            i += 1 + element_length;
+        }
+    } else if ((packet->ext_profile & 0xfff0) == RTP_EXT_PROFILE_TWO_BYTE) {
+        while (i < packet->ext_length) {
+            if (p[i] == 0) { // padding
+                i++;
+                continue;
+            }
+            if (i + 2 > packet->ext_length) {
+                break;
+            }
+            uint8_t element_id = p[i];
+            size_t element_length = p[i + 1];
+            if (i + 2 + element_length > packet->ext_length) {
+                break;
+            }
+            if (element_id == id) {
+                *data = &p[i + 2];
+                *length = element_length;
+                return ESP_OK;
+            }
+            i += 2 + element_length;
+        }
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+static void rtp_init_seq(rtp_receiver_t* r, uint16_t seq)
+{
+    r->base_seq = seq;
+    r->max_seq = seq;
+    r->bad_seq = RTP_SEQ_MOD + 1; // so seq == bad_seq is false
+    r->cycles = 0;
+    r->received = 0;
+    r->received_prior = 0;
+    r->expected_prior = 0;
+}
+
+/**
+ * @brief RFC 3550 A.1 sequence number validation, without the probation period
+ */
+static rtp_seq_result_t rtp_update_seq(rtp_receiver_t* r, uint16_t seq)
+{
+    rtp_seq_result_t result = RTP_SEQ_OK;
+    uint16_t udelta = seq - r->max_seq;
+
+    if (udelta < RTP_MAX_DROPOUT) {
+        // in order, with permissible gap
+        if (seq < r->max_seq) {
+            r->cycles += RTP_SEQ_MOD;
+        }
+        r->max_seq = seq;
+    } else if (udelta <= RTP_SEQ_MOD - RTP_MAX_MISORDER) {
+        // the sequence number made a very large jump
+        if (seq == r->bad_seq) {
+            // two sequential packets, assume the other side restarted without telling us
+            rtp_init_seq(r, seq);
+            result = RTP_SEQ_RESTART;
+        } else {
+            r->bad_seq = (seq + 1) & (RTP_SEQ_MOD - 1);
+            return RTP_SEQ_BAD;
+        }
+    } else {
+        // duplicate or reordered packet
+    }
+    r->received++;
+    return result;
+}
+
+static void rtp_update_jitter(rtp_receiver_t* r, const rtp_packet_t* packet, bool first)
+{
+    if (r->cfg.clock_rate == 0) {
+        return;
+    }
+
+    uint32_t arrival = (uint32_t)((packet->arrival_us * r->cfg.clock_rate) / 1000000);
+    int32_t transit = (int32_t)(arrival - packet->header.timestamp);
+    int32_t d = transit - r->transit;
+    r->transit = transit;
+    if (first) {
+        return;
+    }
+    if (d < 0) {
+        d = -d;
+    }
+    r->jitter += d - ((r->jitter + 8) >> 4);
+}
+
+/**
+ * @brief Deliver or skip `next_seq` and move on to the following sequence number
+ */
+static void rtp_advance(uint8_t session, rtp_receiver_t* r)
+{
+    uint8_t slot = r->next_seq % RTP_REORDER_WINDOW;
+    bool delivered = r->held[slot];
+
+    if (delivered) {
+        r->held[slot] = false;
+        r->num_held--;
+        if (r->cfg.on_packet) {
+            r->cfg.on_packet(session, &r->window[slot], r->cfg.user_ctx);
+        }
+    } else {
+        r->skipped++;
+    }
+
+    r->history = (r->history << 1) | delivered;
+    r->next_seq++;
+}
+
+static void rtp_deliver(uint8_t session, rtp_receiver_t* r, const rtp_packet_t* packet)
+{
+    if (r->cfg.on_packet) {
+        r->cfg.on_packet(session, packet, r->cfg.user_ctx);
+    }
+    r->history = (r->history << 1) | 1;
+    r->next_seq++;
+
+    // Deliver packets held behind this one
+    while (r->num_held > 0 && r->held[r->next_seq % RTP_REORDER_WINDOW]) {
+        rtp_advance(session, r);
+    }
+}
+
+esp_err_t rtp_receiver_init(uint8_t session, const rtp_receiver_config_t* cfg)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return ESP_FAIL;
+    }
+
+    memset(&receivers[session], 0, sizeof(rtp_receiver_t));
+    receivers[session].cfg = *cfg;
+    receivers[session].initialized = true;
+    ESP_LOGI(TAG, "RTP receiver %d initialized.", session);
+
+    return ESP_OK;
+}
+
+esp_err_t rtp_receive(uint8_t session, const void* buf, size_t len)
+{
+    rtp_pcap_capture(session, RTP_PCAP_RX, buf, len, NULL);
+    return rtp_receive_at(session, buf, len, esp_timer_get_time());
+}
+
+esp_err_t rtp_receive_at(uint8_t session, const void* buf, size_t len, int64_t arrival_us)
+{
+    rtp_receiver_t* r = rtp_get_receiver(session);
+    if (r == NULL) {
+        return ESP_FAIL;
+    }
+
+    rtp_packet_t packet;
+    esp_err_t err = rtp_parse(buf, len, &packet);
+    if (err != ESP_OK) {
+        r->invalid++;
+        return err;
+    }
+    packet.arrival_us = arrival_us;
+    uint16_t seq = packet.header.sequence_number;
+
+    if (!r->started) {
+        r->started = true;
+        r->ssrc = packet.header.ssrc;
+        rtp_init_seq(r, seq);
+        r->received = 1;
+        r->next_seq = seq;
+        rtp_update_jitter(r, &packet, true);
+        rtp_deliver(session, r, &packet);
+        return ESP_OK;
+    }
+
+    if (packet.header.ssrc != r->ssrc) {
+        r->invalid++;
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    bool out_of_order = (int16_t)(seq - r->max_seq) < 0;
+
+    switch (rtp_update_seq(r, seq)) {
+    case RTP_SEQ_BAD:
+        r->invalid++;
+        return ESP_ERR_INVALID_STATE;
+    case RTP_SEQ_RESTART:
+        ESP_LOGW(TAG, "RTP receiver %d: sequence restart at %u", session, seq);
+        rtp_receiver_flush(session);
+        r->next_seq = seq;
+        r->history = 0;
+        r->received = 1;
+        rtp_update_jitter(r, &packet, true);
+        rtp_deliver(session, r, &packet);
+        return ESP_OK;
+    default:
+        break;
+    }
+
+    rtp_update_jitter(r, &packet, false);
+
+    int16_t delta = (int16_t)(seq - r->next_seq);
+    if (delta < 0) {
+        // Sequence number already delivered or skipped
+        if (-delta <= 32 && (r->history >> (-delta - 1)) & 1) {
+            r->duplicates++;
+        } else {
+            r->late++;
+        }
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Move the window on until the packet fits, giving up on the missing packets
+    while ((uint16_t)(seq - r->next_seq) >= RTP_REORDER_WINDOW) {
+        if (r->num_held == 0) {
+            uint16_t gap = seq - r->next_seq - (RTP_REORDER_WINDOW - 1);
+            r->skipped += gap;
+            r->history = gap >= 32 ? 0 : r->history << gap;
+            r->next_seq += gap;
+            break;
+        }
+        rtp_advance(session, r);
+    }
+
+    if (out_of_order) {
+        r->reordered++;
+    }
+
+    if (seq == r->next_seq) {
+        rtp_deliver(session, r, &packet);
+        return ESP_OK;
+    }
+
+    uint8_t slot = seq % RTP_REORDER_WINDOW;
+    if (r->held[slot]) {
+        r->duplicates++;
+        return ESP_ERR_INVALID_STATE;
+    }
+    r->window[slot] = packet;
+    r->held[slot] = true;
+    r->num_held++;
+
+    return ESP_OK;
+}
+
+void rtp_receiver_flush(uint8_t session)
+{
+    rtp_receiver_t* r = rtp_get_receiver(session);
+    if (r == NULL) {
+        return;
+    }
+
+    while (r->num_held > 0) {
+        rtp_advance(session, r);
+    }
+}
+
+bool rtp_receiver_is_active(uint8_t session)
+{
+    return session < RTP_SESSION_MAX && receivers[session].initialized && receivers[session].started;
+}
+
+esp_err_t rtp_receiver_get_stats(uint8_t session, rtp_receiver_stats_t* stats)
+{
+    rtp_receiver_t* r = rtp_get_receiver(session);
+    if (r == NULL || !r->started) {
+        return ESP_FAIL;
+    }
+
+    // RFC 3550 A.3
+    uint32_t extended_max = r->cycles + r->max_seq;
+    uint32_t expected = extended_max - r->base_seq + 1;
+    int32_t lost = (int32_t)(expected - r->received);
+    if (lost > 0x7fffff) {
+        lost = 0x7fffff;
+    } else if (lost < -0x800000) {
+        lost = -0x800000;
+    }
+
+    uint32_t expected_interval = expected - r->expected_prior;
+    r->expected_prior = expected;
+    uint32_t received_interval = r->received - r->received_prior;
+    r->received_prior = r->received;
+    int32_t lost_interval = (int32_t)(expected_interval - received_interval);
+
+    *stats = (rtp_receiver_stats_t) {
+        .ssrc = r->ssrc,
+        .extended_max_seq = extended_max,
+        .received = r->received,
+        .lost = lost,
+        .fraction_lost = (expected_interval == 0 || lost_interval <= 0) ? 0 : (lost_interval << 8) / expected_interval,
+        .jitter = r->jitter >> 4,
+        .reordered = r->reordered,
+        .duplicates = r->duplicates,
+        .late = r->late,
+        .skipped = r->skipped,
+        .invalid = r->invalid,
+    };
+
+    return ESP_OK;
+}
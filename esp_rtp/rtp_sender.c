@@ -0,0 +1,440 @@
+/**
+ * @file rtp_sender.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#if defined(__linux__)
+#define _GNU_SOURCE // sendmmsg
+#endif
+
+#include "rtp_sender.h"
+#include "rtp_pcap.h"
+#include "rtp_private.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "lwip/sockets.h"
+
+#define RTP_SENDER_STACK_SIZE 4096
+
+static const char* TAG = "RTP-TX";
+
+typedef struct {
+    uint8_t* data; // RTP_HEADER_MAX_SIZE headroom followed by the payload
+    size_t len; // RTP packet length, starting at data + offset
+    size_t offset; // unused headroom in front of the packet
+    int64_t queued_us;
+} rtp_sender_slot_t;
+
+typedef struct {
+    rtp_sender_config_t cfg;
+    uint8_t session;
+    int sock;
+    uint8_t* pool;
+    rtp_sender_slot_t* slots;
+    uint32_t mask;
+    atomic_uint head; // next slot to queue, written by the producer
+    atomic_uint tail; // next slot to send, written by the sender task
+    TaskHandle_t task;
+    esp_timer_handle_t timer;
+    volatile bool stop;
+
+    // Pacing anchor: send time of the media timestamp anchor_ts
+    bool anchored;
+    int64_t anchor_us;
+    uint32_t anchor_ts;
+
+    rtp_sender_stats_t stats;
+    atomic_uint dropped;
+    uint64_t latency_sum_us;
+} rtp_sender_t;
+
+static rtp_sender_t* senders[RTP_SESSION_MAX];
+
+static rtp_sender_t* rtp_get_sender(uint8_t session)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return NULL;
+    }
+
+    if (senders[session] == NULL) {
+        ESP_LOGE(TAG, "RTP sender %d not started", session);
+        return NULL;
+    }
+
+    return senders[session];
+}
+
+static uint32_t rtp_slot_timestamp(const rtp_sender_slot_t* slot)
+{
+    const uint8_t* p = slot->data + slot->offset;
+    return ((uint32_t)p[4] << 24) | (p[5] << 16) | (p[6] << 8) | p[7];
+}
+
+/**
+ * @brief Time the packet is due, following its media timestamp
+ */
+static int64_t rtp_sender_due_time(rtp_sender_t* s, const rtp_sender_slot_t* slot, int64_t now)
+{
+    uint32_t ts = rtp_slot_timestamp(slot);
+
+    if (s->anchored) {
+        int32_t delta = (int32_t)(ts - s->anchor_ts);
+        int64_t due = s->anchor_us + ((int64_t)delta * 1000000) / s->cfg.clock_rate;
+        if (due - now < RTP_SENDER_RESYNC_US && now - due < RTP_SENDER_RESYNC_US) {
+            return due;
+        }
+        ESP_LOGW(TAG, "RTP sender %d: pacing resync", s->session);
+    }
+
+    s->anchored = true;
+    s->anchor_us = now;
+    s->anchor_ts = ts;
+    return now;
+}
+
+static void rtp_sender_update_stats(rtp_sender_t* s, const rtp_sender_slot_t* slot, int64_t now, bool ok)
+{
+    if (!ok) {
+        s->stats.send_errors++;
+        return;
+    }
+
+    uint32_t latency = (uint32_t)(now - slot->queued_us);
+    if (s->stats.sent == 0 || latency < s->stats.latency_min_us) {
+        s->stats.latency_min_us = latency;
+    }
+    if (latency > s->stats.latency_max_us) {
+        s->stats.latency_max_us = latency;
+    }
+    s->stats.sent++;
+    s->stats.bytes += slot->len;
+    s->latency_sum_us += latency;
+}
+
+/**
+ * @brief Submit a batch of packets to the socket. Uses sendmmsg where available,
+ *        lwIP has no batched send so it falls back to one send per packet.
+ */
+static void rtp_sender_submit(rtp_sender_t* s, rtp_sender_slot_t** batch, int count)
+{
+    int64_t now = esp_timer_get_time();
+    s->stats.batches++;
+
+#if defined(__linux__)
+    struct mmsghdr msgs[RTP_SENDER_BATCH_MAX];
+    struct iovec iov[RTP_SENDER_BATCH_MAX];
+    memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < count; i++) {
+        iov[i].iov_base = batch[i]->data + batch[i]->offset;
+        iov[i].iov_len = batch[i]->len;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int sent = sendmmsg(s->sock, msgs, count, 0);
+    for (int i = 0; i < count; i++) {
+        rtp_sender_update_stats(s, batch[i], now, i < sent);
+        rtp_pcap_capture(s->session, RTP_PCAP_TX, iov[i].iov_base, iov[i].iov_len, &s->cfg.destination);
+    }
+#else
+    for (int i = 0; i < count; i++) {
+        int sent = send(s->sock, batch[i]->data + batch[i]->offset, batch[i]->len, 0);
+        rtp_sender_update_stats(s, batch[i], now, sent == (int)batch[i]->len);
+        rtp_pcap_capture(s->session, RTP_PCAP_TX, batch[i]->data + batch[i]->offset, batch[i]->len, &s->cfg.destination);
+    }
+#endif
+}
+
+/**
+ * @brief Send all packets that are due. Arms the pacing timer for the next one.
+ */
+static void rtp_sender_drain(rtp_sender_t* s)
+{
+    rtp_sender_slot_t* batch[RTP_SENDER_BATCH_MAX];
+    int count = 0;
+    unsigned int tail = atomic_load_explicit(&s->tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&s->head, memory_order_acquire);
+
+    while (tail != head) {
+        rtp_sender_slot_t* slot = &s->slots[tail & s->mask];
+        int64_t now = esp_timer_get_time();
+        int64_t due = rtp_sender_due_time(s, slot, now);
+
+        if (due > now + RTP_SENDER_PACING_SLACK_US) {
+            esp_timer_stop(s->timer);
+            esp_timer_start_once(s->timer, due - now);
+            break;
+        }
+        if (now > due + RTP_SENDER_PACING_SLACK_US) {
+            s->stats.late++;
+        }
+
+        batch[count++] = slot;
+        tail++;
+        if (count == s->cfg.max_burst) {
+            rtp_sender_submit(s, batch, count);
+            atomic_store_explicit(&s->tail, tail, memory_order_release);
+            count = 0;
+        }
+        if (tail == head) {
+            head = atomic_load_explicit(&s->head, memory_order_acquire);
+        }
+    }
+
+    if (count > 0) {
+        rtp_sender_submit(s, batch, count);
+        atomic_store_explicit(&s->tail, tail, memory_order_release);
+    }
+}
+
+static void rtp_sender_timer_cb(void* arg)
+{
+    rtp_sender_t* s = arg;
+    xTaskNotifyGive(s->task);
+}
+
+static void rtp_sender_task(void* arg)
+{
+    rtp_sender_t* s = arg;
+
+    ESP_LOGI(TAG, "RTP sender %d task started", s->session);
+    while (!s->stop) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        rtp_sender_drain(s);
+    }
+
+    s->task = NULL;
+    vTaskDelete(NULL);
+}
+
+static void rtp_sender_free(rtp_sender_t* s)
+{
+    if (s->timer != NULL) {
+        esp_timer_stop(s->timer);
+        esp_timer_delete(s->timer);
+    }
+    if (s->sock >= 0) {
+        close(s->sock);
+    }
+    free(s->slots);
+    free(s->pool);
+    free(s);
+}
+
+esp_err_t rtp_sender_start(uint8_t session, const rtp_sender_config_t* cfg)
+{
+    if (rtp_get_active_session(session) == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (senders[session] != NULL) {
+        ESP_LOGE(TAG, "RTP sender %d already started", session);
+        return ESP_FAIL;
+    }
+
+    if (cfg->clock_rate == 0 || cfg->queue_len == 0 || (cfg->queue_len & (cfg->queue_len - 1)) || cfg->payload_size_max == 0) {
+        ESP_LOGE(TAG, "Invalid sender configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    rtp_sender_t* s = calloc(1, sizeof(rtp_sender_t));
+    if (s == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate sender");
+        return ESP_ERR_NO_MEM;
+    }
+    s->cfg = *cfg;
+    if (s->cfg.max_burst == 0 || s->cfg.max_burst > RTP_SENDER_BATCH_MAX) {
+        s->cfg.max_burst = RTP_SENDER_BATCH_MAX;
+    }
+    s->session = session;
+    s->sock = -1;
+    s->mask = cfg->queue_len - 1;
+
+    // One allocation for all packet buffers
+    size_t slot_size = RTP_HEADER_MAX_SIZE + cfg->payload_size_max + (cfg->srtp ? RTP_SRTP_TRAILER_MAX : 0);
+    s->pool = malloc(slot_size * cfg->queue_len);
+    s->slots = calloc(cfg->queue_len, sizeof(rtp_sender_slot_t));
+    if (s->pool == NULL || s->slots == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate sender queue");
+        rtp_sender_free(s);
+        return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < cfg->queue_len; i++) {
+        s->slots[i].data = s->pool + i * slot_size;
+    }
+
+    s->sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s->sock < 0) {
+        ESP_LOGE(TAG, "Failed to create socket");
+        rtp_sender_free(s);
+        return ESP_FAIL;
+    }
+
+    struct sockaddr_in local = {
+        .sin_family = AF_INET,
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+        .sin_port = htons(cfg->local_port),
+    };
+    if (bind(s->sock, (struct sockaddr*)&local, sizeof(local)) != 0
+        || connect(s->sock, (const struct sockaddr*)&cfg->destination, sizeof(cfg->destination)) != 0) {
+        ESP_LOGE(TAG, "Failed to bind/connect socket: errno %d", errno);
+        rtp_sender_free(s);
+        return ESP_FAIL;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = rtp_sender_timer_cb,
+        .arg = s,
+        .name = "rtp_sender",
+    };
+    if (esp_timer_create(&timer_args, &s->timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create pacing timer");
+        rtp_sender_free(s);
+        return ESP_FAIL;
+    }
+
+    if (xTaskCreatePinnedToCore(rtp_sender_task, "rtp_sender", RTP_SENDER_STACK_SIZE, s, cfg->task_priority, &s->task, cfg->task_core) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create sender task");
+        rtp_sender_free(s);
+        return ESP_FAIL;
+    }
+
+    senders[session] = s;
+    ESP_LOGI(TAG, "RTP sender %d started.", session);
+    return ESP_OK;
+}
+
+esp_err_t rtp_sender_stop(uint8_t session)
+{
+    if (session >= RTP_SESSION_MAX || senders[session] == NULL) {
+        return ESP_FAIL;
+    }
+
+    rtp_sender_t* s = senders[session];
+    senders[session] = NULL;
+
+    esp_timer_stop(s->timer);
+    s->stop = true;
+    while (s->task != NULL) {
+        xTaskNotifyGive(s->task);
+        vTaskDelay(1);
+    }
+
+    rtp_sender_free(s);
+    ESP_LOGI(TAG, "RTP sender %d stopped.", session);
+    return ESP_OK;
+}
+
+uint8_t* rtp_sender_acquire(uint8_t session)
+{
+    rtp_sender_t* s = rtp_get_sender(session);
+    if (s == NULL) {
+        return NULL;
+    }
+
+    unsigned int head = atomic_load_explicit(&s->head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&s->tail, memory_order_acquire);
+    if (head - tail >= s->cfg.queue_len) {
+        atomic_fetch_add_explicit(&s->dropped, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    return s->slots[head & s->mask].data + RTP_HEADER_MAX_SIZE;
+}
+
+esp_err_t rtp_sender_commit(uint8_t session, size_t payload_length)
+{
+    rtp_sender_t* s = rtp_get_sender(session);
+    if (s == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (payload_length > s->cfg.payload_size_max) {
+        ESP_LOGE(TAG, "Payload larger than payload_size_max");
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // A commit without a successful acquire would overwrite a slot still being sent
+    unsigned int head = atomic_load_explicit(&s->head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&s->tail, memory_order_acquire);
+    if (head - tail >= s->cfg.queue_len) {
+        ESP_LOGE(TAG, "Commit without an acquired slot");
+        return ESP_ERR_INVALID_STATE;
+    }
+    rtp_sender_slot_t* slot = &s->slots[head & s->mask];
+
+    // Header goes right in front of the payload
+    slot->offset = RTP_HEADER_MAX_SIZE - rtp_session_get_header_size(session);
+    slot->len = rtp_create_packet_inplace(session, slot->data + slot->offset, payload_length,
+                                          RTP_HEADER_MAX_SIZE - slot->offset + payload_length);
+    if (slot->len != 0 && s->cfg.srtp != NULL) {
+        slot->len = rtp_srtp_protect(s->cfg.srtp, slot->data + slot->offset, slot->len, slot->len + RTP_SRTP_TRAILER_MAX);
+    }
+    if (slot->len == 0) {
+        return ESP_FAIL;
+    }
+    slot->queued_us = esp_timer_get_time();
+
+    atomic_store_explicit(&s->head, head + 1, memory_order_release);
+    xTaskNotifyGive(s->task);
+    return ESP_OK;
+}
+
+esp_err_t rtp_sender_send(uint8_t session, const void* payload, size_t payload_length)
+{
+    rtp_sender_t* s = rtp_get_sender(session);
+    if (s == NULL) {
+        return ESP_FAIL;
+    }
+
+    if (payload_length > s->cfg.payload_size_max) {
+        ESP_LOGE(TAG, "Payload larger than payload_size_max");
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t* buf = rtp_sender_acquire(session);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    memcpy(buf, payload, payload_length);
+    return rtp_sender_commit(session, payload_length);
+}
+
+int rtp_sender_get_socket(uint8_t session)
+{
+    rtp_sender_t* s = rtp_get_sender(session);
+    if (s == NULL) {
+        return -1;
+    }
+
+    return s->sock;
+}
+
+esp_err_t rtp_sender_get_stats(uint8_t session, rtp_sender_stats_t* stats)
+{
+    rtp_sender_t* s = rtp_get_sender(session);
+    if (s == NULL) {
+        return ESP_FAIL;
+    }
+
+    *stats = s->stats;
+    stats->dropped = atomic_load(&s->dropped);
+    stats->latency_avg_us = s->stats.sent ? (uint32_t)(s->latency_sum_us / s->stats.sent) : 0;
+    return ESP_OK;
+}
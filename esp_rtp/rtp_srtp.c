@@ -0,0 +1,307 @@
+/**
+ * @file rtp_srtp.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "rtp_srtp.h"
+
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+#define RTP_SRTP_LABEL_RTP_ENCRYPTION 0x00
+#define RTP_SRTP_LABEL_RTP_AUTH 0x01
+#define RTP_SRTP_LABEL_RTP_SALT 0x02
+
+static const char* TAG = "SRTP";
+
+/**
+ * @brief RFC 3711 4.3: AES-CM PRF keyed with the master key, IV is the master salt with the label
+ *        XORed in at byte 7 and two zero bytes of block counter
+ */
+static void rtp_srtp_derive(mbedtls_aes_context* master, const uint8_t* master_salt, uint8_t label, uint8_t* out, size_t len)
+{
+    uint8_t iv[16] = { 0 };
+    uint8_t stream_block[16];
+    size_t nc_off = 0;
+
+    memcpy(iv, master_salt, RTP_SRTP_MASTER_SALT_SIZE);
+    iv[7] ^= label;
+    memset(out, 0, len);
+    mbedtls_aes_crypt_ctr(master, len, &nc_off, iv, stream_block, out, out);
+}
+
+esp_err_t rtp_srtp_init(rtp_srtp_t* srtp, rtp_srtp_profile_t profile, const uint8_t* master_key, const uint8_t* master_salt)
+{
+    if (profile != RTP_SRTP_AES128_CM_HMAC_SHA1_80 && profile != RTP_SRTP_AEAD_AES_128_GCM) {
+        ESP_LOGE(TAG, "Unknown SRTP profile %d", profile);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(srtp, 0, sizeof(rtp_srtp_t));
+    srtp->profile = profile;
+    mbedtls_aes_init(&srtp->aes);
+    mbedtls_gcm_init(&srtp->gcm);
+    mbedtls_md_init(&srtp->hmac);
+
+    // The 96 bit AEAD master salt is zero padded for the key derivation
+    uint8_t salt[RTP_SRTP_MASTER_SALT_SIZE] = { 0 };
+    memcpy(salt, master_salt, profile == RTP_SRTP_AEAD_AES_128_GCM ? RTP_SRTP_GCM_MASTER_SALT_SIZE : RTP_SRTP_MASTER_SALT_SIZE);
+
+    mbedtls_aes_context master;
+    mbedtls_aes_init(&master);
+    mbedtls_aes_setkey_enc(&master, master_key, 8 * RTP_SRTP_MASTER_KEY_SIZE);
+
+    uint8_t key[RTP_SRTP_MASTER_KEY_SIZE];
+    uint8_t auth_key[RTP_SRTP_AUTH_KEY_SIZE];
+    rtp_srtp_derive(&master, salt, RTP_SRTP_LABEL_RTP_ENCRYPTION, key, sizeof(key));
+    rtp_srtp_derive(&master, salt, RTP_SRTP_LABEL_RTP_AUTH, auth_key, sizeof(auth_key));
+    rtp_srtp_derive(&master, salt, RTP_SRTP_LABEL_RTP_SALT, srtp->salt,
+                    profile == RTP_SRTP_AEAD_AES_128_GCM ? RTP_SRTP_GCM_MASTER_SALT_SIZE : RTP_SRTP_MASTER_SALT_SIZE);
+    mbedtls_aes_free(&master);
+
+    int ret;
+    if (profile == RTP_SRTP_AEAD_AES_128_GCM) {
+        ret = mbedtls_gcm_setkey(&srtp->gcm, MBEDTLS_CIPHER_ID_AES, key, 8 * sizeof(key));
+    } else {
+        ret = mbedtls_aes_setkey_enc(&srtp->aes, key, 8 * sizeof(key));
+        if (ret == 0) {
+            ret = mbedtls_md_setup(&srtp->hmac, mbedtls_md_info_from_type(MBEDTLS_MD_SHA1), 1);
+        }
+        if (ret == 0) {
+            ret = mbedtls_md_hmac_starts(&srtp->hmac, auth_key, sizeof(auth_key));
+        }
+    }
+    memset(key, 0, sizeof(key));
+    memset(auth_key, 0, sizeof(auth_key));
+
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Failed to set up session keys: -0x%04x", -ret);
+        rtp_srtp_deinit(srtp);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+void rtp_srtp_deinit(rtp_srtp_t* srtp)
+{
+    mbedtls_aes_free(&srtp->aes);
+    mbedtls_gcm_free(&srtp->gcm);
+    mbedtls_md_free(&srtp->hmac);
+    memset(srtp->salt, 0, sizeof(srtp->salt));
+}
+
+/**
+ * @brief Length of the RTP header including CSRCs and header extension, 0 if malformed
+ */
+static size_t rtp_srtp_header_length(const uint8_t* p, size_t len)
+{
+    if (len < RTP_HEADER_SIZE || (p[0] >> 6) != 2) {
+        return 0;
+    }
+
+    size_t length = RTP_HEADER_SIZE + 4 * (p[0] & 0x0f);
+    if (p[0] & 0x10) {
+        if (len < length + 4) {
+            return 0;
+        }
+        length += 4 + 4 * ((p[length + 2] << 8) | p[length + 3]);
+    }
+
+    return length <= len ? length : 0;
+}
+
+/**
+ * @brief RFC 3711 3.3.1: guess the rollover counter of a sequence number from the highest one seen
+ */
+static uint32_t rtp_srtp_estimate_roc(const rtp_srtp_t* srtp, uint16_t seq)
+{
+    if (!srtp->started) {
+        return srtp->roc;
+    }
+
+    if (srtp->s_l < 32768) {
+        return (seq - srtp->s_l > 32768 && srtp->roc > 0) ? srtp->roc - 1 : srtp->roc;
+    }
+    return (srtp->s_l - 32768 > seq) ? srtp->roc + 1 : srtp->roc;
+}
+
+/**
+ * @brief Distance from the highest index seen to the index of roc/seq, positive if newer
+ */
+static int64_t rtp_srtp_index_delta(const rtp_srtp_t* srtp, uint32_t roc, uint16_t seq)
+{
+    int64_t index = ((int64_t)roc << 16) | seq;
+    int64_t highest = ((int64_t)srtp->roc << 16) | srtp->s_l;
+    return index - highest;
+}
+
+static void rtp_srtp_update_index(rtp_srtp_t* srtp, uint32_t roc, uint16_t seq)
+{
+    int64_t delta = rtp_srtp_index_delta(srtp, roc, seq);
+
+    if (!srtp->started) {
+        srtp->started = true;
+        srtp->roc = roc;
+        srtp->s_l = seq;
+        srtp->replay_window = 1;
+    } else if (delta > 0) {
+        srtp->replay_window = delta < RTP_SRTP_REPLAY_WINDOW ? (srtp->replay_window << delta) | 1 : 1;
+        srtp->roc = roc;
+        srtp->s_l = seq;
+    } else {
+        srtp->replay_window |= 1ULL << -delta;
+    }
+}
+
+/**
+ * @brief AES-CM IV (RFC 3711 4.1.1): session salt XOR SSRC at byte 4 XOR packet index at byte 8
+ */
+static void rtp_srtp_cm_crypt(rtp_srtp_t* srtp, const uint8_t* header, uint32_t roc, uint8_t* payload, size_t length)
+{
+    uint8_t iv[16] = { 0 };
+    uint8_t stream_block[16];
+    size_t nc_off = 0;
+
+    memcpy(iv, srtp->salt, RTP_SRTP_MASTER_SALT_SIZE);
+    for (int i = 0; i < 4; i++) {
+        iv[4 + i] ^= header[8 + i];
+    }
+    iv[8] ^= roc >> 24;
+    iv[9] ^= roc >> 16;
+    iv[10] ^= roc >> 8;
+    iv[11] ^= roc;
+    iv[12] ^= header[2];
+    iv[13] ^= header[3];
+
+    mbedtls_aes_crypt_ctr(&srtp->aes, length, &nc_off, iv, stream_block, payload, payload);
+}
+
+/**
+ * @brief HMAC-SHA1 over the authenticated portion followed by the rollover counter, truncated to 80 bits
+ */
+static void rtp_srtp_hmac(rtp_srtp_t* srtp, const uint8_t* packet, size_t len, uint32_t roc, uint8_t tag[RTP_SRTP_HMAC_TAG_SIZE])
+{
+    uint8_t roc_be[4] = { roc >> 24, roc >> 16, roc >> 8, roc };
+    uint8_t digest[20];
+
+    mbedtls_md_hmac_reset(&srtp->hmac);
+    mbedtls_md_hmac_update(&srtp->hmac, packet, len);
+    mbedtls_md_hmac_update(&srtp->hmac, roc_be, sizeof(roc_be));
+    mbedtls_md_hmac_finish(&srtp->hmac, digest);
+    memcpy(tag, digest, RTP_SRTP_HMAC_TAG_SIZE);
+}
+
+/**
+ * @brief AEAD IV (RFC 7714 8.1): 00 00 || SSRC || ROC || SEQ, XOR session salt
+ */
+static void rtp_srtp_gcm_iv(const rtp_srtp_t* srtp, const uint8_t* header, uint32_t roc, uint8_t iv[RTP_SRTP_GCM_MASTER_SALT_SIZE])
+{
+    iv[0] = 0;
+    iv[1] = 0;
+    memcpy(&iv[2], &header[8], 4);
+    iv[6] = roc >> 24;
+    iv[7] = roc >> 16;
+    iv[8] = roc >> 8;
+    iv[9] = roc;
+    iv[10] = header[2];
+    iv[11] = header[3];
+    for (int i = 0; i < RTP_SRTP_GCM_MASTER_SALT_SIZE; i++) {
+        iv[i] ^= srtp->salt[i];
+    }
+}
+
+size_t rtp_srtp_protect(rtp_srtp_t* srtp, void* packet, size_t len, size_t size)
+{
+    uint8_t* p = packet;
+    size_t header_length = rtp_srtp_header_length(p, len);
+    size_t tag_length = srtp->profile == RTP_SRTP_AEAD_AES_128_GCM ? RTP_SRTP_GCM_TAG_SIZE : RTP_SRTP_HMAC_TAG_SIZE;
+    if (header_length == 0) {
+        ESP_LOGE(TAG, "Malformed RTP packet");
+        return 0;
+    }
+
+    if (size < len + tag_length) {
+        ESP_LOGE(TAG, "Buffer too small to hold SRTP packet");
+        return 0;
+    }
+
+    uint16_t seq = (p[2] << 8) | p[3];
+    uint32_t roc = rtp_srtp_estimate_roc(srtp, seq);
+    if (rtp_srtp_index_delta(srtp, roc, seq) > 0 || !srtp->started) {
+        rtp_srtp_update_index(srtp, roc, seq);
+    }
+
+    if (srtp->profile == RTP_SRTP_AEAD_AES_128_GCM) {
+        uint8_t iv[RTP_SRTP_GCM_MASTER_SALT_SIZE];
+        rtp_srtp_gcm_iv(srtp, p, roc, iv);
+        mbedtls_gcm_crypt_and_tag(&srtp->gcm, MBEDTLS_GCM_ENCRYPT, len - header_length, iv, sizeof(iv), p, header_length,
+                                  &p[header_length], &p[header_length], RTP_SRTP_GCM_TAG_SIZE, &p[len]);
+    } else {
+        rtp_srtp_cm_crypt(srtp, p, roc, &p[header_length], len - header_length);
+        rtp_srtp_hmac(srtp, p, len, roc, &p[len]);
+    }
+
+    return len + tag_length;
+}
+
+esp_err_t rtp_srtp_unprotect(rtp_srtp_t* srtp, void* packet, size_t len, size_t* rtp_len)
+{
+    uint8_t* p = packet;
+    size_t tag_length = srtp->profile == RTP_SRTP_AEAD_AES_128_GCM ? RTP_SRTP_GCM_TAG_SIZE : RTP_SRTP_HMAC_TAG_SIZE;
+    if (len < tag_length) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t length = len - tag_length;
+    size_t header_length = rtp_srtp_header_length(p, length);
+    if (header_length == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint16_t seq = (p[2] << 8) | p[3];
+    uint32_t roc = rtp_srtp_estimate_roc(srtp, seq);
+
+    // Replay check first, it is cheaper than authentication
+    int64_t delta = rtp_srtp_index_delta(srtp, roc, seq);
+    if (srtp->started && delta <= 0
+        && (-delta >= RTP_SRTP_REPLAY_WINDOW || (srtp->replay_window & (1ULL << -delta)))) {
+        srtp->replayed++;
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (srtp->profile == RTP_SRTP_AEAD_AES_128_GCM) {
+        uint8_t iv[RTP_SRTP_GCM_MASTER_SALT_SIZE];
+        rtp_srtp_gcm_iv(srtp, p, roc, iv);
+        if (mbedtls_gcm_auth_decrypt(&srtp->gcm, length - header_length, iv, sizeof(iv), p, header_length,
+                                     &p[length], RTP_SRTP_GCM_TAG_SIZE, &p[header_length], &p[header_length])
+            != 0) {
+            srtp->auth_failures++;
+            return ESP_ERR_INVALID_MAC;
+        }
+    } else {
+        uint8_t tag[RTP_SRTP_HMAC_TAG_SIZE];
+        rtp_srtp_hmac(srtp, p, length, roc, tag);
+
+        // Constant time compare
+        uint8_t diff = 0;
+        for (int i = 0; i < RTP_SRTP_HMAC_TAG_SIZE; i++) {
+            diff |= tag[i] ^ p[length + i];
+        }
+        if (diff != 0) {
+            srtp->auth_failures++;
+            return ESP_ERR_INVALID_MAC;
+        }
+        rtp_srtp_cm_crypt(srtp, p, roc, &p[header_length], length - header_length);
+    }
+
+    rtp_srtp_update_index(srtp, roc, seq);
+    *rtp_len = length;
+    return ESP_OK;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file test_rtcp.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-09
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "lwip/sockets.h"
+
+#include "rtcp.h"
+#include "rtp.h"
+#include "rtp_receiver.h"
+
+#define TX_SESSION 1
+#define RX_SESSION 2
+#define NUM_PACKETS 10
+
+static rtcp_feedback_t last_feedback;
+static int num_feedback;
+
+static void on_feedback(uint8_t session, const rtcp_feedback_t* feedback, void* user_ctx)
+{
+    TEST_ASSERT_EQUAL_INT(TX_SESSION, session);
+    last_feedback = *feedback;
+    num_feedback++;
+}
+
+static int open_loopback_socket(struct sockaddr_in* addr)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, sock);
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr->sin_port = 0;
+    TEST_ASSERT_EQUAL_INT(0, bind(sock, (struct sockaddr*)addr, sizeof(*addr)));
+
+    socklen_t len = sizeof(*addr);
+    getsockname(sock, (struct sockaddr*)addr, &len);
+
+    struct timeval timeout = { .tv_sec = 1 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return sock;
+}
+
+TEST_CASE("RTCP reports over loopback UDP", "[rtp][rtcp]")
+{
+    struct sockaddr_in tx_addr, rx_addr;
+    int tx_sock = open_loopback_socket(&tx_addr);
+    int rx_sock = open_loopback_socket(&rx_addr);
+
+    rtcp_config_t tx_rtcp = {
+        .clock_rate = 48000,
+        .cname = "sender@esp",
+        .on_feedback = on_feedback,
+    };
+    rtcp_config_t rx_rtcp = {
+        .clock_rate = 48000,
+        .cname = "receiver@esp",
+    };
+    rtp_receiver_config_t rx_cfg = {
+        .clock_rate = 48000,
+    };
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    rtp_session_set_timestamp_inc(TX_SESSION, 480);
+    TEST_ESP_OK(rtcp_init(TX_SESSION, &tx_rtcp));
+    TEST_ESP_OK(rtp_session_init(RX_SESSION, 96));
+    TEST_ESP_OK(rtp_receiver_init(RX_SESSION, &rx_cfg));
+    TEST_ESP_OK(rtcp_init(RX_SESSION, &rx_rtcp));
+    num_feedback = 0;
+
+    // Streaming starts a while after the session was initialized
+    vTaskDelay(pdMS_TO_TICKS(200));
+
+    // Send RTP, packets 4 and 5 are lost on the way
+    static uint8_t packets[NUM_PACKETS][64];
+    uint8_t payload[20] = { 0 };
+    uint32_t last_timestamp = 0;
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        uint8_t packet[64];
+        size_t len = rtp_create_packet(TX_SESSION, payload, sizeof(payload), packet, sizeof(packet));
+        if (i == 4 || i == 5) {
+            continue;
+        }
+        sendto(tx_sock, packet, len, 0, (struct sockaddr*)&rx_addr, sizeof(rx_addr));
+        int n = recv(rx_sock, packets[i], sizeof(packets[i]), 0);
+        TEST_ASSERT_EQUAL_INT(len, n);
+        TEST_ESP_OK(rtp_receive(RX_SESSION, packets[i], n));
+        last_timestamp = ((uint32_t)packets[i][4] << 24) | (packets[i][5] << 16) | (packets[i][6] << 8) | packets[i][7];
+    }
+    rtp_receiver_flush(RX_SESSION);
+
+    // Sender report with SDES
+    uint8_t rtcp[128];
+    size_t len = rtcp_create_report(TX_SESSION, rtcp, sizeof(rtcp));
+    TEST_ASSERT_EQUAL_INT(28 + 24, len); // SR without report block, SDES with 10 character CNAME
+    TEST_ASSERT_EQUAL_HEX8(RTCP_PT_SR, rtcp[1]);
+    TEST_ASSERT_EQUAL_UINT32(NUM_PACKETS, ((uint32_t)rtcp[20] << 24) | (rtcp[21] << 16) | (rtcp[22] << 8) | rtcp[23]);
+    TEST_ASSERT_EQUAL_UINT32(NUM_PACKETS * sizeof(payload), ((uint32_t)rtcp[24] << 24) | (rtcp[25] << 16) | (rtcp[26] << 8) | rtcp[27]);
+    sendto(tx_sock, rtcp, len, 0, (struct sockaddr*)&rx_addr, sizeof(rx_addr));
+
+    int n = recv(rx_sock, rtcp, sizeof(rtcp), 0);
+    TEST_ASSERT_EQUAL_INT(len, n);
+    TEST_ESP_OK(rtcp_receive(RX_SESSION, rtcp, n));
+    TEST_ASSERT_EQUAL_INT(0, strcmp("sender@esp", rtcp_get_peer_cname(RX_SESSION)));
+
+    // Media to wallclock: the last packet was built just now, whatever the delay since session init
+    uint64_t ntp;
+    TEST_ESP_OK(rtcp_rtp_to_ntp(RX_SESSION, last_timestamp, &ntp));
+    int64_t offset_ms = ((int64_t)(ntp - rtcp_ntp_now()) * 1000) >> 32;
+    TEST_ASSERT_INT_WITHIN(50, 0, offset_ms);
+
+    // Receiver report back to the sender
+    len = rtcp_create_report(RX_SESSION, rtcp, sizeof(rtcp));
+    TEST_ASSERT_EQUAL_HEX8(0x81, rtcp[0]);
+    TEST_ASSERT_EQUAL_HEX8(RTCP_PT_RR, rtcp[1]);
+    sendto(rx_sock, rtcp, len, 0, (struct sockaddr*)&tx_addr, sizeof(tx_addr));
+
+    n = recv(tx_sock, rtcp, sizeof(rtcp), 0);
+    TEST_ASSERT_EQUAL_INT(len, n);
+    TEST_ESP_OK(rtcp_receive(TX_SESSION, rtcp, n));
+    TEST_ASSERT_EQUAL_INT(1, num_feedback);
+    TEST_ASSERT_EQUAL_INT(0, strcmp("receiver@esp", rtcp_get_peer_cname(TX_SESSION)));
+
+    rtcp_feedback_t feedback;
+    TEST_ESP_OK(rtcp_get_feedback(TX_SESSION, &feedback));
+    TEST_ASSERT_EQUAL_INT(2, feedback.lost);
+    TEST_ASSERT_EQUAL_UINT8((2 << 8) / NUM_PACKETS, feedback.fraction_lost);
+    TEST_ASSERT_TRUE(feedback.rtt_valid);
+    TEST_ASSERT_LESS_THAN(100000, feedback.rtt_us);
+    TEST_ASSERT_EQUAL_UINT32(last_feedback.extended_max_seq, feedback.extended_max_seq);
+
+    // Nothing sent since the last report: receiver report next time
+    len = rtcp_create_report(TX_SESSION, rtcp, sizeof(rtcp));
+    TEST_ASSERT_EQUAL_HEX8(RTCP_PT_RR, rtcp[1]);
+
+    close(tx_sock);
+    close(rx_sock);
+    rtp_session_deinit(TX_SESSION);
+    rtp_session_deinit(RX_SESSION);
+}
@@ -14,6 +14,7 @@
 
 #include "unity.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "rtp.h"
 
@@ -54,3 +55,119 @@ TEST_CASE("Create RTP packet", "[rtp]")
 
     ESP_LOG_BUFFER_HEX("", packet, length);
 }
+
+TEST_CASE("Create RTP packet in place", "[rtp]")
+{
+    rtp_session_init(1, 96);
+    rtp_session_set_timestamp_inc(1, 480);
+
+    uint8_t payload[4] = {0x12, 0x34, 0xab, 0xcd};
+    uint8_t copied[100];
+    uint8_t inplace[RTP_HEADER_SIZE + 4];
+    memcpy(inplace + RTP_HEADER_SIZE, payload, 4);
+
+    size_t length = rtp_create_packet(1, payload, 4, copied, 100);
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4, length);
+
+    length = rtp_create_packet_inplace(1, inplace, 4, sizeof(inplace));
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4, length);
+
+    // Next packet: sequence number +1, timestamp +480, marker cleared
+    uint16_t seq = (copied[2] << 8) | copied[3];
+    TEST_ASSERT_EQUAL_UINT16((uint16_t)(seq + 1), (inplace[2] << 8) | inplace[3]);
+    uint32_t ts = ((uint32_t)copied[4] << 24) | (copied[5] << 16) | (copied[6] << 8) | copied[7];
+    TEST_ASSERT_EQUAL_UINT32(ts + 480, ((uint32_t)inplace[4] << 24) | (inplace[5] << 16) | (inplace[6] << 8) | inplace[7]);
+    TEST_ASSERT_EQUAL_HEX8(0x80, inplace[0]);
+    TEST_ASSERT_EQUAL_HEX8(96, inplace[1]);
+    TEST_ASSERT_EQUAL_MEMORY(copied + 8, inplace + 8, 4);
+    TEST_ASSERT_EQUAL_MEMORY(payload, inplace + RTP_HEADER_SIZE, 4);
+
+    uint8_t header[RTP_HEADER_MAX_SIZE];
+    struct iovec iov[2];
+    length = rtp_create_iovec(1, header, payload, 4, iov);
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4, length);
+    TEST_ASSERT(iov[0].iov_base == header);
+    TEST_ASSERT(iov[1].iov_base == payload);
+    TEST_ASSERT_EQUAL_UINT16((uint16_t)(seq + 2), (header[2] << 8) | header[3]);
+
+    // Too small for header + payload
+    length = rtp_create_packet_inplace(1, inplace, 4, RTP_HEADER_SIZE + 3);
+    TEST_ASSERT_EQUAL_INT(0, length);
+
+    rtp_session_deinit(1);
+}
+
+TEST_CASE("RTP header extensions", "[rtp]")
+{
+    uint8_t payload[4] = {0x12, 0x34, 0xab, 0xcd};
+    uint8_t packet[100];
+
+    rtp_session_init(1, 96);
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE, rtp_session_get_header_size(1));
+
+    // One-byte form: 12 byte header + 4 byte extension header + 1 + 8 data bytes, padded to 12
+    TEST_ESP_OK(rtp_session_add_extension(1, 3, RTP_EXT_ABS_CAPTURE_TIME_SIZE));
+    TEST_ESP_ERR(rtp_session_add_extension(1, 3, 2), ESP_ERR_INVALID_ARG);
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4 + 12, rtp_session_get_header_size(1));
+    TEST_ESP_OK(rtp_session_set_abs_capture_time(1, 3, 0x0102030405060708ULL));
+
+    size_t length = rtp_create_packet(1, payload, 4, packet, sizeof(packet));
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 16 + 4, length);
+    TEST_ASSERT_EQUAL_HEX8(0x90, packet[0]); // V=2, X=1
+    const uint8_t one_byte[16] = {0xbe, 0xde, 0x00, 0x03, 0x37, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0, 0};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(one_byte, packet + RTP_HEADER_SIZE, 16);
+    TEST_ASSERT_EQUAL_MEMORY(payload, packet + RTP_HEADER_SIZE + 16, 4);
+
+    // Element longer than 16 bytes switches to the two-byte form, data already set is kept
+    const uint8_t data[17] = {0xaa};
+    TEST_ESP_OK(rtp_session_add_extension(1, 20, sizeof(data)));
+    TEST_ESP_OK(rtp_session_set_extension(1, 20, data, sizeof(data)));
+    TEST_ESP_ERR(rtp_session_set_extension(1, 20, data, 4), ESP_ERR_INVALID_SIZE);
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4 + 32, rtp_session_get_header_size(1));
+
+    length = rtp_create_packet(1, payload, 4, packet, sizeof(packet));
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 36 + 4, length);
+    const uint8_t two_byte[16] = {0x10, 0x00, 0x00, 0x08, 3, 8, 1, 2, 3, 4, 5, 6, 7, 8, 20, 17};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(two_byte, packet + RTP_HEADER_SIZE, 16);
+    TEST_ASSERT_EQUAL_HEX8(0xaa, packet[RTP_HEADER_SIZE + 16]);
+
+    rtp_session_deinit(1);
+}
+
+#define RTP_BENCH_PACKETS 10000
+#define RTP_BENCH_PAYLOAD 240 // LC3 48 kHz / 10 ms at 192 kbps
+
+TEST_CASE("Packet rate copy vs in place", "[rtp][bench]")
+{
+    static uint8_t payload[RTP_BENCH_PAYLOAD];
+    static uint8_t packet[RTP_HEADER_SIZE + RTP_BENCH_PAYLOAD];
+    uint8_t header[RTP_HEADER_MAX_SIZE];
+    struct iovec iov[2];
+
+    rtp_session_init(1, 96);
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        rtp_create_packet(1, payload, RTP_BENCH_PAYLOAD, packet, sizeof(packet));
+    }
+    int64_t copy_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        rtp_create_packet_inplace(1, packet, RTP_BENCH_PAYLOAD, sizeof(packet));
+    }
+    int64_t inplace_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        rtp_create_iovec(1, header, payload, RTP_BENCH_PAYLOAD, iov);
+    }
+    int64_t iovec_us = esp_timer_get_time() - start;
+
+    rtp_session_deinit(1);
+
+    printf("%d packets, %d byte payload\n", RTP_BENCH_PACKETS, RTP_BENCH_PAYLOAD);
+    printf("copy:     %8lld us  %8lld packets/s\n", copy_us, RTP_BENCH_PACKETS * 1000000LL / (copy_us + 1));
+    printf("in place: %8lld us  %8lld packets/s\n", inplace_us, RTP_BENCH_PACKETS * 1000000LL / (inplace_us + 1));
+    printf("iovec:    %8lld us  %8lld packets/s\n", iovec_us, RTP_BENCH_PACKETS * 1000000LL / (iovec_us + 1));
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_rtp_fanout.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-30
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+
+#include "lwip/sockets.h"
+
+#include "rtp.h"
+#include "rtp_fanout.h"
+
+#define NUM_RECEIVERS 3
+
+static int open_receiver(struct sockaddr_in* addr)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(sock, (struct sockaddr*)addr, sizeof(*addr));
+
+    socklen_t len = sizeof(*addr);
+    getsockname(sock, (struct sockaddr*)addr, &len);
+
+    struct timeval timeout = { .tv_usec = 100000 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return sock;
+}
+
+TEST_CASE("RTP fan-out to several destinations", "[rtp]")
+{
+    const rtp_fanout_config_t cfg = {
+        .payload_type = 96,
+        .timestamp_inc = 480,
+    };
+    int socks[NUM_RECEIVERS];
+    struct sockaddr_in addrs[NUM_RECEIVERS];
+    rtp_fanout_handle_t fanout[2];
+
+    // Handles are not limited by RTP_SESSION_MAX
+    rtp_fanout_handle_t extra[RTP_SESSION_MAX];
+    for (int i = 0; i < RTP_SESSION_MAX; i++) {
+        TEST_ESP_OK(rtp_fanout_create(&cfg, &extra[i]));
+    }
+    TEST_ESP_OK(rtp_fanout_create(&cfg, &fanout[0]));
+    TEST_ESP_OK(rtp_fanout_create(&cfg, &fanout[1]));
+
+    for (int i = 0; i < NUM_RECEIVERS; i++) {
+        socks[i] = open_receiver(&addrs[i]);
+        TEST_ESP_OK(rtp_fanout_add_destination(fanout[0], &addrs[i]));
+    }
+    TEST_ESP_ERR(rtp_fanout_add_destination(fanout[0], &addrs[0]), ESP_ERR_INVALID_STATE);
+    TEST_ESP_OK(rtp_fanout_add_destination(fanout[1], &addrs[0]));
+    TEST_ASSERT_EQUAL_INT(NUM_RECEIVERS, rtp_fanout_get_num_destinations(fanout[0]));
+
+    uint8_t payload[100];
+    for (int n = 0; n < 5; n++) {
+        memset(payload, n, sizeof(payload));
+        TEST_ESP_OK(rtp_fanout_send(fanout[0], payload, sizeof(payload)));
+
+        // Every destination gets the same packet
+        uint8_t first[200];
+        for (int i = 0; i < NUM_RECEIVERS; i++) {
+            uint8_t packet[200];
+            TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + sizeof(payload), recv(socks[i], packet, sizeof(packet), 0));
+            if (i == 0) {
+                memcpy(first, packet, sizeof(packet));
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(first, packet, RTP_HEADER_SIZE + sizeof(payload));
+            TEST_ASSERT_EQUAL_UINT8(n, packet[RTP_HEADER_SIZE]);
+        }
+    }
+
+    // The second session has its own SSRC
+    TEST_ESP_OK(rtp_fanout_send(fanout[1], payload, sizeof(payload)));
+    uint8_t packet[200];
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + sizeof(payload), recv(socks[0], packet, sizeof(packet), 0));
+    uint32_t ssrc = ((uint32_t)packet[8] << 24) | (packet[9] << 16) | (packet[10] << 8) | packet[11];
+    TEST_ASSERT_EQUAL_HEX32(rtp_fanout_get_session(fanout[1])->header.ssrc, ssrc);
+
+    // Removed destination no longer receives
+    TEST_ESP_OK(rtp_fanout_remove_destination(fanout[0], &addrs[1]));
+    TEST_ESP_ERR(rtp_fanout_remove_destination(fanout[0], &addrs[1]), ESP_ERR_NOT_FOUND);
+    TEST_ESP_OK(rtp_fanout_send(fanout[0], payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + sizeof(payload), recv(socks[0], packet, sizeof(packet), 0));
+    TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + sizeof(payload), recv(socks[2], packet, sizeof(packet), 0));
+    TEST_ASSERT_LESS_THAN(0, recv(socks[1], packet, sizeof(packet), 0));
+
+    rtp_fanout_dest_stats_t stats;
+    TEST_ESP_OK(rtp_fanout_get_destination_stats(fanout[0], &addrs[0], &stats));
+    TEST_ASSERT_EQUAL_UINT32(6, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(6 * (RTP_HEADER_SIZE + sizeof(payload)), stats.bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+    TEST_ESP_ERR(rtp_fanout_get_destination_stats(fanout[0], &addrs[1], &stats), ESP_ERR_NOT_FOUND);
+    TEST_ASSERT_EQUAL_UINT32(6, rtp_fanout_get_session(fanout[0])->packet_count);
+
+    for (int i = 0; i < NUM_RECEIVERS; i++) {
+        close(socks[i]);
+    }
+    for (int i = 0; i < RTP_SESSION_MAX; i++) {
+        TEST_ESP_OK(rtp_fanout_delete(extra[i]));
+    }
+    TEST_ESP_OK(rtp_fanout_delete(fanout[0]));
+    TEST_ESP_OK(rtp_fanout_delete(fanout[1]));
+}
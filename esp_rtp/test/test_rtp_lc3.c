@@ -0,0 +1,232 @@
+/**
+ * @file test_rtp_lc3.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-23
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+
+#include "rtp.h"
+#include "rtp_lc3.h"
+#include "rtp_receiver.h"
+
+#define TX_SESSION 1
+#define NUM_PACKETS 10
+#define FRAME_BYTES 40 // 7.5 ms at 32 kbit/s
+#define FRAME_SAMPLES 360 // 7.5 ms at 48 kHz
+
+typedef struct {
+    uint8_t frame; // first byte of the frame, 0xff if lost
+    uint32_t timestamp;
+    rtp_lc3_frame_status_t status;
+} frame_entry_t;
+
+static frame_entry_t frames[3 * NUM_PACKETS];
+static size_t num_frames;
+
+static void on_frame(const uint8_t* frame, uint32_t timestamp, rtp_lc3_frame_status_t status, void* user_ctx)
+{
+    TEST_ASSERT((frame == NULL) == (status == RTP_LC3_FRAME_LOST));
+    frames[num_frames++] = (frame_entry_t) {
+        .frame = frame ? frame[0] : 0xff,
+        .timestamp = timestamp,
+        .status = status,
+    };
+}
+
+/**
+ * @brief Send NUM_PACKETS packets of encoded frames numbered from 0, dropping packets marked in `lost`
+ */
+static void run_stream(const rtp_lc3_config_t* cfg, const bool* lost)
+{
+    rtp_lc3_packer_t packer;
+    rtp_lc3_depacketizer_t depacketizer;
+    uint8_t packet[RTP_HEADER_SIZE + 256];
+    uint8_t payload[256];
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, cfg->redundancy ? cfg->red_payload_type : cfg->payload_type));
+    rtp_session_set_timestamp_inc(TX_SESSION, cfg->frames_per_packet * cfg->frame_samples);
+    TEST_ESP_OK(rtp_lc3_packer_init(&packer, cfg));
+    TEST_ESP_OK(rtp_lc3_depacketizer_init(&depacketizer, cfg, on_frame, NULL));
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(payload), rtp_lc3_payload_size(cfg));
+    num_frames = 0;
+
+    uint8_t frame = 0;
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        size_t payload_length = 0;
+        for (int f = 0; f < cfg->frames_per_packet; f++) {
+            memset(rtp_lc3_packer_next_frame(&packer), frame++, cfg->frame_bytes);
+            payload_length = rtp_lc3_packer_push(&packer, payload, sizeof(payload));
+            TEST_ASSERT_EQUAL_INT(f == cfg->frames_per_packet - 1, payload_length != 0);
+        }
+
+        size_t len = rtp_create_packet(TX_SESSION, payload, payload_length, packet, sizeof(packet));
+        if (!lost[i]) {
+            rtp_packet_t parsed;
+            TEST_ESP_OK(rtp_parse(packet, len, &parsed));
+            TEST_ESP_OK(rtp_lc3_unpack(&depacketizer, &parsed));
+        }
+    }
+
+    rtp_lc3_packer_deinit(&packer);
+    rtp_session_deinit(TX_SESSION);
+}
+
+TEST_CASE("LC3 payload aggregation", "[rtp]")
+{
+    const rtp_lc3_config_t cfg = {
+        .payload_type = 96,
+        .frame_bytes = FRAME_BYTES,
+        .frame_samples = FRAME_SAMPLES,
+        .frames_per_packet = 3,
+    };
+    const bool lost[NUM_PACKETS] = { [4] = true };
+
+    run_stream(&cfg, lost);
+
+    // Frames of the lost packet are reported for concealment
+    TEST_ASSERT_EQUAL_INT(3 * NUM_PACKETS, num_frames);
+    for (int i = 0; i < num_frames; i++) {
+        bool is_lost = i >= 12 && i < 15;
+        TEST_ASSERT_EQUAL_INT(is_lost ? RTP_LC3_FRAME_LOST : RTP_LC3_FRAME_PRIMARY, frames[i].status);
+        TEST_ASSERT_EQUAL_UINT8(is_lost ? 0xff : i, frames[i].frame);
+        TEST_ASSERT_EQUAL_UINT32(frames[0].timestamp + i * FRAME_SAMPLES, frames[i].timestamp);
+    }
+}
+
+TEST_CASE("LC3 payload RFC 2198 redundancy", "[rtp]")
+{
+    const rtp_lc3_config_t cfg = {
+        .payload_type = 96,
+        .red_payload_type = 97,
+        .frame_bytes = FRAME_BYTES,
+        .frame_samples = FRAME_SAMPLES,
+        .frames_per_packet = 2,
+        .redundancy = 2,
+    };
+    // Isolated loss is recovered, of two losses in a row only the second
+    const bool lost[NUM_PACKETS] = { [3] = true, [6] = true, [7] = true };
+
+    run_stream(&cfg, lost);
+
+    TEST_ASSERT_EQUAL_INT(2 * NUM_PACKETS, num_frames);
+    for (int i = 0; i < num_frames; i++) {
+        rtp_lc3_frame_status_t expected = RTP_LC3_FRAME_PRIMARY;
+        if (i == 6 || i == 7 || i == 14 || i == 15) {
+            expected = RTP_LC3_FRAME_RECOVERED;
+        } else if (i == 12 || i == 13) {
+            expected = RTP_LC3_FRAME_LOST;
+        }
+        TEST_ASSERT_EQUAL_INT(expected, frames[i].status);
+        TEST_ASSERT_EQUAL_UINT8(expected == RTP_LC3_FRAME_LOST ? 0xff : i, frames[i].frame);
+        TEST_ASSERT_EQUAL_UINT32(frames[0].timestamp + i * FRAME_SAMPLES, frames[i].timestamp);
+    }
+}
+
+TEST_CASE("LC3 payload RFC 2198 layout", "[rtp]")
+{
+    const rtp_lc3_config_t cfg = {
+        .payload_type = 96,
+        .red_payload_type = 97,
+        .frame_bytes = 4,
+        .frame_samples = FRAME_SAMPLES,
+        .frames_per_packet = 1,
+        .redundancy = 3,
+    };
+    rtp_lc3_packer_t packer;
+    uint8_t payload[32];
+
+    TEST_ESP_OK(rtp_lc3_packer_init(&packer, &cfg));
+
+    // First packet has no history: primary header only
+    memset(rtp_lc3_packer_next_frame(&packer), 1, 4);
+    TEST_ASSERT_EQUAL_INT(1 + 4, rtp_lc3_packer_push(&packer, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_HEX8(96, payload[0]);
+
+    memset(rtp_lc3_packer_next_frame(&packer), 2, 4);
+    rtp_lc3_packer_push(&packer, payload, sizeof(payload));
+    memset(rtp_lc3_packer_next_frame(&packer), 3, 4);
+    rtp_lc3_packer_push(&packer, payload, sizeof(payload));
+    memset(rtp_lc3_packer_next_frame(&packer), 4, 4);
+    TEST_ASSERT_EQUAL_INT(4 + 1 + 3 * 4 + 4, rtp_lc3_packer_push(&packer, payload, sizeof(payload)));
+
+    // F=1 PT=96, offset 3 * 360, length 12, then F=0 PT=96
+    const uint8_t expected[] = { 0xe0, (1080 >> 6), ((1080 << 2) & 0xff) | 0, 12, 96, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4 };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, payload, sizeof(expected));
+
+    // Oldest frame leaves the history
+    memset(rtp_lc3_packer_next_frame(&packer), 5, 4);
+    rtp_lc3_packer_push(&packer, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL_UINT8(2, payload[5]);
+    TEST_ASSERT_EQUAL_UINT8(5, payload[17]);
+
+    // Offset does not fit 14 bits
+    rtp_lc3_config_t too_long = cfg;
+    too_long.frame_samples = 8000;
+    TEST_ESP_ERR(rtp_lc3_packer_init(&packer, &too_long), ESP_ERR_INVALID_ARG);
+
+    rtp_lc3_packer_deinit(&packer);
+}
+
+TEST_CASE("LC3 payload misaligned timestamp", "[rtp]")
+{
+    const rtp_lc3_config_t cfg = {
+        .payload_type = 96,
+        .red_payload_type = 97,
+        .frame_bytes = 4,
+        .frame_samples = FRAME_SAMPLES,
+        .frames_per_packet = 1,
+        .redundancy = 1,
+    };
+    rtp_lc3_depacketizer_t depacketizer;
+    rtp_packet_t packet = { .header.payload_type = 96 };
+    uint8_t payload[4 + 1 + 2 * 4];
+
+    TEST_ESP_OK(rtp_lc3_depacketizer_init(&depacketizer, &cfg, on_frame, NULL));
+    num_frames = 0;
+    packet.payload = payload;
+    packet.payload_length = 4;
+
+    memset(payload, 0, 4);
+    packet.header.timestamp = 1000;
+    TEST_ESP_OK(rtp_lc3_unpack(&depacketizer, &packet));
+
+    // Off the frame grid, a few samples ahead: the stream restarts without lost frames
+    memset(payload, 1, 4);
+    packet.header.timestamp = 1000 + FRAME_SAMPLES + 100;
+    TEST_ESP_OK(rtp_lc3_unpack(&depacketizer, &packet));
+    memset(payload, 2, 4);
+    packet.header.timestamp += FRAME_SAMPLES;
+    TEST_ESP_OK(rtp_lc3_unpack(&depacketizer, &packet));
+
+    TEST_ASSERT_EQUAL_INT(3, num_frames);
+    TEST_ASSERT_EQUAL_UINT32(0, depacketizer.stats.lost);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(RTP_LC3_FRAME_PRIMARY, frames[i].status);
+        TEST_ASSERT_EQUAL_UINT8(i, frames[i].frame);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1000 + 2 * FRAME_SAMPLES + 100, frames[2].timestamp);
+
+    // Redundant block with a bogus offset is dropped, the primary frame is delivered
+    const uint8_t red[] = { 0xe0, 0, (7 << 2), 4, 96, 5, 5, 5, 5, 4, 4, 4, 4 };
+    memcpy(payload, red, sizeof(red));
+    packet.header.payload_type = 97;
+    packet.header.timestamp += 2 * FRAME_SAMPLES;
+    packet.payload_length = sizeof(red);
+    TEST_ESP_OK(rtp_lc3_unpack(&depacketizer, &packet));
+
+    TEST_ASSERT_EQUAL_UINT32(1, depacketizer.stats.invalid);
+    TEST_ASSERT_EQUAL_INT(5, num_frames);
+    TEST_ASSERT_EQUAL_INT(RTP_LC3_FRAME_LOST, frames[3].status);
+    TEST_ASSERT_EQUAL_INT(RTP_LC3_FRAME_PRIMARY, frames[4].status);
+    TEST_ASSERT_EQUAL_UINT8(4, frames[4].frame);
+}
@@ -0,0 +1,194 @@
+/**
+ * @file test_rtp_pcap.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "rtp.h"
+#include "rtp_pcap.h"
+
+#define TX_SESSION 1
+#define PAYLOAD_SIZE 100
+#define SNAPLEN (RTP_PCAP_IP_UDP_HEADER_SIZE + RTP_HEADER_SIZE + 8)
+
+static uint8_t dump[1024];
+static size_t dump_len;
+
+static void dump_write(const void* data, size_t len, void* user_ctx)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(dump), dump_len + len);
+    memcpy(&dump[dump_len], data, len);
+    dump_len += len;
+}
+
+// Stream sink stalling like a slow FAT volume
+static void slow_write(const void* data, size_t len, void* user_ctx)
+{
+    vTaskDelay(pdMS_TO_TICKS(20));
+    rtp_pcap_file_write(data, len, user_ctx);
+}
+
+static uint32_t get32(const uint8_t* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+TEST_CASE("pcap capture into ring", "[rtp]")
+{
+    const rtp_pcap_config_t cfg = {
+        .sink = RTP_PCAP_SINK_RING,
+        .ring_size = 5 * (RTP_PCAP_RECORD_HEADER_SIZE + SNAPLEN) + 10,
+        .snaplen = SNAPLEN,
+        .session_mask = 1 << TX_SESSION,
+        .directions = RTP_PCAP_TX,
+    };
+    const struct sockaddr_in peer = {
+        .sin_family = AF_INET,
+        .sin_addr.s_addr = htonl(0xc0a80002), // 192.168.0.2
+        .sin_port = htons(6000),
+    };
+    uint8_t payload[PAYLOAD_SIZE] = { 0 };
+    uint8_t packet[RTP_HEADER_SIZE + PAYLOAD_SIZE];
+    uint16_t seq[10];
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    TEST_ESP_OK(rtp_pcap_start(&cfg));
+    TEST_ESP_ERR(rtp_pcap_start(&cfg), ESP_ERR_INVALID_STATE);
+
+    for (int i = 0; i < 10; i++) {
+        size_t len = rtp_create_packet(TX_SESSION, payload, sizeof(payload), packet, sizeof(packet));
+        seq[i] = (packet[2] << 8) | packet[3];
+        rtp_pcap_capture(TX_SESSION, RTP_PCAP_TX, packet, len, &peer);
+        // Filtered by session and direction
+        rtp_pcap_capture(TX_SESSION + 1, RTP_PCAP_TX, packet, len, &peer);
+        rtp_pcap_capture(TX_SESSION, RTP_PCAP_RX, packet, len, &peer);
+    }
+
+    rtp_pcap_stats_t stats;
+    rtp_pcap_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.captured);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.overwritten);
+
+    dump_len = 0;
+    TEST_ESP_OK(rtp_pcap_dump(dump_write, NULL));
+    TEST_ASSERT_EQUAL_INT(24 + 5 * (RTP_PCAP_RECORD_HEADER_SIZE + SNAPLEN), dump_len);
+    TEST_ASSERT_EQUAL_HEX32(0xa1b2c3d4, get32(&dump[0]));
+    TEST_ASSERT_EQUAL_UINT32(SNAPLEN, get32(&dump[16]));
+    TEST_ASSERT_EQUAL_UINT32(RTP_PCAP_LINKTYPE_IPV4, get32(&dump[20]));
+
+    // Newest 5 packets remain, truncated to the snap length
+    const uint8_t* r = &dump[24];
+    for (int i = 5; i < 10; i++, r += RTP_PCAP_RECORD_HEADER_SIZE + SNAPLEN) {
+        TEST_ASSERT_EQUAL_UINT32(SNAPLEN, get32(&r[8]));
+        TEST_ASSERT_EQUAL_UINT32(RTP_PCAP_IP_UDP_HEADER_SIZE + sizeof(packet), get32(&r[12]));
+
+        const uint8_t* ip = &r[RTP_PCAP_RECORD_HEADER_SIZE];
+        TEST_ASSERT_EQUAL_HEX8(0x45, ip[0]);
+        TEST_ASSERT_EQUAL_UINT8(IPPROTO_UDP, ip[9]);
+        uint32_t sum = 0;
+        for (int b = 0; b < 20; b += 2) {
+            sum += (ip[b] << 8) | ip[b + 1];
+        }
+        TEST_ASSERT_EQUAL_HEX16(0xffff, (sum & 0xffff) + (sum >> 16));
+        TEST_ASSERT_EQUAL_HEX8(192, ip[16]);
+        TEST_ASSERT_EQUAL_UINT16(6000, (ip[22] << 8) | ip[23]);
+
+        const uint8_t* rtp = &ip[RTP_PCAP_IP_UDP_HEADER_SIZE];
+        TEST_ASSERT_EQUAL_UINT16(seq[i], (rtp[2] << 8) | rtp[3]);
+    }
+
+    TEST_ESP_OK(rtp_pcap_stop());
+    rtp_session_deinit(TX_SESSION);
+}
+
+TEST_CASE("pcap capture to file", "[rtp]")
+{
+    FILE* f = tmpfile();
+    TEST_ASSERT_NOT_NULL(f);
+    const rtp_pcap_config_t cfg = {
+        .sink = RTP_PCAP_SINK_STREAM,
+        .write = rtp_pcap_file_write,
+        .user_ctx = f,
+        .session_mask = RTP_PCAP_ALL_SESSIONS,
+        .directions = RTP_PCAP_TX | RTP_PCAP_RX,
+    };
+    uint8_t payload[PAYLOAD_SIZE] = { 0 };
+    uint8_t header[RTP_HEADER_MAX_SIZE];
+    struct iovec iov[2];
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    TEST_ESP_OK(rtp_pcap_start(&cfg));
+    for (int i = 0; i < 3; i++) {
+        rtp_create_iovec(TX_SESSION, header, payload, sizeof(payload), iov);
+        rtp_pcap_capture_iovec(TX_SESSION, RTP_PCAP_TX, iov, 2, NULL);
+    }
+    TEST_ESP_OK(rtp_pcap_stop());
+    rtp_pcap_capture_iovec(TX_SESSION, RTP_PCAP_TX, iov, 2, NULL); // not capturing
+    TEST_ESP_ERR(rtp_pcap_dump(dump_write, NULL), ESP_ERR_INVALID_STATE);
+
+    // Full packets, no snap length
+    long size = ftell(f);
+    TEST_ASSERT_EQUAL_INT(24 + 3 * (RTP_PCAP_RECORD_HEADER_SIZE + RTP_PCAP_IP_UDP_HEADER_SIZE + RTP_HEADER_SIZE + PAYLOAD_SIZE), size);
+
+    fclose(f);
+    rtp_session_deinit(TX_SESSION);
+}
+
+TEST_CASE("pcap stream sink does not block capture", "[rtp]")
+{
+    FILE* f = tmpfile();
+    TEST_ASSERT_NOT_NULL(f);
+    const rtp_pcap_config_t cfg = {
+        .sink = RTP_PCAP_SINK_STREAM,
+        .ring_size = 1024,
+        .write = slow_write,
+        .user_ctx = f,
+        .task_priority = 1,
+        .session_mask = RTP_PCAP_ALL_SESSIONS,
+        .directions = RTP_PCAP_TX,
+    };
+    uint8_t payload[PAYLOAD_SIZE] = { 0 };
+    uint8_t header[RTP_HEADER_MAX_SIZE];
+    struct iovec iov[2];
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    TEST_ESP_OK(rtp_pcap_start(&cfg));
+
+    // Capture only copies into the buffer, while the writer stalls 20 ms per write
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < 50; i++) {
+        rtp_create_iovec(TX_SESSION, header, payload, sizeof(payload), iov);
+        rtp_pcap_capture_iovec(TX_SESSION, RTP_PCAP_TX, iov, 2, NULL);
+    }
+    TEST_ASSERT_LESS_THAN(20000, esp_timer_get_time() - start);
+
+    TEST_ESP_OK(rtp_pcap_stop());
+    rtp_pcap_stats_t stats;
+    rtp_pcap_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(50, stats.captured + stats.dropped);
+    TEST_ASSERT_GREATER_THAN(0, stats.dropped);
+
+    // Every captured record is written out by stop
+    TEST_ASSERT_EQUAL_INT(24 + stats.bytes, ftell(f));
+
+    fclose(f);
+    rtp_session_deinit(TX_SESSION);
+}
@@ -0,0 +1,228 @@
+/**
+ * @file test_rtp_receiver.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-02
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+
+#include "rtp.h"
+#include "rtp_receiver.h"
+
+#define RX_SESSION 2
+
+typedef struct {
+    uint16_t seq;
+    uint32_t timestamp;
+    uint32_t arrival_us;
+} trace_entry_t;
+
+/*
+ * 48 kHz / 10 ms stream, starting just before the sequence number wraps:
+ * - 65533 and 65534 swapped
+ * - 3 lost
+ * - 5 delayed by 2 ms
+ * - 7 received twice
+ * - 9 arrives after 10..17, too late for the reorder window
+ */
+static const trace_entry_t trace[] = {
+    { 65530, 1000, 0 },
+    { 65531, 1480, 10000 },
+    { 65532, 1960, 20000 },
+    { 65534, 2920, 40000 },
+    { 65533, 2440, 40100 },
+    { 65535, 3400, 50000 },
+    { 0, 3880, 60000 },
+    { 1, 4360, 70000 },
+    { 2, 4840, 80000 },
+    { 4, 5800, 100000 },
+    { 5, 6280, 112000 },
+    { 6, 6760, 120000 },
+    { 7, 7240, 130000 },
+    { 7, 7240, 130500 },
+    { 8, 7720, 140000 },
+    { 10, 8680, 160000 },
+    { 11, 9160, 170000 },
+    { 12, 9640, 180000 },
+    { 13, 10120, 190000 },
+    { 14, 10600, 200000 },
+    { 15, 11080, 210000 },
+    { 16, 11560, 220000 },
+    { 17, 12040, 230000 },
+    { 9, 8200, 231000 },
+    { 18, 12520, 240000 },
+};
+
+#define TRACE_LEN (sizeof(trace) / sizeof(trace[0]))
+
+static uint8_t packets[TRACE_LEN][RTP_HEADER_SIZE + 4];
+static uint16_t delivered[TRACE_LEN];
+static size_t num_delivered;
+
+static size_t write_packet(uint8_t* p, uint16_t seq, uint32_t ts, uint32_t ssrc)
+{
+    p[0] = 0x80;
+    p[1] = 96;
+    p[2] = seq >> 8;
+    p[3] = seq;
+    p[4] = ts >> 24;
+    p[5] = ts >> 16;
+    p[6] = ts >> 8;
+    p[7] = ts;
+    p[8] = ssrc >> 24;
+    p[9] = ssrc >> 16;
+    p[10] = ssrc >> 8;
+    p[11] = ssrc;
+    memcpy(&p[RTP_HEADER_SIZE], &seq, sizeof(seq));
+    return RTP_HEADER_SIZE + 4;
+}
+
+static void on_packet(uint8_t session, const rtp_packet_t* packet, void* user_ctx)
+{
+    TEST_ASSERT_EQUAL_INT(RX_SESSION, session);
+    TEST_ASSERT_EQUAL_UINT16(packet->header.sequence_number, *(uint16_t*)packet->payload);
+    delivered[num_delivered++] = packet->header.sequence_number;
+}
+
+TEST_CASE("Parse RTP packet", "[rtp]")
+{
+    // V=2 P=1 X=1 CC=1, M=1 PT=96, one-byte extension id 3 with 2 bytes, 2 payload bytes, 2 padding bytes
+    const uint8_t buf[] = {
+        0xb1, 0xe0, 0x12, 0x34, 0x00, 0x00, 0x01, 0x00, 0xde, 0xad, 0xbe, 0xef,
+        0x01, 0x02, 0x03, 0x04,
+        0xbe, 0xde, 0x00, 0x01, 0x31, 0xaa, 0xbb, 0x00,
+        0x55, 0x66,
+        0x00, 0x02
+    };
+    rtp_packet_t packet;
+
+    TEST_ESP_OK(rtp_parse(buf, sizeof(buf), &packet));
+    TEST_ASSERT_EQUAL_INT(1, packet.header.marker);
+    TEST_ASSERT_EQUAL_INT(96, packet.header.payload_type);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, packet.header.sequence_number);
+    TEST_ASSERT_EQUAL_HEX32(0x100, packet.header.timestamp);
+    TEST_ASSERT_EQUAL_HEX32(0xdeadbeef, packet.header.ssrc);
+    TEST_ASSERT(packet.csrc == &buf[12]);
+    TEST_ASSERT_EQUAL_HEX16(RTP_EXT_PROFILE_ONE_BYTE, packet.ext_profile);
+    TEST_ASSERT_EQUAL_INT(4, packet.ext_length);
+    TEST_ASSERT(packet.payload == &buf[24]);
+    TEST_ASSERT_EQUAL_INT(2, packet.payload_length);
+
+    const uint8_t* data;
+    size_t length;
+    TEST_ESP_OK(rtp_packet_get_extension(&packet, 3, &data, &length));
+    TEST_ASSERT_EQUAL_INT(2, length);
+    TEST_ASSERT(data == &buf[21]);
+    TEST_ESP_ERR(rtp_packet_get_extension(&packet, 4, &data, &length), ESP_ERR_NOT_FOUND);
+
+    TEST_ESP_ERR(rtp_parse(buf, RTP_HEADER_SIZE - 1, &packet), ESP_ERR_INVALID_SIZE);
+    TEST_ESP_ERR(rtp_parse(buf, 18, &packet), ESP_ERR_INVALID_SIZE);
+    const uint8_t v1[RTP_HEADER_SIZE] = { 0x40 };
+    TEST_ESP_ERR(rtp_parse(v1, sizeof(v1), &packet), ESP_ERR_INVALID_VERSION);
+}
+
+TEST_CASE("Receive packet trace", "[rtp]")
+{
+    rtp_receiver_config_t cfg = {
+        .clock_rate = 48000,
+        .on_packet = on_packet,
+    };
+    rtp_receiver_stats_t stats;
+
+    TEST_ESP_OK(rtp_session_init(RX_SESSION, 96));
+    TEST_ESP_OK(rtp_receiver_init(RX_SESSION, &cfg));
+    num_delivered = 0;
+
+    for (int i = 0; i < TRACE_LEN; i++) {
+        size_t len = write_packet(packets[i], trace[i].seq, trace[i].timestamp, 0x11223344);
+        esp_err_t err = rtp_receive_at(RX_SESSION, packets[i], len, trace[i].arrival_us);
+        if (i == 13 || i == 23) { // duplicate of 7, 9 too late
+            TEST_ESP_ERR(err, ESP_ERR_INVALID_STATE);
+        } else {
+            TEST_ESP_OK(err);
+        }
+    }
+
+    // Foreign SSRC is rejected
+    uint8_t foreign[RTP_HEADER_SIZE + 4];
+    TEST_ESP_ERR(rtp_receive_at(RX_SESSION, foreign, write_packet(foreign, 19, 13000, 0x55667788), 250000), ESP_ERR_INVALID_STATE);
+
+    rtp_receiver_flush(RX_SESSION);
+
+    const uint16_t expected[] = { 65530, 65531, 65532, 65533, 65534, 65535, 0, 1, 2, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18 };
+    TEST_ASSERT_EQUAL_INT(sizeof(expected) / sizeof(expected[0]), num_delivered);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, delivered, sizeof(expected));
+
+    TEST_ESP_OK(rtp_receiver_get_stats(RX_SESSION, &stats));
+    TEST_ASSERT_EQUAL_HEX32(0x11223344, stats.ssrc);
+    TEST_ASSERT_EQUAL_UINT32(0x10000 + 18, stats.extended_max_seq);
+    TEST_ASSERT_EQUAL_UINT32(TRACE_LEN, stats.received);
+    TEST_ASSERT_EQUAL_INT(0, stats.lost); // 25 expected and 25 received: 3 lost, 7 counted twice (RFC 3550 A.3)
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reordered);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.late);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.skipped);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.invalid);
+
+    // Reference interarrival jitter in floating point
+    double jitter = 0;
+    for (int i = 1; i < TRACE_LEN; i++) {
+        double d = (trace[i].arrival_us - trace[i - 1].arrival_us) * 0.048 - ((int32_t)trace[i].timestamp - (int32_t)trace[i - 1].timestamp);
+        jitter += ((d < 0 ? -d : d) - jitter) / 16;
+    }
+    TEST_ASSERT_INT_WITHIN(2, (int)jitter, stats.jitter);
+
+    // Loss fraction is reported per interval
+    static uint8_t buf[10][RTP_HEADER_SIZE + 4];
+    for (int seq = 19; seq < 29; seq++) {
+        if (seq != 21 && seq != 22) {
+            uint8_t* p = buf[seq - 19];
+            TEST_ESP_OK(rtp_receive_at(RX_SESSION, p, write_packet(p, seq, 12520 + 480 * (seq - 18), 0x11223344), 240000 + 10000 * (seq - 18)));
+        }
+    }
+    rtp_receiver_flush(RX_SESSION);
+    TEST_ESP_OK(rtp_receiver_get_stats(RX_SESSION, &stats));
+    TEST_ASSERT_EQUAL_INT(2, stats.lost);
+    TEST_ASSERT_EQUAL_UINT8((2 << 8) / 10, stats.fraction_lost);
+
+    rtp_session_deinit(RX_SESSION);
+}
+
+TEST_CASE("Receive sequence restart", "[rtp]")
+{
+    rtp_receiver_config_t cfg = {
+        .clock_rate = 48000,
+        .on_packet = on_packet,
+    };
+    uint8_t buf[4][RTP_HEADER_SIZE + 4];
+
+    TEST_ESP_OK(rtp_session_init(RX_SESSION, 96));
+    TEST_ESP_OK(rtp_receiver_init(RX_SESSION, &cfg));
+    num_delivered = 0;
+
+    TEST_ESP_OK(rtp_receive_at(RX_SESSION, buf[0], write_packet(buf[0], 100, 0, 1), 0));
+    TEST_ESP_OK(rtp_receive_at(RX_SESSION, buf[1], write_packet(buf[1], 101, 480, 1), 10000));
+    // A single large jump is dropped, a second sequential packet restarts the sequence
+    TEST_ESP_ERR(rtp_receive_at(RX_SESSION, buf[2], write_packet(buf[2], 20000, 960, 1), 20000), ESP_ERR_INVALID_STATE);
+    TEST_ESP_OK(rtp_receive_at(RX_SESSION, buf[3], write_packet(buf[3], 20001, 1440, 1), 30000));
+
+    TEST_ASSERT_EQUAL_INT(3, num_delivered);
+    TEST_ASSERT_EQUAL_UINT16(20001, delivered[2]);
+
+    rtp_receiver_stats_t stats;
+    TEST_ESP_OK(rtp_receiver_get_stats(RX_SESSION, &stats));
+    TEST_ASSERT_EQUAL_UINT32(20001, stats.extended_max_seq);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.received);
+    TEST_ASSERT_EQUAL_INT(0, stats.lost);
+
+    rtp_session_deinit(RX_SESSION);
+}
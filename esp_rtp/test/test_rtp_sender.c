@@ -0,0 +1,161 @@
+/**
+ * @file test_rtp_sender.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-03-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "lwip/sockets.h"
+
+#include "rtp.h"
+#include "rtp_sender.h"
+
+#define TX_SESSION 1
+#define NUM_PACKETS 20
+#define FRAME_SAMPLES 480 // 10 ms at 48 kHz
+
+static int open_receiver(struct sockaddr_in* addr)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sin_family = AF_INET;
+    addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(sock, (struct sockaddr*)addr, sizeof(*addr));
+
+    socklen_t len = sizeof(*addr);
+    getsockname(sock, (struct sockaddr*)addr, &len);
+
+    struct timeval timeout = { .tv_sec = 1 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return sock;
+}
+
+TEST_CASE("Paced RTP sender over loopback UDP", "[rtp]")
+{
+    struct sockaddr_in rx_addr;
+    int rx_sock = open_receiver(&rx_addr);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, rx_sock);
+
+    rtp_sender_config_t cfg = {
+        .destination = rx_addr,
+        .clock_rate = 48000,
+        .queue_len = 32,
+        .payload_size_max = 240,
+        .max_burst = 4,
+        .task_priority = 5,
+        .task_core = 0,
+    };
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    rtp_session_set_timestamp_inc(TX_SESSION, FRAME_SAMPLES);
+    TEST_ESP_OK(rtp_sender_start(TX_SESSION, &cfg));
+
+    // Queue a whole burst at once, the sender spreads it out following the media timestamps
+    uint8_t payload[240];
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        memset(payload, i, sizeof(payload));
+        if (i % 2) {
+            TEST_ESP_OK(rtp_sender_send(TX_SESSION, payload, sizeof(payload)));
+        } else {
+            uint8_t* buf = rtp_sender_acquire(TX_SESSION);
+            TEST_ASSERT_NOT_NULL(buf);
+            memcpy(buf, payload, sizeof(payload));
+            TEST_ESP_OK(rtp_sender_commit(TX_SESSION, sizeof(payload)));
+        }
+    }
+
+    int64_t first_us = 0;
+    int64_t last_us = 0;
+    uint16_t first_seq = 0;
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        uint8_t packet[300];
+        int n = recv(rx_sock, packet, sizeof(packet), 0);
+        TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + sizeof(payload), n);
+        uint16_t seq = (packet[2] << 8) | packet[3];
+        if (i == 0) {
+            first_seq = seq;
+            first_us = esp_timer_get_time();
+        }
+        TEST_ASSERT_EQUAL_UINT16((uint16_t)(first_seq + i), seq);
+        TEST_ASSERT_EQUAL_UINT8(i, packet[RTP_HEADER_SIZE]);
+        last_us = esp_timer_get_time();
+    }
+
+    // 20 frames of 10 ms take 190 ms from first to last
+    TEST_ASSERT_INT_WITHIN(20000, (NUM_PACKETS - 1) * 10000, last_us - first_us);
+
+    // Statistics are updated after the packet is handed to the socket
+    vTaskDelay(pdMS_TO_TICKS(10));
+    rtp_sender_stats_t stats;
+    TEST_ESP_OK(rtp_sender_get_stats(TX_SESSION, &stats));
+    TEST_ASSERT_EQUAL_UINT32(NUM_PACKETS, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(NUM_PACKETS * (RTP_HEADER_SIZE + sizeof(payload)), stats.bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.send_errors);
+    TEST_ASSERT_LESS_OR_EQUAL(stats.latency_max_us, stats.latency_avg_us);
+    TEST_ASSERT_GREATER_OR_EQUAL((NUM_PACKETS - 2) * 10000, stats.latency_max_us);
+    printf("latency min/avg/max: %u/%u/%u us, %u batches, %u late\n", stats.latency_min_us,
+           stats.latency_avg_us, stats.latency_max_us, stats.batches, stats.late);
+
+    TEST_ESP_OK(rtp_sender_stop(TX_SESSION));
+    rtp_session_deinit(TX_SESSION);
+    close(rx_sock);
+}
+
+TEST_CASE("RTP sender queue full", "[rtp]")
+{
+    struct sockaddr_in rx_addr;
+    int rx_sock = open_receiver(&rx_addr);
+
+    rtp_sender_config_t cfg = {
+        .destination = rx_addr,
+        .clock_rate = 48000,
+        .queue_len = 4,
+        .payload_size_max = 64,
+        .task_priority = 5,
+    };
+
+    TEST_ESP_OK(rtp_session_init(TX_SESSION, 96));
+    rtp_session_set_timestamp_inc(TX_SESSION, FRAME_SAMPLES);
+    TEST_ESP_ERR(rtp_sender_start(TX_SESSION, &(rtp_sender_config_t) { .clock_rate = 48000, .queue_len = 3, .payload_size_max = 64 }), ESP_ERR_INVALID_ARG);
+    TEST_ESP_OK(rtp_sender_start(TX_SESSION, &cfg));
+
+    uint8_t payload[64] = { 0 };
+    int queued = 0;
+    for (int i = 0; i < 10; i++) {
+        if (rtp_sender_send(TX_SESSION, payload, sizeof(payload)) == ESP_OK) {
+            queued++;
+        }
+    }
+    TEST_ESP_ERR(rtp_sender_send(TX_SESSION, payload, 65), ESP_ERR_INVALID_SIZE);
+    // Committing into the full queue must not overwrite a queued packet
+    TEST_ESP_ERR(rtp_sender_commit(TX_SESSION, sizeof(payload)), ESP_ERR_INVALID_STATE);
+    // The first packet is sent right away, the rest wait for their due time
+    TEST_ASSERT_LESS_OR_EQUAL(5, queued);
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+    rtp_sender_stats_t stats;
+    TEST_ESP_OK(rtp_sender_get_stats(TX_SESSION, &stats));
+    TEST_ASSERT_EQUAL_UINT32(queued, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(10 - queued, stats.dropped);
+
+    TEST_ESP_OK(rtp_sender_stop(TX_SESSION));
+    TEST_ASSERT_EQUAL_INT(-1, rtp_sender_get_socket(TX_SESSION));
+    rtp_session_deinit(TX_SESSION);
+    close(rx_sock);
+}
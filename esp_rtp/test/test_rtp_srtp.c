@@ -0,0 +1,196 @@
+/**
+ * @file test_rtp_srtp.c
+ * @author Kasper Nyhus Kaae (KANK)
+ * @brief
+ * @version 0.1
+ * @date 2024-04-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <limits.h>
+#include <string.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "rtp.h"
+#include "rtp_srtp.h"
+
+#define RTP_BENCH_PACKETS 10000
+#define RTP_BENCH_PAYLOAD 240
+
+// RFC 3711 B.3 master key and salt
+static const uint8_t master_key[] = {
+    0xe1, 0xf9, 0x7a, 0x0d, 0x3e, 0x01, 0x8b, 0xe0, 0xd6, 0x4f, 0xa3, 0x2c, 0x06, 0xde, 0x41, 0x39
+};
+static const uint8_t master_salt[] = {
+    0x0e, 0xc6, 0x75, 0xad, 0x49, 0x8a, 0xfe, 0xeb, 0xb6, 0x96, 0x0b, 0x3a, 0xab, 0xe6
+};
+
+// RTP header, SSRC 0xcafebabe, seq 0x1234, payload 16 x 0xab
+static const uint8_t plaintext[] = {
+    0x80, 0x0f, 0x12, 0x34, 0xde, 0xca, 0xfb, 0xad, 0xca, 0xfe, 0xba, 0xbe,
+    0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab, 0xab
+};
+
+// Session keys from the RFC 3711 B.3 derivation: cipher key c61e7a93..., salt 30cbbc08..., auth key cebe321f...
+static const uint8_t ciphertext_cm[] = {
+    0x80, 0x0f, 0x12, 0x34, 0xde, 0xca, 0xfb, 0xad, 0xca, 0xfe, 0xba, 0xbe,
+    0x4e, 0x55, 0xdc, 0x4c, 0xe7, 0x99, 0x78, 0xd8, 0x8c, 0xa4, 0xd2, 0x15, 0x94, 0x9d, 0x24, 0x02,
+    0xb7, 0x8d, 0x6a, 0xcc, 0x99, 0xea, 0x17, 0x9b, 0x8d, 0xbb
+};
+
+// AEAD-GCM interop vector, master key 00..0f, master salt a0..ab
+static const uint8_t gcm_master_key[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t gcm_master_salt[] = {
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab
+};
+static const uint8_t ciphertext_gcm[] = {
+    0x80, 0x0f, 0x12, 0x34, 0xde, 0xca, 0xfb, 0xad, 0xca, 0xfe, 0xba, 0xbe,
+    0xc5, 0x00, 0x2e, 0xde, 0x04, 0xcf, 0xdd, 0x2e, 0xb9, 0x11, 0x59, 0xe0, 0x88, 0x0a, 0xa0, 0x6e,
+    0xd2, 0x97, 0x68, 0x26, 0xf7, 0x96, 0xb2, 0x01, 0xdf, 0x31, 0x31, 0xa1, 0x27, 0xe8, 0xa3, 0x92
+};
+
+TEST_CASE("SRTP AES-CM HMAC-SHA1-80 test vector", "[rtp]")
+{
+    rtp_srtp_t tx;
+    rtp_srtp_t rx;
+    uint8_t packet[sizeof(plaintext) + RTP_SRTP_TRAILER_MAX];
+
+    TEST_ESP_OK(rtp_srtp_init(&tx, RTP_SRTP_AES128_CM_HMAC_SHA1_80, master_key, master_salt));
+    TEST_ESP_OK(rtp_srtp_init(&rx, RTP_SRTP_AES128_CM_HMAC_SHA1_80, master_key, master_salt));
+
+    memcpy(packet, plaintext, sizeof(plaintext));
+    TEST_ASSERT_EQUAL_INT(0, rtp_srtp_protect(&tx, packet, sizeof(plaintext), sizeof(plaintext) + 9));
+    TEST_ASSERT_EQUAL_INT(sizeof(ciphertext_cm), rtp_srtp_protect(&tx, packet, sizeof(plaintext), sizeof(packet)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ciphertext_cm, packet, sizeof(ciphertext_cm));
+
+    size_t len;
+    TEST_ESP_OK(rtp_srtp_unprotect(&rx, packet, sizeof(ciphertext_cm), &len));
+    TEST_ASSERT_EQUAL_INT(sizeof(plaintext), len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(plaintext, packet, sizeof(plaintext));
+
+    // Replayed packet is rejected
+    memcpy(packet, ciphertext_cm, sizeof(ciphertext_cm));
+    TEST_ESP_ERR(rtp_srtp_unprotect(&rx, packet, sizeof(ciphertext_cm), &len), ESP_ERR_INVALID_STATE);
+    TEST_ASSERT_EQUAL_UINT32(1, rx.replayed);
+
+    // Tampered packet is rejected
+    memcpy(packet, ciphertext_cm, sizeof(ciphertext_cm));
+    packet[3] = 0x35;
+    packet[20] ^= 1;
+    TEST_ESP_ERR(rtp_srtp_unprotect(&rx, packet, sizeof(ciphertext_cm), &len), ESP_ERR_INVALID_MAC);
+    TEST_ASSERT_EQUAL_UINT32(1, rx.auth_failures);
+
+    rtp_srtp_deinit(&tx);
+    rtp_srtp_deinit(&rx);
+}
+
+TEST_CASE("SRTP AEAD-GCM test vector", "[rtp]")
+{
+    rtp_srtp_t tx;
+    rtp_srtp_t rx;
+    uint8_t packet[sizeof(plaintext) + RTP_SRTP_TRAILER_MAX];
+    size_t len;
+
+    TEST_ESP_OK(rtp_srtp_init(&tx, RTP_SRTP_AEAD_AES_128_GCM, gcm_master_key, gcm_master_salt));
+    TEST_ESP_OK(rtp_srtp_init(&rx, RTP_SRTP_AEAD_AES_128_GCM, gcm_master_key, gcm_master_salt));
+
+    memcpy(packet, plaintext, sizeof(plaintext));
+    TEST_ASSERT_EQUAL_INT(sizeof(ciphertext_gcm), rtp_srtp_protect(&tx, packet, sizeof(plaintext), sizeof(packet)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ciphertext_gcm, packet, sizeof(ciphertext_gcm));
+
+    uint8_t copy[sizeof(packet)];
+    memcpy(copy, packet, sizeof(packet));
+    copy[1] ^= 1; // header is authenticated too
+    TEST_ESP_ERR(rtp_srtp_unprotect(&rx, copy, sizeof(ciphertext_gcm), &len), ESP_ERR_INVALID_MAC);
+
+    TEST_ESP_OK(rtp_srtp_unprotect(&rx, packet, sizeof(ciphertext_gcm), &len));
+    TEST_ASSERT_EQUAL_INT(sizeof(plaintext), len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(plaintext, packet, sizeof(plaintext));
+
+    rtp_srtp_deinit(&tx);
+    rtp_srtp_deinit(&rx);
+}
+
+TEST_CASE("SRTP rollover and replay window", "[rtp]")
+{
+    rtp_srtp_t tx;
+    rtp_srtp_t rx;
+    static uint8_t packets[8][RTP_HEADER_SIZE + 4 + RTP_SRTP_TRAILER_MAX];
+    size_t lens[8];
+    size_t len;
+
+    TEST_ESP_OK(rtp_srtp_init(&tx, RTP_SRTP_AES128_CM_HMAC_SHA1_80, master_key, master_salt));
+    TEST_ESP_OK(rtp_srtp_init(&rx, RTP_SRTP_AES128_CM_HMAC_SHA1_80, master_key, master_salt));
+
+    // Sequence numbers cross the wrap, the rollover counter must follow on both sides
+    for (int i = 0; i < 8; i++) {
+        uint16_t seq = 65532 + i;
+        memcpy(packets[i], plaintext, RTP_HEADER_SIZE);
+        packets[i][2] = seq >> 8;
+        packets[i][3] = seq;
+        memset(&packets[i][RTP_HEADER_SIZE], i, 4);
+        lens[i] = rtp_srtp_protect(&tx, packets[i], RTP_HEADER_SIZE + 4, sizeof(packets[i]));
+        TEST_ASSERT_EQUAL_INT(RTP_HEADER_SIZE + 4 + RTP_SRTP_HMAC_TAG_SIZE, lens[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, tx.roc);
+
+    // Deliver out of order around the wrap
+    const int order[] = { 0, 1, 3, 2, 5, 4, 7, 6 };
+    for (int i = 0; i < 8; i++) {
+        TEST_ESP_OK(rtp_srtp_unprotect(&rx, packets[order[i]], lens[order[i]], &len));
+        TEST_ASSERT_EQUAL_UINT8(order[i], packets[order[i]][RTP_HEADER_SIZE]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, rx.roc);
+    TEST_ASSERT_EQUAL_UINT32(0, rx.auth_failures);
+
+    rtp_srtp_deinit(&tx);
+    rtp_srtp_deinit(&rx);
+}
+
+TEST_CASE("Packet rate plain vs SRTP", "[rtp][bench]")
+{
+    static uint8_t payload[RTP_BENCH_PAYLOAD];
+    static uint8_t packet[RTP_HEADER_SIZE + RTP_BENCH_PAYLOAD + RTP_SRTP_TRAILER_MAX];
+    rtp_srtp_t cm;
+    rtp_srtp_t gcm;
+
+    rtp_srtp_init(&cm, RTP_SRTP_AES128_CM_HMAC_SHA1_80, master_key, master_salt);
+    rtp_srtp_init(&gcm, RTP_SRTP_AEAD_AES_128_GCM, master_key, master_salt);
+    rtp_session_init(1, 96);
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        rtp_create_packet(1, payload, RTP_BENCH_PAYLOAD, packet, sizeof(packet));
+    }
+    int64_t plain_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        size_t len = rtp_create_packet(1, payload, RTP_BENCH_PAYLOAD, packet, sizeof(packet));
+        rtp_srtp_protect(&cm, packet, len, sizeof(packet));
+    }
+    int64_t cm_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < RTP_BENCH_PACKETS; i++) {
+        size_t len = rtp_create_packet(1, payload, RTP_BENCH_PAYLOAD, packet, sizeof(packet));
+        rtp_srtp_protect(&gcm, packet, len, sizeof(packet));
+    }
+    int64_t gcm_us = esp_timer_get_time() - start;
+
+    rtp_session_deinit(1);
+    rtp_srtp_deinit(&cm);
+    rtp_srtp_deinit(&gcm);
+
+    printf("%d packets, %d byte payload\n", RTP_BENCH_PACKETS, RTP_BENCH_PAYLOAD);
+    printf("plain:       %8lld us  %8lld packets/s\n", plain_us, RTP_BENCH_PACKETS * 1000000LL / (plain_us + 1));
+    printf("AES-CM/HMAC: %8lld us  %8lld packets/s\n", cm_us, RTP_BENCH_PACKETS * 1000000LL / (cm_us + 1));
+    printf("AEAD-GCM:    %8lld us  %8lld packets/s\n", gcm_us, RTP_BENCH_PACKETS * 1000000LL / (gcm_us + 1));
+}
@@ -5,6 +5,30 @@
 #include <string.h>
 
 
+/* Max number of distinct tags held in a compact log_reg_buffer tag table */
+#define LOG_REG_TAGS_MAX 16
+/* Tag ID used when the tag table is full, the tag pointer is then stored raw */
+#define LOG_REG_TAG_RAW 0xFF
+/* Worst case size of one compact entry: tag ID + raw tag + 2 varints */
+#define LOG_REG_ENTRY_MAX (1 + sizeof(char*) + 5 + 5)
+
+/* Shared drain task printing full buffers */
+#define LOG_BUFFER_DRAIN_QUEUE_LEN 4
+#define LOG_BUFFER_DRAIN_STACK 4096
+#define LOG_BUFFER_DRAIN_PRIO 1
+/* Bytes printed per chunk before the drain task yields */
+#define LOG_BUFFER_DRAIN_CHUNK 256
+/* Register entries printed per chunk before the drain task yields */
+#define LOG_REG_DRAIN_CHUNK 16
+
+
+typedef enum
+{
+    LOG_BUFFER_FORMAT_HEX,      // ESP_LOG_BUFFER_HEX lines with a header
+    LOG_BUFFER_FORMAT_BINARY    // raw bytes written to stdout
+} log_buffer_format_t;
+
+
 typedef struct
 {
     uint32_t reg;
@@ -21,6 +45,13 @@ typedef struct
     uint8_t is_printed;
     uint8_t incl_time;
     char *tag;
+    /* Compact mode: entries are encoded as a byte stream in `data` */
+    uint8_t compact;
+    uint8_t *data;
+    uint32_t last_reg;
+    uint32_t last_time;
+    char *tags[LOG_REG_TAGS_MAX];
+    uint8_t num_tags;
 } log_reg_buffer_t;
 
 
@@ -32,6 +63,7 @@ typedef struct
     uint8_t is_printed;
     size_t delayed_start;
     char *tag;
+    log_buffer_format_t format;
 } log_buffer_t;
 
 
@@ -45,7 +77,16 @@ void log_buffer_add(log_buffer_t *tb, void *data, size_t bytes);
 void log_buffer_add_byte(log_buffer_t *tb, uint8_t data);
 void log_buffer_enable_global(uint8_t *buffer, size_t size, size_t delayed_start);
 void log_buffer_print(log_buffer_t *tb);
+void log_buffer_set_format(log_buffer_t *tb, log_buffer_format_t format);
 
 void log_reg_buffer_init(log_reg_buffer_t *lr, log_reg_t *buffer, size_t size, uint8_t incl_timestamps, char *tag);
 void log_reg_buffer_add(log_reg_buffer_t *lr, uint32_t reg, char *tag);
 void log_reg_buffer_enable_global(log_reg_t *buffer, size_t size, uint8_t incl_timestamps);
+void log_reg_buffer_print(log_reg_buffer_t *lr);
+
+/*
+Compact register buffer. `buffer` is a byte buffer of `size` bytes. Each entry is stored as
+a tag ID, a varint timestamp delta (if enabled) and a varint of the register XOR the previous value,
+typically 2-4 bytes per entry instead of sizeof(log_reg_t). The stream is decoded when printed.
+*/
+void log_reg_buffer_init_compact(log_reg_buffer_t *lr, uint8_t *buffer, size_t size, uint8_t incl_timestamps, char *tag);
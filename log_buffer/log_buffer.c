@@ -1,12 +1,28 @@
 #include "log_buffer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 
 
 const char *TB_TAG = "log_buffer";
 
+typedef enum {
+    LOG_DRAIN_BUFFER,
+    LOG_DRAIN_REG_BUFFER
+} log_drain_type_t;
+
+typedef struct {
+    log_drain_type_t type;
+    void *obj;
+} log_drain_req_t;
+
+static QueueHandle_t drain_queue = NULL;
+static TaskHandle_t drain_task = NULL;
+
+static void _log_buffer_drain_start(void);
+
 
 void log_buffer_init(log_buffer_t *tb, uint8_t *buffer, size_t size, size_t delayed_start, char *tag)
 {
@@ -16,7 +32,15 @@ void log_buffer_init(log_buffer_t *tb, uint8_t *buffer, size_t size, size_t dela
     tb->is_printed = 0;
     tb->delayed_start = delayed_start;
     tb->tag = tag;
+    tb->format = LOG_BUFFER_FORMAT_HEX;
     memset(tb->buffer,0,size);
+    _log_buffer_drain_start();
+}
+
+
+void log_buffer_set_format(log_buffer_t *tb, log_buffer_format_t format)
+{
+    tb->format = format;
 }
 
 void log_buffer_add(log_buffer_t *tb, void *data, size_t bytes)
@@ -29,7 +53,6 @@ void log_buffer_add(log_buffer_t *tb, void *data, size_t bytes)
                 log_buffer_print(tb);       
             }
             else {
-                printf(".");
                 // Add data to log buffer
                 memcpy(tb->buffer + tb->write,data,bytes);
                 tb->write += bytes;
@@ -66,61 +89,201 @@ void log_buffer_enable_global(uint8_t *buffer, size_t size, size_t delayed_start
 
 
 /*
-FreeRTOS task to print the contents of the object buffer
+Print the contents of the object buffer in chunks, called from the drain task
 */
-void _log_buffer_print_task(void *arg)
+static void _log_buffer_dump(log_buffer_t *tb)
 {
-    log_buffer_t *tb = (log_buffer_t *)arg; // Get log_buffer_t obj
+    if(tb->format == LOG_BUFFER_FORMAT_BINARY) {
+        for(size_t i=0;i<tb->write;i+=LOG_BUFFER_DRAIN_CHUNK) {
+            size_t n = tb->write-i < LOG_BUFFER_DRAIN_CHUNK ? tb->write-i : LOG_BUFFER_DRAIN_CHUNK;
+            fwrite(tb->buffer+i,1,n,stdout);
+            fflush(stdout);
+            vTaskDelay(1);
+        }
+        return;
+    }
+
     ESP_LOGI("","-------------------------------------------------");
     ESP_LOGI("","%s",tb->tag);
     ESP_LOGI("","-------------------------------------------------");
-    ESP_LOG_BUFFER_HEX("log_buffer",tb->buffer,tb->size);
-    vTaskDelete(NULL);
+    for(size_t i=0;i<tb->write;i+=LOG_BUFFER_DRAIN_CHUNK) {
+        size_t n = tb->write-i < LOG_BUFFER_DRAIN_CHUNK ? tb->write-i : LOG_BUFFER_DRAIN_CHUNK;
+        ESP_LOG_BUFFER_HEX("log_buffer",tb->buffer+i,n);
+        vTaskDelay(1);
+    }
 }
 
 
 /*
-Creates a freeRTOS task to print the buffer
+Hand the buffer to the drain task. Never blocks, if the drain queue is full
+the request is retried on the next add.
 */
 void log_buffer_print(log_buffer_t *tb)
 {
-    xTaskCreatePinnedToCore(_log_buffer_print_task,"log_buffer print",8192,tb,10,NULL,APP_CPU_NUM);
-    tb->is_printed = 1;
+    log_drain_req_t req = {
+        .type = LOG_DRAIN_BUFFER,
+        .obj = tb
+    };
+    if(drain_queue != NULL && xQueueSend(drain_queue,&req,0) == pdTRUE) {
+        tb->is_printed = 1;
+    }
 }
 
 
 // -------------------------------------------------
 
 
-void _log_reg_buffer_print_task(void *arg)
+static size_t _log_reg_put_varint(uint8_t *out, uint32_t val)
+{
+    size_t n = 0;
+    while(val >= 0x80) {
+        out[n++] = (uint8_t)(val | 0x80);
+        val >>= 7;
+    }
+    out[n++] = (uint8_t)val;
+    return n;
+}
+
+
+static size_t _log_reg_get_varint(const uint8_t *in, uint32_t *val)
+{
+    size_t n = 0;
+    uint32_t shift = 0;
+    *val = 0;
+    do {
+        *val |= (uint32_t)(in[n] & 0x7F) << shift;
+        shift += 7;
+    } while(in[n++] & 0x80);
+    return n;
+}
+
+
+/*
+Decode and print the byte stream of a compact log_reg_buffer
+*/
+static void _log_reg_buffer_print_compact(log_reg_buffer_t *lr)
+{
+    size_t rd = 0;
+    uint32_t reg = 0;
+    uint32_t delta = 0;
+    char *tag;
+    for(int i=0;rd < lr->write;i++) {
+        uint8_t id = lr->data[rd++];
+        if(id == LOG_REG_TAG_RAW) {
+            memcpy(&tag,&lr->data[rd],sizeof(char*));
+            rd += sizeof(char*);
+        }
+        else {
+            tag = lr->tags[id];
+        }
+        if(lr->incl_time) {
+            rd += _log_reg_get_varint(&lr->data[rd],&delta);
+        }
+        uint32_t diff;
+        rd += _log_reg_get_varint(&lr->data[rd],&diff);
+        reg ^= diff;
+        if(lr->incl_time) {
+            ESP_LOGI("","%s: \t 0x%.8X \t %d",tag,reg,delta);
+        }
+        else {
+            ESP_LOGI("","%s: \t 0x%.8X",tag,reg);
+        }
+        if((i+1) % LOG_REG_DRAIN_CHUNK == 0)
+            vTaskDelay(1);
+    }
+}
+
+
+/*
+Print the contents of the register buffer, called from the drain task
+*/
+static void _log_reg_buffer_dump(log_reg_buffer_t *lr)
 {
-    log_reg_buffer_t *lr = (log_reg_buffer_t *)arg; // Get log_buffer_t obj
     uint32_t last = 0;
     ESP_LOGI("","-------------------------------------------------");
     ESP_LOGI("","%s",lr->tag);
     ESP_LOGI("","-------------------------------------------------");
-    if(lr->incl_time) {
+    if(lr->compact) {
+        _log_reg_buffer_print_compact(lr);
+    }
+    else if(lr->incl_time) {
         for(int i=0;i<lr->size;i++) {
             ESP_LOGI("","%s: \t 0x%.8X \t %d",(lr->buffer+i)->tag,(lr->buffer+i)->reg,(lr->buffer+i)->timestamp-last);
             last = (lr->buffer+i)->timestamp;
+            if((i+1) % LOG_REG_DRAIN_CHUNK == 0)
+                vTaskDelay(1);
         }
     }
     else {
         for(int i=0;i<lr->size;i++) {
             ESP_LOGI("","%s: \t 0x%.8X",(lr->buffer+i)->tag,(lr->buffer+i)->reg);
+            if((i+1) % LOG_REG_DRAIN_CHUNK == 0)
+                vTaskDelay(1);
         }
     }
-    vTaskDelete(NULL);
 }
 
 
 /*
-Creates a freeRTOS task to print the buffer
+Hand the buffer to the drain task. Never blocks, if the drain queue is full
+the request is retried on the next add.
 */
 void log_reg_buffer_print(log_reg_buffer_t *lr)
 {
-    xTaskCreatePinnedToCore(_log_reg_buffer_print_task,"log_reg_buffer print",8192,lr,10,NULL,APP_CPU_NUM);
-    lr->is_printed = 1;
+    log_drain_req_t req = {
+        .type = LOG_DRAIN_REG_BUFFER,
+        .obj = lr
+    };
+    if(drain_queue != NULL && xQueueSend(drain_queue,&req,0) == pdTRUE) {
+        lr->is_printed = 1;
+    }
+}
+
+
+// -------------------------------------------------
+
+
+/*
+Long-lived low priority task shared by all log buffers.
+Dump requests are taken from the drain queue and printed one at a time.
+*/
+static void _log_buffer_drain_task(void *arg)
+{
+    while(1) {
+        log_drain_req_t req;
+        xQueueReceive(drain_queue,&req,portMAX_DELAY);
+        if(req.type == LOG_DRAIN_BUFFER) {
+            _log_buffer_dump((log_buffer_t *)req.obj);
+        }
+        else {
+            _log_reg_buffer_dump((log_reg_buffer_t *)req.obj);
+        }
+    }
+}
+
+
+/*
+Creates the drain queue and task on first buffer init, so that nothing
+is allocated when a buffer fills up
+*/
+static void _log_buffer_drain_start(void)
+{
+    if(drain_task != NULL) {
+        return;
+    }
+
+    if(drain_queue == NULL) {
+        drain_queue = xQueueCreate(LOG_BUFFER_DRAIN_QUEUE_LEN,sizeof(log_drain_req_t));
+        if(drain_queue == NULL) {
+            ESP_LOGE(TB_TAG,"Failed to create drain queue");
+            return;
+        }
+    }
+
+    xTaskCreatePinnedToCore(_log_buffer_drain_task,"log_buffer drain",LOG_BUFFER_DRAIN_STACK,NULL,LOG_BUFFER_DRAIN_PRIO,&drain_task,APP_CPU_NUM);
+    if(drain_task == NULL) {
+        ESP_LOGE(TB_TAG,"Failed to create drain task");
+    }
 }
 
 
@@ -132,14 +295,88 @@ void log_reg_buffer_init(log_reg_buffer_t *lr, log_reg_t *buffer, size_t size, u
     lr->incl_time = incl_timestamps;
     lr->tag = tag;
     lr->write = 0;
+    lr->compact = 0;
+    lr->data = NULL;
     memset(lr->buffer,0,sizeof(log_reg_t)*lr->size);
+    _log_buffer_drain_start();
+}
+
+
+void log_reg_buffer_init_compact(log_reg_buffer_t *lr, uint8_t *buffer, size_t size, uint8_t incl_timestamps, char *tag)
+{
+    lr->buffer = NULL;
+    lr->data = buffer;
+    lr->size = size;
+    lr->is_printed = 0;
+    lr->incl_time = incl_timestamps;
+    lr->tag = tag;
+    lr->write = 0;
+    lr->compact = 1;
+    lr->last_reg = 0;
+    lr->last_time = 0;
+    lr->num_tags = 0;
+    memset(lr->data,0,size);
+    _log_buffer_drain_start();
+}
+
+
+/*
+Look up the ID of a tag in the tag table, adding it if not present.
+Returns LOG_REG_TAG_RAW if the table is full.
+*/
+static uint8_t _log_reg_tag_id(log_reg_buffer_t *lr, char *tag)
+{
+    for(uint8_t i=0;i<lr->num_tags;i++) {
+        if(lr->tags[i] == tag)
+            return i;
+    }
+    if(lr->num_tags < LOG_REG_TAGS_MAX) {
+        lr->tags[lr->num_tags] = tag;
+        return lr->num_tags++;
+    }
+    return LOG_REG_TAG_RAW;
+}
+
+
+static void _log_reg_buffer_add_compact(log_reg_buffer_t *lr, uint32_t reg, char *tag)
+{
+    uint8_t entry[LOG_REG_ENTRY_MAX];
+    size_t n = 0;
+    uint8_t num_tags = lr->num_tags;
+    uint8_t id = _log_reg_tag_id(lr,tag);
+    uint32_t now = 0;
+
+    entry[n++] = id;
+    if(id == LOG_REG_TAG_RAW) {
+        memcpy(&entry[n],&tag,sizeof(char*));
+        n += sizeof(char*);
+    }
+    if(lr->incl_time) {
+        now = (uint32_t)esp_timer_get_time();
+        n += _log_reg_put_varint(&entry[n],now-lr->last_time);
+    }
+    n += _log_reg_put_varint(&entry[n],reg^lr->last_reg);
+
+    if(lr->write+n > lr->size) { // buffer will be overflown if this entry is added
+        lr->num_tags = num_tags;
+        log_reg_buffer_print(lr);
+        return;
+    }
+
+    memcpy(lr->data + lr->write,entry,n);
+    lr->write += n;
+    lr->last_reg = reg;
+    lr->last_time = now;
 }
 
 
 void log_reg_buffer_add(log_reg_buffer_t *lr, uint32_t reg, char *tag)
 {
     if(!lr->is_printed) {
-        if(lr->write+1 > lr->size) { // buffer will be overflown if a new log happens
+        if(lr->compact) {
+            _log_reg_buffer_add_compact(lr,reg,tag);
+        }
+        else if(lr->write+1 > lr->size) { // buffer will be overflown if a new log happens
             log_reg_buffer_print(lr);       
         }
         else {